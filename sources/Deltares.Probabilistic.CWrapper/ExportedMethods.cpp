@@ -565,6 +565,20 @@ extern "C" DLL_PUBLIC void SetMultipleCallBack(int id, const char* property, Del
     }
 }
 
+extern "C" DLL_PUBLIC void SetBatchCallBack(int id, const char* property, Deltares::Models::ZValuesBatchCallBack callBack)
+{
+    try
+    {
+        ProjectServer::Instance().last_exception = "";
+        std::string propertyStr(property);
+        ProjectServer::Instance().SetBatchCallBack(id, propertyStr, callBack);
+    }
+    catch (const std::exception& e)
+    {
+        ProjectServer::Instance().last_exception = std::string(e.what());
+    }
+}
+
 extern "C" DLL_PUBLIC void SetEmptyCallBack(int id, const char* property, Deltares::Models::EmptyCallBack callBack)
 {
     try
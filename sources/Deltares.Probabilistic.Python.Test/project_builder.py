@@ -48,6 +48,14 @@ class LinearKwargs (TypedDict):
 #     L = 1.8
 #     return L - (kwargs['a'] + kwargs['b'])
 
+def linear_ab_wrong_shape(a, b):
+    L = 1.8
+    return (L - (a+b))[:-1]
+
+def linear_ab_scalar(a, b):
+    L = 1.8
+    return L
+
 def linear_ab_array_result(a, b):
     L = [1.8, 1.9, 1.95]
 
@@ -23,13 +23,15 @@ import unittest
 import pytest
 import sys
 import os
+import ctypes
+import numpy as np
 
 from io import StringIO
 
 from probabilistic_library.utils import FrozenList, FrozenObject
 from probabilistic_library.reliability import (DesignPoint, DesignPointMethod, ReliabilityMethod, CompareType, StartMethod,
                                                FragilityCurve, FragilityValue)
-from probabilistic_library.project import ReliabilityProject
+from probabilistic_library.project import ReliabilityProject, ModelProject
 from probabilistic_library.statistic import (Stochast, DistributionType, ContributingStochast, ConditionalValue,
                                              CorrelationType, CopulaType)
 
@@ -37,6 +39,9 @@ import project_builder
 
 margin = 0.01
 
+def _as_pointer(values):
+    return values.ctypes.data_as(ctypes.POINTER(ctypes.c_double))
+
 class Test_reliability(unittest.TestCase):
 
     def test_invalid_project(self):
@@ -92,6 +97,65 @@ class Test_reliability(unittest.TestCase):
 
         self.assertEqual(0, len(dp.messages))
 
+    def test_crude_monte_carlo_linear_vectorized(self):
+        project = project_builder.get_linear_project()
+        project.settings.reliability_method = ReliabilityMethod.crude_monte_carlo
+        project.run()
+        expected_beta = project.design_point.reliability_index
+
+        project = project_builder.get_linear_project()
+        project.model.vectorized = True
+        project.settings.reliability_method = ReliabilityMethod.crude_monte_carlo
+        project.run()
+
+        self.assertTrue(project.model.vectorized)
+        self.assertAlmostEqual(expected_beta, project.design_point.reliability_index, delta=1E-6)
+
+    def test_vectorized_batch_callback(self):
+        input_values = np.array([[0.1 * i - 0.5, 0.8 - 0.15 * i] for i in range(10)])
+
+        for get_project in [project_builder.get_linear_project, project_builder.get_linear_array_result_project]:
+            project = get_project()
+            project.is_valid()
+
+            output_size = sum(parameter.array_size if parameter.is_array else 1 for parameter in project.model.output_parameters)
+
+            # reference by the per sample callback
+            expected = np.full((input_values.shape[0], output_size), np.nan)
+            for i in range(input_values.shape[0]):
+                ModelProject._performCallBack(_as_pointer(input_values[i]), input_values.shape[1], _as_pointer(expected[i]))
+
+            project.model.vectorized = True
+            project.is_valid()
+
+            actual = np.full((input_values.shape[0], output_size), np.nan)
+            ModelProject._perform_batch_callback(input_values.shape[0], _as_pointer(input_values), input_values.shape[1],
+                                                 _as_pointer(actual), output_size)
+
+            self.assertFalse(np.isnan(expected).any())
+            np.testing.assert_array_equal(expected, actual)
+
+    def test_vectorized_wrong_shape(self):
+        input_values = np.array([[0.1 * i - 0.5, 0.8 - 0.15 * i] for i in range(10)])
+
+        for model in [project_builder.linear_ab_wrong_shape, project_builder.linear_ab_scalar]:
+            project = ReliabilityProject()
+            project.model = model
+            project_builder.assign_distributions(project, DistributionType.uniform)
+            project.model.vectorized = True
+            project.is_valid()
+
+            output_values = np.full((input_values.shape[0], 1), np.nan)
+
+            with self.assertRaises(ValueError):
+                project.model.run_batch(input_values, output_values)
+
+            # the exception does not pass the callback, the output values remain invalid
+            ModelProject._perform_batch_callback(input_values.shape[0], _as_pointer(input_values), input_values.shape[1],
+                                                 _as_pointer(output_values), 1)
+
+            self.assertTrue(np.isnan(output_values).all())
+
     def test_form_initialized_linear(self):
         project = project_builder.get_linear_initialized_project()
 
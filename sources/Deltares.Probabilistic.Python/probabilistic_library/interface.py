@@ -27,6 +27,7 @@ from ctypes import cdll
 
 CALLBACK = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.POINTER(ctypes.c_double), ctypes.c_int, ctypes.POINTER(ctypes.c_double))
 MULTIPLE_CALLBACK = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_int, ctypes.POINTER(ctypes.POINTER(ctypes.c_double)), ctypes.c_int, ctypes.POINTER(ctypes.POINTER(ctypes.c_double)))
+BATCH_CALLBACK = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_int, ctypes.POINTER(ctypes.c_double), ctypes.c_int, ctypes.POINTER(ctypes.c_double), ctypes.c_int)
 EMPTY_CALLBACK = ctypes.CFUNCTYPE(ctypes.c_void_p)
 
 def _print_error(message):
@@ -281,6 +282,10 @@ def SetMultipleCallBack(id_, property_, callBack_):
     lib.SetMultipleCallBack(ctypes.c_int(id_), bytes(property_, 'utf-8'), callBack_)
     _check_exception()
 
+def SetBatchCallBack(id_, property_, callBack_):
+    lib.SetBatchCallBack(ctypes.c_int(id_), bytes(property_, 'utf-8'), callBack_)
+    _check_exception()
+
 def SetEmptyCallBack(id_, property_, callBack_):
     lib.SetEmptyCallBack(ctypes.c_int(id_), bytes(property_, 'utf-8'), callBack_)
     _check_exception()
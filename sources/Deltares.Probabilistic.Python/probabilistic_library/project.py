@@ -35,6 +35,7 @@ from .utils import FrozenObject, FrozenList, CallbackList
 from . import interface
 
 import inspect
+import numpy as np
 
 if not interface.IsLibraryLoaded():
     interface.LoadDefaultLibrary()
@@ -50,7 +51,7 @@ class ZModel(FrozenObject):
     _callback = None
     _multiple_callback = None
 
-    def __init__(self, callback = None, output_parameter_size = 1):
+    def __init__(self, callback = None, output_parameter_size = 1, vectorized = False):
         self._model = None
         source_code = None
         if isinstance(callback, str):
@@ -70,6 +71,7 @@ class ZModel(FrozenObject):
         self._project = None
         self._project_id = 0
         self._z_values_size = 0
+        self._vectorized = vectorized
         ZModel._index = 0;
         ZModel._callback = callback
 
@@ -91,6 +93,7 @@ class ZModel(FrozenObject):
         return ['name',
                 'input_parameters',
                 'output_parameters',
+                'vectorized',
                  'print']
 
     def __del__(self):
@@ -170,6 +173,20 @@ class ZModel(FrozenObject):
         """List of output parameters"""
         return self._output_parameters
 
+    @property
+    def vectorized(self) -> bool:
+        """Indicates whether the model is invoked once for a whole batch of samples
+
+        When set, each input parameter is passed as a numpy array with one value per sample (a 2D array
+        with one row per sample for array parameters). The model should return a numpy array with one
+        value per sample, a 2D array with one row per sample or a tuple/list of such arrays, one per
+        output parameter. The input values are views on the library's memory and must not be kept."""
+        return self._vectorized
+
+    @vectorized.setter
+    def vectorized(self, value : bool):
+        self._vectorized = value
+
     def _set_callback(self, callback):
         ZModel._callback = callback
 
@@ -210,7 +227,7 @@ class ZModel(FrozenObject):
         if not self._model is None:
             self._model.initialize_for_run()
 
-        if self._is_function:
+        if self._is_function and not self._vectorized:
             if self._max_processes > 1:
                 self._pool = Pool(self._max_processes)
             elif self._max_processes < 1:
@@ -244,7 +261,14 @@ class ZModel(FrozenObject):
 
     def run_multiple(self, samples):
         """Performs the execution of multiple samples by the model (used internally)"""
-        if self._is_function and self._pool is None:
+        if self._is_function and self._vectorized:
+            input_values = np.array([sample.input_values for sample in samples], dtype=float)
+            output_values = np.full((len(samples), self._z_values_size), np.nan)
+            self._run_vectorized(input_values, output_values)
+            for i in range(len(samples)):
+                for j in range(self._z_values_size):
+                    samples[i].output_values[j] = output_values[i, j]
+        elif self._is_function and self._pool is None:
             for sample in samples:
                 self.run(sample)
         elif self._is_function and not self._pool is None:
@@ -258,9 +282,59 @@ class ZModel(FrozenObject):
         else:
             ZModel._multiple_callback(samples)
 
+    def run_batch(self, input_values, output_values):
+        """Performs the execution of a batch of samples by the model (used internally)
+
+        The input values and output values are 2D numpy arrays with one row per sample"""
+        if self._is_function and self._vectorized:
+            self._run_vectorized(input_values, output_values)
+        else:
+            self.run_multiple([_Sample(input_values[i], output_values[i]) for i in range(input_values.shape[0])])
+
+    def _run_vectorized(self, input_values, output_values):
+        z = ZModel._callback(*self._get_columns(input_values))
+        if type(z) is list or type(z) is tuple:
+            z = np.hstack([self._get_output_block(values, input_values.shape[0]) for values in z])
+        else:
+            z = self._get_output_block(z, input_values.shape[0])
+
+        if z.shape[1] > output_values.shape[1]:
+            raise ValueError(f'Vectorized model returned {z.shape[1]} output values per sample, expected {output_values.shape[1]}')
+
+        # the output values are only assigned when the whole result is valid
+        output_values[:, :z.shape[1]] = z
+
+    @staticmethod
+    def _get_output_block(values, sample_count):
+        values = np.asarray(values, dtype=float)
+        if values.ndim == 1:
+            values = values.reshape(-1, 1)
+
+        if values.ndim != 2 or values.shape[0] != sample_count:
+            raise ValueError(f'Vectorized model returned an array with shape {values.shape}, expected {sample_count} rows')
+
+        return values
+
+    def _get_columns(self, input_values):
+        if not self._has_arrays:
+            return [input_values[:, i] for i in range(input_values.shape[1])]
+
+        args = []
+        index = 0
+        for array_size in self._array_sizes:
+            if array_size == -1:
+                args.append(input_values[:, index])
+                index += 1
+            else:
+                args.append(input_values[:, index:index + array_size])
+                index += array_size
+        return args
+
     def run(self, sample):
         """Performs the execution of a sample by the model (used internally)"""
-        if self._is_function:
+        if self._is_function and self._vectorized:
+            self.run_multiple([sample])
+        elif self._is_function:
             sample_input = self._get_input(sample)
             z = ZModel._callback(*sample_input)
             self._assign_output(sample, z)
@@ -419,6 +493,8 @@ class ModelProject(FrozenObject):
         self._project_id = project_id
         self._callback = interface.CALLBACK(self._performCallBack)
         self._multiple_callback = interface.MULTIPLE_CALLBACK(self._perform_multiple_callback)
+        self._batch_callback = interface.BATCH_CALLBACK(self._perform_batch_callback)
+        self._batch_callback_assigned = False
 
         interface.SetCallBack(project_id, 'model', self._callback)
         interface.SetMultipleCallBack(project_id, 'model', self._multiple_callback)
@@ -441,6 +517,24 @@ class ModelProject(FrozenObject):
             samples.append(_Sample(values[i][:input_size], output_values[i]))
         ModelProject._zmodel.run_multiple(samples)
 
+    @interface.BATCH_CALLBACK
+    @staticmethod
+    def _perform_batch_callback(sample_count, values, input_size, output_values, output_size):
+        if sample_count > 0:
+            input_array = np.ctypeslib.as_array(values, shape=(sample_count, input_size))
+            output_array = np.ctypeslib.as_array(output_values, shape=(sample_count, output_size))
+            ModelProject._zmodel.run_batch(input_array, output_array)
+
+    def _update_callbacks(self):
+        # the batch callback replaces the multiple callback only for vectorized models
+        vectorized = isinstance(self._model, ZModel) and self._model.vectorized
+        if vectorized != self._batch_callback_assigned:
+            if vectorized:
+                interface.SetBatchCallBack(self._project_id, 'model', self._batch_callback)
+            else:
+                interface.SetMultipleCallBack(self._project_id, 'model', self._multiple_callback)
+            self._batch_callback_assigned = vectorized
+
     def is_valid(self) -> bool:
         """Indicates whether the settings are valid"""
         self._update()
@@ -499,7 +593,8 @@ class ModelProject(FrozenObject):
         When a model is set, it accepts a python function or python class method. Alternatively,
         a string defining a function is accepted too. The model should accept a number of input
         values (floats) or array of input values and returns a single value (float), an array of
-        floats or a tuple of floats.
+        floats or a tuple of floats. When `ZModel.vectorized` is set, the model is invoked once per
+        batch of samples with numpy arrays instead.
 
         When set, the function/method/string is wrapped in a `ZModel`. The ZModel has information
         about its input and output parameters (derived from the function signature). When the model
@@ -589,6 +684,7 @@ class ModelProject(FrozenObject):
             if hasattr(self.settings, 'max_parallel_processes'):
                 self._model.set_max_processes(self.settings.max_parallel_processes)
             self._model.initialize_for_run()
+        self._update_callbacks()
         ModelProject._zmodel = self._model
 
     def _run(self):
@@ -75,10 +75,27 @@ class GradientType(Enum):
     def __str__(self):
         return str(self.value)
 
+class RandomGeneratorType(Enum):
+    """Enumeration which defines the algorithm to generate random values"""
+    mersenne_twister = 'mersenne_twister'
+    philox = 'philox'
+    def __str__(self):
+        return str(self.value)
+
 class SampleMethod(Enum):
     """Enumeration which defines how samples are generated in the subset simulation algorithm"""
     markov_chain = 'markov_chain'
     adaptive_conditional = 'adaptive_conditional'
+    delayed_rejection = 'delayed_rejection'
+    crank_nicolson = 'crank_nicolson'
+    hamiltonian = 'hamiltonian'
+    def __str__(self):
+        return str(self.value)
+
+class IntegrationGridType(Enum):
+    """Enumeration which defines the grid over which numerical integration takes place"""
+    full_grid = 'full_grid'
+    adaptive_grid = 'adaptive_grid'
     def __str__(self):
         return str(self.value)
 
@@ -159,7 +176,9 @@ class Settings(FrozenObject):
                 'max_steps_sphere_search',
                 'is_repeatable_random',
                 'random_seed',
-                'sample_method'
+                'random_generator_type',
+                'sample_method',
+                'integration_grid_type',
                 'minimum_samples',
                 'maximum_samples',
                 'minimum_iterations',
@@ -296,6 +315,15 @@ class Settings(FrozenObject):
     def random_seed(self, value : int):
         interface.SetIntValue(self._id, 'random_seed', value)
 
+    @property
+    def random_generator_type(self) -> RandomGeneratorType:
+        """Algorithm to generate random values, a counter based generator (philox) allows parallel generation of samples"""
+        return RandomGeneratorType[interface.GetStringValue(self._id, 'random_generator_type')]
+
+    @random_generator_type.setter
+    def random_generator_type(self, value : RandomGeneratorType):
+        interface.SetStringValue(self._id, 'random_generator_type', str(value))
+
     @property
     def sample_method(self) -> SampleMethod:
         """The way samples are generated for the subset simulation algorithm"""
@@ -305,6 +333,15 @@ class Settings(FrozenObject):
     def sample_method(self, value : SampleMethod):
         interface.SetStringValue(self._id, 'sample_method', str(value))
 
+    @property
+    def integration_grid_type(self) -> IntegrationGridType:
+        """The grid over which numerical integration takes place, an adaptive grid allows numerical integration with many variables"""
+        return IntegrationGridType[interface.GetStringValue(self._id, 'integration_grid_type')]
+
+    @integration_grid_type.setter
+    def integration_grid_type(self, value : IntegrationGridType):
+        interface.SetStringValue(self._id, 'integration_grid_type', str(value))
+
     @property
     def minimum_samples(self) -> int:
         """The minimum number of samples to be used"""
@@ -27,7 +27,7 @@ import matplotlib.pyplot as plt
 from .utils import FrozenObject, FrozenList, CallbackList
 from .logging import Evaluation, Message, ValidationReport
 from .statistic import Stochast, ProbabilityValue
-from .reliability import StochastSettings, GradientType
+from .reliability import StochastSettings, GradientType, RandomGeneratorType
 from . import interface
 
 if not interface.IsLibraryLoaded():
@@ -77,6 +77,7 @@ class UncertaintySettings(FrozenObject):
                 'uncertainty_method',
                 'is_repeatable_random',
                 'random_seed',
+                'random_generator_type',
                 'minimum_samples',
                 'maximum_samples',
                 'maximum_iterations',
@@ -92,6 +93,7 @@ class UncertaintySettings(FrozenObject):
                 'derive_samples_from_variation_coefficient',
                 'calculate_correlations',
                 'calculate_input_correlations',
+                'calculate_rank_correlations',
                 'quantiles',
                 'stochast_settings',
                 'is_valid',
@@ -169,6 +171,15 @@ class UncertaintySettings(FrozenObject):
     def random_seed(self, value : int):
         interface.SetIntValue(self._id, 'random_seed', value)
 
+    @property
+    def random_generator_type(self) -> RandomGeneratorType:
+        """Algorithm to generate random values, a counter based generator (philox) allows parallel generation of samples"""
+        return RandomGeneratorType[interface.GetStringValue(self._id, 'random_generator_type')]
+
+    @random_generator_type.setter
+    def random_generator_type(self, value : RandomGeneratorType):
+        interface.SetStringValue(self._id, 'random_generator_type', str(value))
+
     @property
     def minimum_samples(self) -> int:
         """The minimum number of samples to be used"""
@@ -318,6 +329,15 @@ class UncertaintySettings(FrozenObject):
     def calculate_input_correlations(self, value : bool):
         interface.SetBoolValue(self._id, 'calculate_input_correlations', value)
 
+    @property
+    def calculate_rank_correlations(self) -> bool:
+        """Indicates that rank (Spearman) correlations are calculated instead of correlations in the standard normal space"""
+        return interface.GetBoolValue(self._id, 'calculate_rank_correlations')
+
+    @calculate_rank_correlations.setter
+    def calculate_rank_correlations(self, value : bool):
+        interface.SetBoolValue(self._id, 'calculate_rank_correlations', value)
+
     @property
     def stochast_settings(self) -> list[StochastSettings]:
         """List of settings specified per stochastic variable"""
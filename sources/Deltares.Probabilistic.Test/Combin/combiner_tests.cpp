@@ -24,6 +24,9 @@
 #include "../../Deltares.Probabilistic/Math/NumericSupport.h"
 #include "../../Deltares.Probabilistic/Combine/HohenbichlerFormCombiner.h"
 #include "../../Deltares.Probabilistic/Combine/HohenbichlerNumIntCombiner.h"
+#include "../../Deltares.Probabilistic/Combine/HohenbichlerNumInt.h"
+#include "../../Deltares.Probabilistic/Combine/HohenbichlerTable.h"
+#include "../../Deltares.Probabilistic/Statistics/StandardNormal.h"
 #include "../../Deltares.Probabilistic/Combine/DirectionalSamplingCombiner.h"
 #include "../../Deltares.Probabilistic/Combine/ImportanceSamplingCombiner.h"
 #include "../../Deltares.Probabilistic/Combine/ExcludingCombiner.h"
@@ -44,6 +47,8 @@ namespace Deltares::Probabilistic::Test
         ImportanceSamplingCombinerInvertedTest();
         WeightedSumCombinerTest();
         HohenbichlerExcludingCombinerTest();
+        HohenbichlerBatchTest();
+        HohenbichlerTableTest();
     }
 
     void CombinerTest::HohenbichlerCombinerTest() const
@@ -127,6 +132,81 @@ namespace Deltares::Probabilistic::Test
         excluding_tester(excluding_combiner.get(), 1.0, 1.025286);
     }
 
+    void CombinerTest::HohenbichlerBatchTest() const
+    {
+        auto hh = Reliability::HohenbichlerNumInt();
+
+        const std::vector<Reliability::HohenbichlerInput> inputs =
+        {
+            { 3.0, 3.0, 0.0 }, { 2.0, 4.0, 0.0 }, { 4.0, 2.0, 0.0 }, { 3.0, 3.5, 0.6 }, { -1.0, 2.5, -0.4 }, { 3.0, 3.0, 1.0 }
+        };
+
+        const std::vector<double> betasOr = hh.BetaHohenbichler(inputs, Reliability::combineAndOr::combOr);
+        const std::vector<double> betasAnd = hh.BetaHohenbichler(inputs, Reliability::combineAndOr::combAnd);
+        ASSERT_EQ(betasOr.size(), inputs.size());
+        ASSERT_EQ(betasAnd.size(), inputs.size());
+
+        // independent pairs
+        for (size_t i = 0; i < 3; i++)
+        {
+            const double q1 = Statistics::StandardNormal::getQFromU(inputs[i].Beta1);
+            const double q2 = Statistics::StandardNormal::getQFromU(inputs[i].Beta2);
+            EXPECT_NEAR(betasAnd[i], Statistics::StandardNormal::getUFromQ(q1 * q2), margin);
+            EXPECT_NEAR(betasOr[i], Statistics::StandardNormal::getUFromQ(q1 + q2 - q1 * q2), margin);
+        }
+
+        // order of the reliability indices does not matter
+        EXPECT_EQ(betasOr[1], betasOr[2]);
+
+        // bivariate normal probabilities, pre-computed
+        EXPECT_NEAR(Statistics::StandardNormal::getQFromU(betasAnd[3]), 4.1446589e-05, 1e-10);
+        EXPECT_NEAR(Statistics::StandardNormal::getQFromU(betasAnd[4]), 2.7612659e-03, 1e-9);
+
+        // fully correlated
+        EXPECT_EQ(betasOr[5], 3.0);
+    }
+
+    void CombinerTest::HohenbichlerTableTest() const
+    {
+        auto hh = Reliability::HohenbichlerNumInt();
+        auto hhTable = Reliability::HohenbichlerNumInt();
+        hhTable.UseTable = true;
+
+        std::vector<Reliability::HohenbichlerInput> inputs;
+        for (double beta1 = 0.03; beta1 < 7.0; beta1 += 0.37)
+        {
+            for (double beta2 = 0.11; beta2 < 7.0; beta2 += 0.43)
+            {
+                for (double rho = -0.93; rho < 0.95; rho += 0.11)
+                {
+                    inputs.push_back({ beta1, beta2, rho });
+                }
+            }
+        }
+
+        for (auto system : { Reliability::combineAndOr::combAnd, Reliability::combineAndOr::combOr })
+        {
+            const std::vector<double> betas = hh.BetaHohenbichler(inputs, system);
+            const std::vector<double> betasTable = hhTable.BetaHohenbichler(inputs, system);
+
+            double maxDiff = 0;
+            for (size_t i = 0; i < inputs.size(); i++)
+            {
+                maxDiff = std::max(maxDiff, std::fabs(betas[i] - betasTable[i]));
+            }
+            EXPECT_LT(maxDiff, 0.001);
+        }
+
+        // out of range
+        EXPECT_TRUE(std::isnan(Reliability::HohenbichlerTable::getTable().getBetaBoth(3.0, 7.5, 0.5)));
+        EXPECT_TRUE(std::isnan(Reliability::HohenbichlerTable::getTable().getBetaBoth(3.0, 3.0, 0.99)));
+
+        auto combiner = std::make_unique<Reliability::HohenbichlerNumIntCombiner>();
+        combiner->UseTable = true;
+        auto ref = Reliability::alphaBeta(2.786202, { 0.634747,  0.391671, 0.566766,  0.3499527 }); // pre-computed
+        tester(combiner.get(), 3.0, ref, Reliability::combineAndOr::combOr);
+    }
+
     void CombinerTest::tester(Reliability::Combiner* comb, const double beta, const Reliability::alphaBeta& ref, const Reliability::combineAndOr AndOr ) const
     {
         constexpr int nElements = 2; // Number of elements
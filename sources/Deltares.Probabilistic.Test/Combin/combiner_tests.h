@@ -42,6 +42,8 @@ namespace Deltares::Probabilistic::Test
         void ImportanceSamplingCombinerInvertedTest() const;
         void WeightedSumCombinerTest() const;
         void HohenbichlerExcludingCombinerTest() const;
+        void HohenbichlerBatchTest() const;
+        void HohenbichlerTableTest() const;
         void tester(Reliability::Combiner* comb, const double beta, const Reliability::alphaBeta& ref, const Reliability::combineAndOr AndOr) const;
         void excluding_tester(Reliability::ExcludingCombiner* combiner, const double beta, const double expectedBeta) const;
         void addDesignPoint(const double beta, const size_t nStochasts, size_t i, std::vector<double>& alphaInput, std::vector<std::shared_ptr<Deltares::Statistics::Stochast>>& stochasts, std::vector<std::shared_ptr<Deltares::Reliability::DesignPoint>>& designPoints) const;
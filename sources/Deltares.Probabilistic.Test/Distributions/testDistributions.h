@@ -47,6 +47,9 @@ namespace Deltares::Probabilistic::Test
         static void testExponential();
         static void testGumbel();
         static void testFrechet();
+        static void testSumLogLikelihood();
+        static void testFitNelderMead();
+        static void testKSTest();
         static void testWeibull();
         static void testGEV();
         static void testPareto();
@@ -20,9 +20,17 @@
 // All rights reserved.
 //
 #include <numbers>
+#include <algorithm>
 #include <gtest/gtest.h>
 #include "testDistributions.h"
 #include "../../Deltares.Probabilistic/Math/RandomValueGenerator.h"
+#include "../../Deltares.Probabilistic/Statistics/Distributions/ExponentialDistribution.h"
+#include "../../Deltares.Probabilistic/Statistics/Distributions/GumbelDistribution.h"
+#include "../../Deltares.Probabilistic/Statistics/Distributions/KSCalculator.h"
+#include "../../Deltares.Probabilistic/Statistics/Distributions/NormalDistribution.h"
+#include "../../Deltares.Probabilistic/Statistics/Distributions/RayleighNDistribution.h"
+#include "../../Deltares.Probabilistic/Statistics/Distributions/DistributionFitter.h"
+#include "../../Deltares.Probabilistic/Statistics/Distributions/TruncatedDistribution.h"
 
 namespace Deltares::Probabilistic::Test
 {
@@ -567,6 +575,169 @@ namespace Deltares::Probabilistic::Test
         testFitShift(stochast, 0.4);
     }
 
+    void testDistributions::testSumLogLikelihood()
+    {
+        auto random = Deltares::Numeric::RandomValueGenerator();
+
+        std::vector<double> values(100);
+        for (double& value : values)
+        {
+            value = 3 * random.next();
+        }
+
+        Statistics::StochastProperties stochast;
+        stochast.Location = 1.2;
+        stochast.Scale = 0.8;
+        stochast.Shift = 0.5;
+        stochast.Minimum = 0.1;
+        stochast.Maximum = 2.9;
+
+        std::vector<std::shared_ptr<Statistics::Distribution>> distributions =
+        {
+            std::make_shared<Statistics::NormalDistribution>(),
+            std::make_shared<Statistics::GumbelDistribution>(),
+            std::make_shared<Statistics::TruncatedDistribution>(std::make_shared<Statistics::NormalDistribution>())
+        };
+
+        // the sum over all values at once should be equal to the sum of the individual values
+        for (const std::shared_ptr<Statistics::Distribution>& distribution : distributions)
+        {
+            double expectedSum = 0;
+            for (double value : values)
+            {
+                expectedSum += distribution->getLogLikelihood(stochast, value);
+            }
+
+            EXPECT_NEAR(expectedSum, distribution->getSumLogLikelihood(stochast, values), 1e-9);
+        }
+    }
+
+    void testDistributions::testKSTest()
+    {
+        auto random = Deltares::Numeric::RandomValueGenerator();
+
+        std::vector<double> values(5000);
+        for (double& value : values)
+        {
+            value = 0.5 + 2 * random.next();
+        }
+
+        std::vector<double> sortedValues = values;
+        std::sort(sortedValues.begin(), sortedValues.end());
+
+        Statistics::StochastProperties stochast;
+        stochast.Location = 1.5;
+        stochast.Scale = 0.6;
+        stochast.Shift = 0.2;
+        stochast.Minimum = 0.4;
+        stochast.Maximum = 2.6;
+
+        std::vector<std::shared_ptr<Statistics::Distribution>> distributions =
+        {
+            std::make_shared<Statistics::NormalDistribution>(),
+            std::make_shared<Statistics::GumbelDistribution>(),
+            std::make_shared<Statistics::ExponentialDistribution>(),
+            std::make_shared<Statistics::TruncatedDistribution>(std::make_shared<Statistics::NormalDistribution>())
+        };
+
+        std::vector<Statistics::KSCandidate> candidates;
+        std::vector<double> expectedValues;
+
+        for (const std::shared_ptr<Statistics::Distribution>& distribution : distributions)
+        {
+            candidates.push_back(Statistics::KSCandidate{ distribution.get(), &stochast });
+
+            // statistic with a CDF evaluation per value
+            double expected = 0;
+            for (size_t i = 0; i < sortedValues.size(); i++)
+            {
+                const double cdf = distribution->getCDF(stochast, sortedValues[i]);
+                const double size = static_cast<double>(sortedValues.size());
+                expected = std::max(expected, std::max(std::fabs(cdf - i / size), std::fabs(cdf - (i + 1) / size)));
+            }
+            expectedValues.push_back(expected);
+
+            EXPECT_NEAR(expected, Statistics::KSCalculator::getGoodnessOfFit(values, *distribution, stochast), 1e-12);
+        }
+
+        // all candidates in one pass
+        std::vector<double> ksValues = Statistics::KSCalculator::getGoodnessOfFits(values, candidates);
+        ASSERT_EQ(distributions.size(), ksValues.size());
+
+        for (size_t i = 0; i < distributions.size(); i++)
+        {
+            EXPECT_NEAR(expectedValues[i], ksValues[i], 1e-12);
+        }
+
+        // binned statistic should not exceed the exact statistic by more than the error bound
+        constexpr int binCount = 100;
+        const double bound = Statistics::KSCalculator::getBinningErrorBound(values.size(), binCount);
+        EXPECT_NEAR(0.01, bound, 1e-12);
+
+        std::vector<double> binnedValues = Statistics::KSCalculator::getGoodnessOfFits(values, candidates, binCount);
+
+        for (size_t i = 0; i < distributions.size(); i++)
+        {
+            EXPECT_LE(binnedValues[i], expectedValues[i] + 1e-12);
+            EXPECT_GE(binnedValues[i], expectedValues[i] - bound);
+        }
+
+        EXPECT_TRUE(std::isnan(Statistics::KSCalculator::getGoodnessOfFits(std::vector<double>(), candidates)[0]));
+    }
+
+    void testDistributions::testFitNelderMead()
+    {
+        auto random = Deltares::Numeric::RandomValueGenerator();
+
+        Statistics::Stochast stochast = Statistics::Stochast();
+        stochast.setDistributionType(Statistics::DistributionType::RayleighN);
+        stochast.getProperties()->Scale = 1.1;
+        stochast.getProperties()->Shape = 2.0;
+
+        std::vector<double> values(1000);
+        for (double& value : values)
+        {
+            value = stochast.getXFromU(Statistics::StandardNormal::getUFromP(random.next()));
+        }
+
+        // same search area as the fit of the RayleighN distribution with a free shift
+        auto distribution = Statistics::RayleighNDistribution();
+        Statistics::StochastProperties initial;
+        const auto [minimum, maximum] = std::ranges::minmax(values);
+        initial.Shift = minimum - (maximum - minimum) / static_cast<double>(values.size());
+        initial.Shape = 1;
+        double sum = 0;
+        for (double value : values)
+        {
+            sum += (value - initial.Shift) * (value - initial.Shift);
+        }
+        initial.Scale = std::sqrt(sum / (2 * values.size()));
+
+        const std::vector minValues = { 0.5 * initial.Scale, 0.5, 0.5 * initial.Shift };
+        const std::vector maxValues = { 1.5 * initial.Scale, 1.5, 1.5 * initial.Shift };
+        using enum Statistics::DistributionPropertyType;
+        const std::vector properties = { Scale, Shape, Shift };
+
+        std::vector<double> logLikelihoods;
+        for (bool useNelderMead : { false, true })
+        {
+            auto fitter = Statistics::DistributionFitter();
+            fitter.UseNelderMead = useNelderMead;
+
+            Statistics::StochastProperties fitted = initial;
+            const std::vector<double> parameters = fitter.fitByLogLikelihood(values, &distribution, fitted, minValues, maxValues, properties);
+            for (size_t i = 0; i < properties.size(); i++)
+            {
+                fitted.applyValue(properties[i], parameters[i]);
+            }
+
+            logLikelihoods.push_back(distribution.getSumLogLikelihood(fitted, values));
+        }
+
+        // the simplex search should find a likelihood which is at least as high as the grid refinements
+        EXPECT_GE(logLikelihoods[1], logLikelihoods[0] - 1e-6 * std::fabs(logLikelihoods[0]));
+    }
+
     void testDistributions::testBeta()
     {
         Statistics::Stochast stochast = Statistics::Stochast();
@@ -34,6 +34,7 @@ namespace Deltares::Probabilistic::Test
         void testCholeskyDecompositionCase3() const;
         void testCholeskyDecompositionCase4() const;
         void testCholeskyDecompositionCase5() const;
+        void testApplyCorrelation() const;
         void performTest(const std::initializer_list<double>& m, const std::initializer_list<double>& ref) const;
         const double margin = 1e-9;
     };
@@ -22,6 +22,7 @@
 #include <gtest/gtest.h>
 #include "testCholeskiDecomposition.h"
 #include "../Utils/testutils.h"
+#include "../../Deltares.Probabilistic/Statistics/CorrelationMatrix.h"
 
 namespace Deltares::Probabilistic::Test
 {
@@ -32,6 +33,7 @@ namespace Deltares::Probabilistic::Test
         testCholeskyDecompositionCase3();
         testCholeskyDecompositionCase4();
         testCholeskyDecompositionCase5();
+        testApplyCorrelation();
     }
 
     void choleski_decomp_tests::testCholeskyDecompositionUnityMatrix() const
@@ -160,4 +162,58 @@ namespace Deltares::Probabilistic::Test
 
         performTest(correlation_matrix1d, expected_Cholesky1d);
     }
+
+    void choleski_decomp_tests::testApplyCorrelation() const
+    {
+        // two correlated blocks and an uncorrelated stochast in between
+        constexpr size_t nStochasts = 7;
+        auto correlation = Statistics::CorrelationMatrix(false);
+        correlation.Init(static_cast<int>(nStochasts));
+        correlation.SetCorrelation(0, 1, 0.5, CorrelationType::Gaussian);
+        correlation.SetCorrelation(0, 2, 0.3, CorrelationType::Gaussian);
+        correlation.SetCorrelation(1, 2, 0.4, CorrelationType::Gaussian);
+        correlation.SetCorrelation(4, 5, -0.6, CorrelationType::Gaussian);
+        correlation.SetCorrelation(5, 6, 0.2, CorrelationType::Gaussian);
+        correlation.InitializeForRun();
+
+        auto matrix = Numeric::Matrix(nStochasts, nStochasts);
+        for (size_t i = 0; i < nStochasts; i++)
+        {
+            for (size_t j = 0; j < nStochasts; j++)
+            {
+                matrix(i, j) = correlation.GetCorrelation(static_cast<int>(i), static_cast<int>(j)).value;
+            }
+        }
+        const auto cholesky = matrix.CholeskyDecomposition();
+
+        // more samples than fit in one block, with a stride larger than the number of stochasts
+        constexpr size_t count = 150;
+        constexpr size_t stride = nStochasts + 2;
+        std::vector<double> uValues(count * stride);
+        for (size_t k = 0; k < uValues.size(); k++)
+        {
+            uValues[k] = std::sin(0.37 * static_cast<double>(k));
+        }
+
+        std::vector<double> correlated(count * nStochasts);
+        correlation.ApplyCorrelation(uValues.data(), nStochasts, stride, count, correlated.data());
+
+        for (size_t j = 0; j < count; j++)
+        {
+            const std::vector<double> sample(uValues.begin() + j * stride, uValues.begin() + j * stride + nStochasts);
+            const std::vector<double> correlatedSample = correlation.ApplyCorrelation(sample);
+
+            for (size_t i = 0; i < nStochasts; i++)
+            {
+                double expected = 0.0;
+                for (size_t k = 0; k < nStochasts; k++)
+                {
+                    expected += cholesky(i, k) * sample[k];
+                }
+
+                EXPECT_NEAR(correlatedSample[i], expected, margin);
+                EXPECT_NEAR(correlated[i * count + j], expected, margin);
+            }
+        }
+    }
 }
@@ -30,6 +30,7 @@ namespace Deltares::Probabilistic::Test
         void allKMeanTests();
     private:
         void test1();
+        void testLargeClusters();
         const double margin = 1e-2;
     };
 }
@@ -19,9 +19,12 @@
 // Stichting Deltares and remain full property of Stichting Deltares at all times.
 // All rights reserved.
 //
+#include <algorithm>
 #include "testKMean.h"
 #include "../../Deltares.Probabilistic/Optimization/KMeansClustering.h"
 #include "../../Deltares.Probabilistic/Model/Sample.h"
+#include "../../Deltares.Probabilistic/Math/RandomValueGenerator.h"
+#include "../../Deltares.Probabilistic/Statistics/StandardNormal.h"
 
 using namespace Deltares::Numeric;
 
@@ -30,6 +33,7 @@ namespace Deltares::Probabilistic::Test
     void testKMean::allKMeanTests()
     {
         test1();
+        testLargeClusters();
     }
 
     void testKMean::test1()
@@ -75,5 +79,41 @@ namespace Deltares::Probabilistic::Test
         EXPECT_NEAR(result[2]->Values[1], 0.222, margin);
     }
 
-}
+    void testKMean::testLargeClusters()
+    {
+        // more samples than are used to calculate the silhouette coefficient exactly
+        const std::vector<std::vector<double>> expectedCenters = { { -4.0, 0.0 }, { 0.0, 5.0 }, { 4.0, 0.0 } };
+
+        RandomValueGenerator random;
+        random.initialize(true, 0, 0);
+
+        auto samples = std::vector<std::shared_ptr<Models::Sample>>();
+        for (int i = 0; i < 3000; i++)
+        {
+            const std::vector<double>& center = expectedCenters[i % expectedCenters.size()];
+
+            auto s = std::make_shared<Models::Sample>(2);
+            s->Weight = 1.0;
+            for (int j = 0; j < 2; j++)
+            {
+                s->Values[j] = center[j] + 0.5 * Statistics::StandardNormal::getUFromP(random.next());
+            }
+            samples.push_back(s);
+        }
 
+        auto kmean = Optimization::KMeansClustering();
+        kmean.Settings->MaxClusters = 6;
+        kmean.Settings->OptimizeNumberOfClusters = true;
+        auto result = kmean.getClusterCenters(samples);
+
+        ASSERT_EQ(expectedCenters.size(), result.size());
+
+        std::sort(result.begin(), result.end(), [](const std::shared_ptr<Models::Sample>& a, const std::shared_ptr<Models::Sample>& b) { return a->Values[0] < b->Values[0]; });
+
+        for (size_t i = 0; i < expectedCenters.size(); i++)
+        {
+            EXPECT_NEAR(expectedCenters[i][0], result[i]->Values[0], 5 * margin);
+            EXPECT_NEAR(expectedCenters[i][1], result[i]->Values[1], 5 * margin);
+        }
+    }
+}
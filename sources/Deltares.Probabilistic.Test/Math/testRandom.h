@@ -32,6 +32,10 @@ namespace Deltares::Probabilistic::Test
         static void initializationTest();
         static void repetitiveTest();
         static void twoInstances();
+        static void philoxTest();
+        static void positionTest();
+        static void randomSampleGeneratorTest();
+        static void mersenneTwisterSampleTest();
     };
 }
 
@@ -22,6 +22,8 @@
 #include <gtest/gtest.h>
 #include "testRandom.h"
 #include "../../Deltares.Probabilistic/Math/RandomValueGenerator.h"
+#include "../../Deltares.Probabilistic/Model/RandomSampleGenerator.h"
+#include "../../Deltares.Probabilistic/Statistics/StandardNormal.h"
 
 namespace Deltares::Probabilistic::Test
 {
@@ -31,6 +33,10 @@ namespace Deltares::Probabilistic::Test
         initializationTest();
         repetitiveTest();
         twoInstances();
+        philoxTest();
+        positionTest();
+        randomSampleGeneratorTest();
+        mersenneTwisterSampleTest();
     }
 
     void testRandom::mersenneTwisterTest1()
@@ -115,5 +121,134 @@ namespace Deltares::Probabilistic::Test
         ASSERT_EQ(val1, val2);
     }
 
-}
+    void testRandom::philoxTest()
+    {
+        auto philox = Numeric::RandomValueGenerator();
+        philox.initialize(true, 0, 0, Numeric::RandomGeneratorType::Philox);
+
+        ASSERT_TRUE(philox.isRandomAccessible());
+
+        // known answer of Philox-4x32-10 with zero counter and key is 0x6627e8d5 0xe169c58d ...
+        ASSERT_EQ(philox.getValue(0), 0.3990464708489645);
+
+        double sum = 0.0;
+        for (size_t i = 0; i < 1000; i++)
+        {
+            const double value = philox.next();
+            ASSERT_EQ(value, philox.getValue(i));
+            ASSERT_TRUE(value >= 0.0 && value < 1.0);
+            sum += value;
+        }
+        ASSERT_NEAR(sum / 1000, 0.5, 0.05);
+
+        auto other = Numeric::RandomValueGenerator();
+        other.initialize(true, 1, 0, Numeric::RandomGeneratorType::Philox);
+        ASSERT_NE(philox.getValue(0), other.getValue(0));
+
+        auto mt = Numeric::RandomValueGenerator();
+        mt.initialize(true, 0);
+        ASSERT_FALSE(mt.isRandomAccessible());
+    }
+
+    void testRandom::positionTest()
+    {
+        for (Numeric::RandomGeneratorType generatorType : { Numeric::RandomGeneratorType::MersenneTwister, Numeric::RandomGeneratorType::Philox })
+        {
+            auto generator = Numeric::RandomValueGenerator();
+            generator.initialize(true, 3, 0, generatorType);
+
+            std::vector<double> values;
+            for (size_t i = 0; i < 100; i++)
+            {
+                values.push_back(generator.next());
+            }
+            ASSERT_EQ(generator.getPosition(), 100u);
+
+            generator.setPosition(37);
+            ASSERT_EQ(generator.next(), values[37]);
+
+            generator.setPosition(80);
+            ASSERT_EQ(generator.next(), values[80]);
+
+            generator.restart();
+            ASSERT_EQ(generator.next(), values[0]);
+        }
+    }
+
+    void testRandom::randomSampleGeneratorTest()
+    {
+        auto stochastSet = std::make_shared<Reliability::StochastSettingsSet>();
+        for (int i = 0; i < 3; i++)
+        {
+            auto stochastSettings = std::make_shared<Reliability::StochastSettings>();
+            stochastSettings->StochastIndex = i;
+            stochastSet->stochastSettings.push_back(stochastSettings);
+            stochastSet->VaryingStochastSettings.push_back(stochastSettings);
+        }
+
+        auto settings = std::make_shared<Models::RandomSettings>();
+        settings->GeneratorType = Numeric::RandomGeneratorType::Philox;
+
+        // samples in one chunk
+        auto generator = Models::RandomSampleGenerator(settings, stochastSet);
+        std::vector<std::shared_ptr<Models::Sample>> samples = generator.getRandomSamples(50);
+
+        // samples in smaller chunks
+        generator.restart();
+        std::vector<std::shared_ptr<Models::Sample>> chunkedSamples;
+        for (int chunk = 0; chunk < 5; chunk++)
+        {
+            for (const std::shared_ptr<Models::Sample>& sample : generator.getRandomSamples(10))
+            {
+                chunkedSamples.push_back(sample);
+            }
+        }
 
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            for (size_t j = 0; j < samples[i]->Values.size(); j++)
+            {
+                ASSERT_EQ(samples[i]->Values[j], chunkedSamples[i]->Values[j]);
+            }
+        }
+
+        // random access to a sample
+        std::shared_ptr<Models::Sample> sample = generator.getRandomSample(23);
+        std::shared_ptr<Models::Sample> nextSample = generator.getRandomSample();
+        for (size_t j = 0; j < sample->Values.size(); j++)
+        {
+            ASSERT_EQ(sample->Values[j], samples[23]->Values[j]);
+            ASSERT_EQ(nextSample->Values[j], samples[24]->Values[j]);
+        }
+    }
+
+    void testRandom::mersenneTwisterSampleTest()
+    {
+        auto stochastSet = std::make_shared<Reliability::StochastSettingsSet>();
+        for (int i = 0; i < 5; i++)
+        {
+            auto stochastSettings = std::make_shared<Reliability::StochastSettings>();
+            stochastSettings->StochastIndex = i;
+            stochastSet->stochastSettings.push_back(stochastSettings);
+            stochastSet->VaryingStochastSettings.push_back(stochastSettings);
+        }
+
+        auto settings = std::make_shared<Models::RandomSettings>();
+        settings->GeneratorType = Numeric::RandomGeneratorType::MersenneTwister;
+        settings->Seed = 7;
+
+        auto generator = Models::RandomSampleGenerator(settings, stochastSet);
+
+        auto random = Numeric::RandomValueGenerator();
+        random.initialize(settings->IsRepeatableRandom, settings->Seed, settings->getTimeStamp(), settings->GeneratorType);
+
+        // the Mersenne twister samples must be bit-identical to the scalar conversion of earlier releases
+        for (const std::shared_ptr<Models::Sample>& sample : generator.getRandomSamples(100))
+        {
+            for (size_t j = 0; j < sample->Values.size(); j++)
+            {
+                ASSERT_EQ(sample->Values[j], Statistics::StandardNormal::getUFromQ(random.next()));
+            }
+        }
+    }
+}
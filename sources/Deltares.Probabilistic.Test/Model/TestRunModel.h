@@ -36,6 +36,19 @@ namespace Deltares::Probabilistic::Test
         void testRunModelArraysVariable() const;
         void testRunModelVariableSourceIsNotVarying() const;
         void testRunModelVariableWithArrayVariables() const;
+        void testRunModelBatch() const;
+        void testRunModelBatchCallBack() const;
+        void testRunModelVectorizedCallBack() const;
+        void testRunModelShortBatchRows() const;
+        void testRunModelSlowBatch() const;
+        void testSampleRepository() const;
+        void testPersistentSampleRepository() const;
+        void testEvaluationStore() const;
+
+        static void linearCallBack(const double* data, int size, double* outputValues);
+        static void linearBatchCallBack(int count, const double* data, int size, double* outputValues, int outputSize);
+
+        static inline int batchInvocations = 0;
 
         const double margin = 0.02;
     };
@@ -24,6 +24,16 @@
 #include "../projectBuilder.h"
 
 #include "../../Deltares.Probabilistic/Model/RunProject.h"
+#include "../../Deltares.Probabilistic/Model/SampleBatch.h"
+#include "../../Deltares.Probabilistic/Model/DefaultValueConverter.h"
+#include "../../Deltares.Probabilistic/Model/SampleRepository.h"
+#include "../../Deltares.Probabilistic/Model/PersistentSampleRepository.h"
+#include "../../Deltares.Probabilistic/Model/EvaluationList.h"
+#include "../../Deltares.Probabilistic/Utils/probLibException.h"
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
 
 namespace Deltares::Probabilistic::Test
 {
@@ -36,6 +46,14 @@ namespace Deltares::Probabilistic::Test
         testRunModelArraysVariable();
         testRunModelVariableSourceIsNotVarying();
         testRunModelVariableWithArrayVariables();
+        testRunModelBatch();
+        testRunModelBatchCallBack();
+        testRunModelVectorizedCallBack();
+        testRunModelShortBatchRows();
+        testRunModelSlowBatch();
+        testSampleRepository();
+        testPersistentSampleRepository();
+        testEvaluationStore();
     }
 
     void TestRunModel::testRunModelMedianValues() const
@@ -218,6 +236,495 @@ namespace Deltares::Probabilistic::Test
         ASSERT_TRUE(project->isValid());
     }
 
-}
+    void TestRunModel::testRunModelBatch() const
+    {
+        std::shared_ptr<Models::ModelRunner> modelRunner = projectBuilder::BuildLinearProject();
+        modelRunner->initializeForRun();
+
+        std::vector<std::shared_ptr<Models::Sample>> samples;
+        samples.push_back(std::make_shared<Models::Sample>(std::vector<double>{ 0.0, 0.0 }));
+        samples.push_back(std::make_shared<Models::Sample>(std::vector<double>{ 1.0, -0.5 }));
+        samples.push_back(std::make_shared<Models::Sample>(std::vector<double>{ 2.0, 1.5 }));
+
+        Models::SampleBatch batch = Models::SampleBatch::fromSamples(samples);
+
+        ASSERT_EQ(3, batch.getSize());
+        ASSERT_EQ(2, batch.getSampleSize());
+
+        std::vector<double> zValues = modelRunner->getZValues(batch);
+
+        ASSERT_EQ(3, zValues.size());
+        ASSERT_EQ(2, batch.getInputSize());
 
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            const int index = static_cast<int>(i);
+            ASSERT_NEAR(samples[i]->getBeta(), batch.Beta[i], 1E-10);
+            ASSERT_NEAR(modelRunner->getZValue(samples[i]), zValues[i], 1E-10);
+            ASSERT_NEAR(1.8 - batch.getXValues(index)[0] - batch.getXValues(index)[1], zValues[i], 1E-10);
+        }
+
+        // the adapter for samples should give the same result
+        std::vector<double> zSampleValues = modelRunner->getZValues(samples);
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            ASSERT_NEAR(zValues[i], zSampleValues[i], 1E-10);
+            ASSERT_NEAR(zValues[i], samples[i]->Z, 1E-10);
+        }
+
+        // samples with different numbers of values do not form a batch
+        samples.push_back(std::make_shared<Models::Sample>(std::vector<double>{ 1.0 }));
+        ASSERT_THROW(Models::SampleBatch::fromSamples(samples), Reliability::probLibException);
+    }
+
+    void TestRunModel::testRunModelBatchCallBack() const
+    {
+        auto zModel = std::make_shared<Models::ZModel>(linearCallBack);
+        zModel->zValueConverter = std::make_shared<Models::DefaultValueConverter>();
+        zModel->inputParameters.push_back(std::make_shared<Models::ModelInputParameter>());
+        zModel->inputParameters.push_back(std::make_shared<Models::ModelInputParameter>());
+        zModel->outputParameters.push_back(std::make_shared<Models::ModelInputParameter>());
+
+        std::vector<std::shared_ptr<Statistics::Stochast>> stochasts;
+        stochasts.push_back(projectBuilder::getNormalStochast(1, 0.5));
+        stochasts.push_back(projectBuilder::getNormalStochast(-1, 2));
+
+        auto correlationMatrix = std::make_shared<Statistics::CorrelationMatrix>(true);
+        auto uConverter = std::make_shared<Models::UConverter>(stochasts, correlationMatrix);
+        uConverter->initializeForRun();
+
+        auto modelRunner = std::make_shared<Models::ModelRunner>(zModel, uConverter);
+        modelRunner->Settings->SaveEvaluations = true;
+        modelRunner->initializeForRun();
+
+        Models::SampleBatch batch(4, 2);
+        for (int i = 0; i < batch.getSize(); i++)
+        {
+            batch.getValues(i)[0] = 0.5 * i;
+            batch.getValues(i)[1] = -0.25 * i;
+            batch.IterationIndex[i] = i;
+        }
+
+        std::vector<double> zValues = modelRunner->getZValues(batch);
+
+        ASSERT_EQ(1, batch.getOutputSize());
+
+        for (int i = 0; i < batch.getSize(); i++)
+        {
+            double x0 = stochasts[0]->getXFromU(0.5 * i);
+            double x1 = stochasts[1]->getXFromU(-0.25 * i);
+
+            ASSERT_NEAR(x0, batch.getXValues(i)[0], 1E-10);
+            ASSERT_NEAR(x1, batch.getXValues(i)[1], 1E-10);
+            ASSERT_NEAR(1.8 - x0 - x1, zValues[i], 1E-10);
+        }
+
+        Uncertainty::UncertaintyResult result = modelRunner->getUncertaintyResult(nullptr);
+
+        ASSERT_EQ(4, result.evaluations.size());
+        for (int i = 0; i < batch.getSize(); i++)
+        {
+            ASSERT_EQ(i, result.evaluations[i]->Iteration);
+            ASSERT_NEAR(zValues[i], result.evaluations[i]->Z, 1E-10);
+            ASSERT_NEAR(zValues[i], result.evaluations[i]->OutputValues[0], 1E-10);
+        }
+    }
+
+    void TestRunModel::testRunModelVectorizedCallBack() const
+    {
+        auto zModel = std::make_shared<Models::ZModel>(linearCallBack);
+        zModel->setBatchCallback(linearBatchCallBack);
+        zModel->zValueConverter = std::make_shared<Models::DefaultValueConverter>();
+        zModel->inputParameters.push_back(std::make_shared<Models::ModelInputParameter>());
+        zModel->inputParameters.push_back(std::make_shared<Models::ModelInputParameter>());
+        zModel->outputParameters.push_back(std::make_shared<Models::ModelInputParameter>());
+
+        std::vector<std::shared_ptr<Statistics::Stochast>> stochasts;
+        stochasts.push_back(projectBuilder::getNormalStochast(1, 0.5));
+        stochasts.push_back(projectBuilder::getNormalStochast(-1, 2));
+
+        auto correlationMatrix = std::make_shared<Statistics::CorrelationMatrix>(true);
+        auto uConverter = std::make_shared<Models::UConverter>(stochasts, correlationMatrix);
+        uConverter->initializeForRun();
+
+        auto modelRunner = std::make_shared<Models::ModelRunner>(zModel, uConverter);
+        modelRunner->initializeForRun();
+
+        Models::SampleBatch batch(100, 2);
+        for (int i = 0; i < batch.getSize(); i++)
+        {
+            batch.getValues(i)[0] = 0.01 * i;
+            batch.getValues(i)[1] = -0.02 * i;
+            batch.IterationIndex[i] = i;
+        }
+
+        batchInvocations = 0;
+        std::vector<double> zValues = modelRunner->getZValues(batch);
+
+        // the whole batch is passed in one invocation
+        ASSERT_EQ(1, batchInvocations);
+
+        for (int i = 0; i < batch.getSize(); i++)
+        {
+            double x0 = stochasts[0]->getXFromU(0.01 * i);
+            double x1 = stochasts[1]->getXFromU(-0.02 * i);
+
+            ASSERT_NEAR(1.8 - x0 - x1, zValues[i], 1E-10);
+            ASSERT_NEAR(1.8 - x0 - x1, batch.getOutputValues(i)[0], 1E-10);
+        }
+
+        // samples which are not in a batch are packed into one block
+        std::vector<std::shared_ptr<Models::ModelSample>> samples;
+        samples.push_back(std::make_shared<Models::ModelSample>(std::vector{ 1.0, 2.0 }));
+        samples.push_back(std::make_shared<Models::ModelSample>(std::vector{ -1.0, 0.5 }));
+        samples.push_back(std::make_shared<Models::ModelSample>(std::vector{ 0.25, 0.25 }));
+
+        batchInvocations = 0;
+        zModel->invoke(samples);
+
+        ASSERT_EQ(1, batchInvocations);
+        ASSERT_NEAR(-1.2, samples[0]->Z, 1E-10);
+        ASSERT_NEAR(2.3, samples[1]->Z, 1E-10);
+        ASSERT_NEAR(1.3, samples[2]->Z, 1E-10);
+    }
+
+    void TestRunModel::testRunModelShortBatchRows() const
+    {
+        std::vector<std::shared_ptr<Statistics::Stochast>> stochasts;
+        stochasts.push_back(projectBuilder::getNormalStochast(1, 0.5));
+        stochasts.push_back(projectBuilder::getNormalStochast(-1, 2));
+
+        auto correlationMatrix = std::make_shared<Statistics::CorrelationMatrix>(true);
+        auto uConverter = std::make_shared<Models::UConverter>(stochasts, correlationMatrix);
+        uConverter->initializeForRun();
+
+        // rows with fewer u-values than varying stochasts can not be converted
+        Models::SampleBatch batch(3, 1);
+        ASSERT_THROW(uConverter->getXValues(batch), Reliability::probLibException);
+
+        Models::SampleBatch fullBatch(3, 2);
+        uConverter->getXValues(fullBatch);
+        ASSERT_NEAR(1.0, fullBatch.getXValues(2)[0], 1E-10);
+        ASSERT_NEAR(-1.0, fullBatch.getXValues(2)[1], 1E-10);
+    }
+
+    void TestRunModel::linearBatchCallBack(int count, const double* data, int size, double* outputValues, int outputSize)
+    {
+        batchInvocations++;
+        for (int i = 0; i < count; i++)
+        {
+            linearCallBack(data + static_cast<size_t>(i) * size, size, outputValues + static_cast<size_t>(i) * outputSize);
+        }
+    }
+
+    void TestRunModel::linearCallBack(const double* data, int size, double* outputValues)
+    {
+        outputValues[0] = 1.8;
+        for (int i = 0; i < size; i++)
+        {
+            outputValues[0] -= data[i];
+        }
+    }
 
+    void TestRunModel::testRunModelSlowBatch() const
+    {
+        auto zModel = std::make_shared<Models::ZModel>(linearCallBack);
+        zModel->zValueConverter = std::make_shared<Models::DefaultValueConverter>();
+        zModel->inputParameters.push_back(std::make_shared<Models::ModelInputParameter>());
+        zModel->inputParameters.push_back(std::make_shared<Models::ModelInputParameter>());
+        zModel->outputParameters.push_back(std::make_shared<Models::ModelInputParameter>());
+
+        // a slow calculation switches on the sample repository
+        zModel->setBatchLambda([](Models::SampleBatch& batch)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5 * batch.getSize()));
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                linearCallBack(batch.getXValues(i), batch.getInputSize(), batch.getOutputValues(i));
+            }
+        });
+
+        std::vector<std::shared_ptr<Statistics::Stochast>> stochasts;
+        stochasts.push_back(projectBuilder::getNormalStochast(1, 0.5));
+        stochasts.push_back(projectBuilder::getNormalStochast(-1, 2));
+
+        auto uConverter = std::make_shared<Models::UConverter>(stochasts, std::make_shared<Statistics::CorrelationMatrix>(true));
+        uConverter->initializeForRun();
+
+        auto modelRunner = std::make_shared<Models::ModelRunner>(zModel, uConverter);
+        modelRunner->initializeForRun();
+
+        auto getBatch = []()
+        {
+            Models::SampleBatch batch(4, 2);
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                batch.getValues(i)[0] = 0.5 * i;
+                batch.getValues(i)[1] = -0.25 * i;
+            }
+            return batch;
+        };
+
+        Models::SampleBatch batch = getBatch();
+        std::vector<double> zValues = modelRunner->getZValues(batch);
+        ASSERT_EQ(4, zModel->getModelRuns());
+
+        // the samples of the batch which switched on the repository are reused
+        Models::SampleBatch sameBatch = getBatch();
+        std::vector<double> sameZValues = modelRunner->getZValues(sameBatch);
+        ASSERT_EQ(4, zModel->getModelRuns());
+        ASSERT_EQ(4, zModel->getRepositoryHits());
+
+        for (int i = 0; i < batch.getSize(); i++)
+        {
+            ASSERT_EQ(zValues[i], sameZValues[i]);
+        }
+    }
+
+    void TestRunModel::testSampleRepository() const
+    {
+        Models::SampleRepository repository;
+        repository.setMaxSize(160);
+
+        // retrieval from an empty repository is not counted
+        auto first = std::make_shared<Models::ModelSample>(std::vector{ 0.0, 1.0 });
+        ASSERT_EQ(repository.retrieveSample(first), nullptr);
+        ASSERT_EQ(repository.getMisses(), 0);
+
+        first->Z = 5.0;
+        repository.registerSample(first);
+        ASSERT_EQ(repository.getSize(), 1);
+
+        // equal values, 0 and -0 are equal
+        auto same = std::make_shared<Models::ModelSample>(std::vector{ -0.0, 1.0 });
+        std::shared_ptr<Models::ModelSample> retrieved = repository.retrieveSample(same);
+        ASSERT_NE(retrieved, nullptr);
+        ASSERT_EQ(retrieved->Z, 5.0);
+        ASSERT_EQ(repository.getHits(), 1);
+
+        auto other = std::make_shared<Models::ModelSample>(std::vector{ 0.0, 1.0 + 1e-15 });
+        ASSERT_EQ(repository.retrieveSample(other), nullptr);
+        ASSERT_EQ(repository.getMisses(), 1);
+
+        // samples with nan values are not registered
+        repository.registerSample(std::make_shared<Models::ModelSample>(std::vector{ std::nan(""), 1.0 }));
+        ASSERT_EQ(repository.getSize(), 1);
+
+        // least recently used samples are removed when the maximum size is exceeded
+        for (int i = 0; i < 1000; i++)
+        {
+            repository.registerSample(std::make_shared<Models::ModelSample>(std::vector{ static_cast<double>(i), 2.0 }));
+            ASSERT_NE(repository.retrieveSample(first), nullptr);
+        }
+
+        ASSERT_LE(repository.getSize(), 160);
+        ASSERT_GE(repository.getSize(), 100);
+        ASSERT_NE(repository.retrieveSample(std::make_shared<Models::ModelSample>(std::vector{ 999.0, 2.0 })), nullptr);
+        ASSERT_EQ(repository.retrieveSample(std::make_shared<Models::ModelSample>(std::vector{ 0.0, 2.0 })), nullptr);
+
+        repository.clear();
+        ASSERT_EQ(repository.getSize(), 0);
+        ASSERT_TRUE(repository.isEmpty());
+    }
+
+    void TestRunModel::testPersistentSampleRepository() const
+    {
+        const std::string fileName = (std::filesystem::temp_directory_path() / "testPersistentSampleRepository.cache").string();
+        std::filesystem::remove(fileName);
+
+        int runs = 0;
+        auto lambda = [&runs](std::shared_ptr<Models::ModelSample> sample)
+        {
+            runs++;
+            sample->Z = sample->Values[0] + sample->Values[1];
+            sample->OutputValues = { 2.0 * sample->Values[0] };
+        };
+
+        auto model = std::make_shared<Models::ZModel>(lambda);
+        model->setCacheFile(fileName, "version 1");
+
+        auto sample = std::make_shared<Models::ModelSample>(std::vector{ 1.0, 2.0 });
+        model->invoke(sample);
+        ASSERT_EQ(runs, 1);
+        ASSERT_EQ(model->getCacheHits(), 0);
+
+        // another model, as in another run or process, reuses the stored result
+        auto otherModel = std::make_shared<Models::ZModel>(lambda);
+        otherModel->setCacheFile(fileName, "version 1");
+
+        auto sameSample = std::make_shared<Models::ModelSample>(std::vector{ 1.0, 2.0 });
+        otherModel->invoke(sameSample);
+        ASSERT_EQ(runs, 1);
+        ASSERT_EQ(otherModel->getCacheHits(), 1);
+        ASSERT_EQ(sameSample->Z, 3.0);
+        ASSERT_EQ(sameSample->OutputValues, std::vector{ 2.0 });
+
+        // results calculated by the other model are read by the first model
+        auto otherSample = std::make_shared<Models::ModelSample>(std::vector{ 3.0, 4.0 });
+        otherModel->invoke(std::vector{ otherSample });
+        ASSERT_EQ(runs, 2);
+
+        auto sameOtherSample = std::make_shared<Models::ModelSample>(std::vector{ 3.0, 4.0 });
+        model->invoke(sameOtherSample);
+        ASSERT_EQ(runs, 2);
+        ASSERT_EQ(sameOtherSample->Z, 7.0);
+
+        // results stored with another tag are not reused
+        auto changedModel = std::make_shared<Models::ZModel>(lambda);
+        changedModel->setCacheFile(fileName, "version 2");
+        changedModel->invoke(std::make_shared<Models::ModelSample>(std::vector{ 1.0, 2.0 }));
+        ASSERT_EQ(runs, 3);
+
+        std::filesystem::remove(fileName);
+        std::filesystem::remove(fileName + ".lock");
+
+        // models which only provide output values are cached with the converted z-value, for single samples, lists and streams
+        auto outputLambda = [&runs](std::shared_ptr<Models::ModelSample> sample)
+        {
+            runs++;
+            sample->OutputValues = { sample->Values[0] - sample->Values[1] };
+        };
+
+        auto outputModel = std::make_shared<Models::ZModel>(outputLambda);
+        outputModel->zValueConverter = std::make_shared<Models::DefaultValueConverter>();
+        outputModel->setCacheFile(fileName, "output");
+        outputModel->setMaxProcesses(2);
+
+        outputModel->invoke(std::make_shared<Models::ModelSample>(std::vector{ 5.0, 1.0 }));
+        outputModel->invoke(std::vector{ std::make_shared<Models::ModelSample>(std::vector{ 6.0, 1.0 }) });
+
+        auto streamedSample = std::make_shared<Models::ModelSample>(std::vector{ 7.0, 1.0 });
+        ASSERT_TRUE(outputModel->canInvokeStreamed());
+        bool provided = false;
+        outputModel->invokeStreamed(
+            [&provided, &streamedSample]() -> std::shared_ptr<Models::ModelSample>
+            {
+                if (provided)
+                {
+                    return nullptr;
+                }
+                provided = true;
+                return streamedSample;
+            },
+            [](const std::shared_ptr<Models::ModelSample>&) { return true; });
+        ASSERT_EQ(runs, 6);
+
+        auto otherOutputModel = std::make_shared<Models::ZModel>(outputLambda);
+        otherOutputModel->zValueConverter = std::make_shared<Models::DefaultValueConverter>();
+        otherOutputModel->setCacheFile(fileName, "output");
+
+        for (double value : { 5.0, 6.0, 7.0 })
+        {
+            auto cachedSample = std::make_shared<Models::ModelSample>(std::vector{ value, 1.0 });
+            otherOutputModel->invoke(cachedSample);
+            ASSERT_EQ(cachedSample->Z, value - 1.0);
+        }
+
+        ASSERT_EQ(runs, 6);
+        ASSERT_EQ(otherOutputModel->getCacheHits(), 3);
+
+        std::filesystem::remove(fileName);
+        std::filesystem::remove(fileName + ".lock");
+
+        // an existing file with another format is not overwritten
+        {
+            std::ofstream file(fileName);
+            file << "no cache file";
+        }
+
+        ASSERT_THROW(Models::PersistentSampleRepository(fileName, 0), Reliability::probLibException);
+
+        std::filesystem::remove(fileName);
+        std::filesystem::remove(fileName + ".lock");
+    }
+
+    void TestRunModel::testEvaluationStore() const
+    {
+        constexpr int nSamples = 5000;
+
+        // spill everything to file, evaluations are added by several threads
+        auto store = std::make_shared<Models::EvaluationStore>(1);
+
+#pragma omp parallel for num_threads(4)
+        for (int i = 0; i < nSamples; i++)
+        {
+            Models::ModelSample sample(std::vector{ static_cast<double>(i), 2.0 * i });
+            sample.Z = 3.0 * i;
+            sample.OutputValues = { 4.0 * i };
+            sample.IterationIndex = i;
+            sample.Tag = -i;
+            sample.UsedProxy = i % 2 == 0;
+            store->add(sample);
+        }
+
+        // an evaluation with another number of input values
+        Models::Evaluation evaluation;
+        evaluation.Z = 1.5;
+        evaluation.InputValues = { 1.0, 2.0, 3.0 };
+        evaluation.Iteration = nSamples;
+        store->add(evaluation);
+
+        // blocks of the threads which are not full are only counted after flushing
+        ASSERT_LT(store->size(), nSamples + 1);
+        store->flush();
+
+        ASSERT_EQ(nSamples + 1, store->size());
+        ASSERT_TRUE(store->isSpilled());
+
+        std::vector<bool> found(nSamples, false);
+        for (int i = 0; i < nSamples + 1; i++)
+        {
+            std::shared_ptr<Models::Evaluation> stored = store->getEvaluation(i);
+            const int iteration = stored->Iteration;
+
+            if (iteration == nSamples)
+            {
+                ASSERT_EQ(std::vector({ 1.0, 2.0, 3.0 }), stored->InputValues);
+                ASSERT_TRUE(stored->OutputValues.empty());
+                ASSERT_EQ(1.5, stored->Z);
+                continue;
+            }
+
+            ASSERT_FALSE(found[iteration]);
+            found[iteration] = true;
+
+            ASSERT_EQ(std::vector({ 1.0 * iteration, 2.0 * iteration }), stored->InputValues);
+            ASSERT_EQ(std::vector({ 4.0 * iteration }), stored->OutputValues);
+            ASSERT_EQ(3.0 * iteration, stored->Z);
+            ASSERT_EQ(-iteration, stored->Tag);
+            ASSERT_EQ(iteration % 2 == 0, stored->usedProxy);
+        }
+
+        // the list is a view, which keeps the order of added evaluations in a single thread
+        auto memoryStore = std::make_shared<Models::EvaluationStore>();
+        for (int i = 0; i < 10; i++)
+        {
+            Models::Evaluation memoryEvaluation;
+            memoryEvaluation.Iteration = i;
+            memoryStore->add(memoryEvaluation);
+        }
+        memoryStore->flush();
+
+        Models::EvaluationList list;
+        list.append(memoryStore);
+        list.push_back(std::make_shared<Models::Evaluation>(evaluation));
+
+        Models::EvaluationList otherList;
+        otherList.append(list);
+        otherList.append(store);
+
+        ASSERT_EQ(11, list.size());
+        ASSERT_EQ(nSamples + 12, otherList.size());
+        ASSERT_FALSE(memoryStore->isSpilled());
+
+        int index = 0;
+        for (const auto& listEvaluation : list)
+        {
+            ASSERT_EQ(index < 10 ? index : nSamples, listEvaluation->Iteration);
+            index++;
+        }
+
+        ASSERT_EQ(3, list[3]->Iteration);
+        ASSERT_EQ(nSamples, otherList[10]->Iteration);
+    }
+}
@@ -0,0 +1,107 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include <gtest/gtest.h>
+#include "testGridSearch.h"
+#include "../../Deltares.Probabilistic/Optimization/GridSearch.h"
+
+using namespace Deltares::Optimization;
+
+namespace Deltares::Probabilistic::Test
+{
+    static std::shared_ptr<SearchParameterSettingsSet> getSearchArea(int numberOfRefinements)
+    {
+        auto searchArea = std::make_shared<SearchParameterSettingsSet>();
+        for (int i = 0; i < 2; i++)
+        {
+            auto dimension = std::make_shared<SearchParameterSettings>();
+            dimension->MinValue = -2;
+            dimension->MaxValue = 2;
+            dimension->NumberOfValues = 5;
+            dimension->NumberOfRefinements = numberOfRefinements;
+            searchArea->Dimensions.push_back(dimension);
+        }
+
+        return searchArea;
+    }
+
+    static std::shared_ptr<Models::ZModel> getQuadraticModel()
+    {
+        return std::make_shared<Models::ZModel>([](const std::shared_ptr<Models::ModelSample>& sample)
+        {
+            const double x = sample->Values[0] - 1.3;
+            const double y = sample->Values[1] + 0.4;
+            sample->Z = x * x + 2 * y * y + 0.5 * x * y;
+        });
+    }
+
+    void testGridSearch::testNelderMeadRefinement()
+    {
+        const auto model = getQuadraticModel();
+
+        // start at the grid point nearest to the minimum, the grid interval is 1
+        auto start = std::make_shared<Models::ModelSample>(std::vector{ 1.0, 0.0 });
+        model->invoke(start);
+
+        auto gridSearch = GridSearch();
+        const std::shared_ptr<Models::ModelSample> result = gridSearch.refineByNelderMead(getSearchArea(10), model, start);
+
+        // the simplex converges to the resolution of ten grid refinements
+        EXPECT_NEAR(1.3, result->Values[0], 1e-2);
+        EXPECT_NEAR(-0.4, result->Values[1], 1e-2);
+        EXPECT_LT(result->Z, 1e-4);
+        EXPECT_LT(result->Z, start->Z);
+    }
+
+    void testGridSearch::testNelderMeadWithoutRefinements()
+    {
+        const auto model = getQuadraticModel();
+
+        auto start = std::make_shared<Models::ModelSample>(std::vector{ 1.0, 0.0 });
+        model->invoke(start);
+
+        // without refinements the grid minimum is the result
+        auto gridSearch = GridSearch();
+        EXPECT_EQ(start, gridSearch.refineByNelderMead(getSearchArea(0), model, start));
+    }
+
+    void testGridSearch::testNelderMeadInvalidValues()
+    {
+        // the minimum is located at the boundary of the valid region
+        const auto model = std::make_shared<Models::ZModel>([](const std::shared_ptr<Models::ModelSample>& sample)
+        {
+            const double x = sample->Values[0] - 1.3;
+            const double y = sample->Values[1] + 0.4;
+            sample->Z = sample->Values[0] > 1.1 ? std::nan("") : x * x + y * y;
+        });
+
+        auto start = std::make_shared<Models::ModelSample>(std::vector{ 1.0, 0.0 });
+        model->invoke(start);
+
+        auto gridSearch = GridSearch();
+        const std::shared_ptr<Models::ModelSample> result = gridSearch.refineByNelderMead(getSearchArea(10), model, start);
+
+        EXPECT_FALSE(std::isnan(result->Z));
+        EXPECT_LE(result->Values[0], 1.1);
+        EXPECT_NEAR(-0.4, result->Values[1], 1e-2);
+        EXPECT_LE(result->Z, start->Z);
+    }
+}
@@ -31,23 +31,35 @@ namespace Deltares::Probabilistic::Test
         static void testFORM();
         static void testFORMArray();
         static void testFORMVaryingArray();
+        static void testFORMQuasiNewton();
         static void testValidation();
         static void testLatinHyperCube();
         static void testNumericalBisection();
         static void testNumericalBisectionLinear();
+        static void testIntegrationDomain();
         static void testCobylaReliability();
         static void testSubSetSimulationReliabilityNearestToMean();
         static void testSubSetSimulationReliabilityCenterOfGravity();
+        static void testSubSetSimulationParallelChains();
+        static void testSubSetSimulationSamplers();
+        static void testSubSetSimulationDelayedRejection();
         static void testFDIRReliability();
         static void testDSFIReliability();
         static void testFragilityCurveIntegration();
         static void testNumericalIntegrationReliability();
+        static void testNumericalIntegrationAdaptiveGrid();
         static void testCrudeMonteCarloReliability();
         static void testCrudeMonteCarloWithCopulaReliability();
         static void testCrudeMonteCarloWithQualitativeProject();
+        static void testCrudeMonteCarloChunks();
+        static void testDesignPointBuilderBlocks();
+        static void testCrudeMonteCarloStreamed();
         static void testAdaptiveImportanceSampling();
+        static void testImportanceSamplingChunks();
         static void testClustersAdpImpSampling();
+        static void testClustersProportionalAllocation();
         static void testDirSamplingProxyModels(const bool useProxy,
             const Reliability::ModelVaryingType varyingType, const double dsdu);
+        static void testDirSamplingPerThread();
     };
 }
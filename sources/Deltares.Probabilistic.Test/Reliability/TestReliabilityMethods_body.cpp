@@ -24,12 +24,17 @@
 #include "TestReliabilityMethods.h"
 #include "../../Deltares.Probabilistic/Reliability/LatinHyperCube.h"
 #include "../../Deltares.Probabilistic/Reliability/NumericalBisection.h"
+#include "../../Deltares.Probabilistic/Reliability/ImportanceSampling.h"
 #include "../../Deltares.Probabilistic/Reliability/CobylaReliability.h"
 #include "../../Deltares.Probabilistic/Reliability/SubsetSimulation.h"
+#include "../../Deltares.Probabilistic/Reliability/CrankNicolsonSampler.h"
+#include "../../Deltares.Probabilistic/Reliability/DelayedRejectionSampler.h"
+#include "../../Deltares.Probabilistic/Reliability/HamiltonianSampler.h"
 #include "../../Deltares.Probabilistic/Reliability/FORMThenDirectionalSampling.h"
 #include "../../Deltares.Probabilistic/Reliability/DirectionalSamplingThenFORM.h"
 #include "../../Deltares.Probabilistic/Reliability/FragilityCurveIntegration.h"
 #include "../../Deltares.Probabilistic/Reliability/NumericalIntegration.h"
+#include "../../Deltares.Probabilistic/Reliability/DesignPointBuilder.h"
 #include "../../Deltares.Probabilistic/Math/NumericSupport.h"
 #include "../projectBuilder.h"
 
@@ -73,6 +78,23 @@ namespace Deltares::Probabilistic::Test
         EXPECT_NEAR(designPoint->Alphas[5]->X, 0.18, 1e-2);
     }
 
+    void TestReliabilityMethods::testFORMQuasiNewton()
+    {
+        auto calculatorFull = FORM();
+        auto modelRunnerFull = projectBuilder().BuildProject();
+        auto designPointFull = calculatorFull.getDesignPoint(modelRunnerFull);
+
+        auto calculator = FORM();
+        calculator.Settings->GradientSettings->FullGradientInterval = 3;
+        calculator.Settings->GradientSettings->AdaptiveStepSize = true;
+        auto modelRunner = projectBuilder().BuildProject();
+        auto designPoint = calculator.getDesignPoint(modelRunner);
+
+        EXPECT_TRUE(designPoint->convergenceReport->IsConverged);
+        EXPECT_NEAR(designPoint->Beta, designPointFull->Beta, 1e-2);
+        EXPECT_LE(designPoint->convergenceReport->TotalModelRuns, designPointFull->convergenceReport->TotalModelRuns);
+    }
+
     void TestReliabilityMethods::testFORMVaryingArray()
     {
         auto calculator = FORM();
@@ -146,7 +168,13 @@ namespace Deltares::Probabilistic::Test
     {
         constexpr double margin = 1e-9;
         auto calculator = NumericalBisection();
+
+        // the integration lattice does not support more bisection levels
+        calculator.Settings->MaximumIterations = 53;
+        EXPECT_FALSE(calculator.Settings->isValid());
+
         calculator.Settings->MaximumIterations = 20;
+        EXPECT_TRUE(calculator.Settings->isValid());
         calculator.Settings->designPointMethod = DesignPointMethod::NearestToMean;
 
         auto modelRunner = projectBuilder().BuildProject();
@@ -177,6 +205,53 @@ namespace Deltares::Probabilistic::Test
         EXPECT_NEAR(designPoint->Alphas[1]->X, 0.931459, 1e-4);
     }
 
+    void TestReliabilityMethods::testIntegrationDomain()
+    {
+        auto domain = IntegrationDomain({ 0.0, 0.0 });
+        domain.Cells.push_back(std::make_shared<IntegrationCell>(domain, std::vector<double>(2, -8.0), std::vector<double>(2, 8.0)));
+        ASSERT_EQ(domain.Points.size(), 4);
+
+        // the split point and the midpoints of the edges are added, corner points are shared by the cells
+        domain.Cells[0]->splitAtOrigin();
+        ASSERT_EQ(domain.Cells.size(), 4);
+        ASSERT_EQ(domain.Points.size(), 9);
+
+        auto cell = domain.Cells[0];
+        auto center = cell->getCenterPoint();
+        EXPECT_NEAR(center->Coordinates[0], -4.0, 1e-10);
+        EXPECT_NEAR(center->Coordinates[1], -4.0, 1e-10);
+
+        cell->split();
+        ASSERT_EQ(domain.Cells.size(), 7);
+        ASSERT_EQ(domain.Points.size(), 14);
+
+        // retrieving an existing point does not add a new one
+        ASSERT_EQ(domain.Cells[0]->getCenterPoint(), domain.Cells[0]->getCenterPoint());
+        ASSERT_EQ(domain.Points.size(), 15);
+
+        // lines along the first dimension, at u2 = -8, -6, -4, 0 and 8
+        ASSERT_EQ(domain.Lines[0].size(), 5);
+
+        auto findPoint = [&domain](double u1, double u2)
+        {
+            for (const auto& point : domain.Points)
+            {
+                if (point->Coordinates[0] == u1 && point->Coordinates[1] == u2) return point.get();
+            }
+            return static_cast<IntegrationPoint*>(nullptr);
+        };
+
+        // the points on a line are sorted
+        std::vector<double> expected = { -8.0, -4.0, 0.0, 8.0 };
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            auto point = findPoint(expected[i], -8.0);
+            ASSERT_NE(point, nullptr);
+            EXPECT_EQ(point->Lines[0]->get_index(point), i);
+            EXPECT_EQ(point->Lines[0]->GetSide(point), i < 2 ? -1 : (i == 2 ? 0 : 1));
+        }
+    }
+
     void TestReliabilityMethods::testCobylaReliability()
     {
         auto calculator = CobylaReliability();
@@ -226,6 +301,82 @@ namespace Deltares::Probabilistic::Test
         EXPECT_FALSE(designPoint->convergenceReport->IsConverged);
     }
 
+    void TestReliabilityMethods::testSubSetSimulationParallelChains()
+    {
+        for (SampleMethodType sampleMethod : { MarkovChain, AdaptiveConditional })
+        {
+            std::vector<std::shared_ptr<DesignPoint>> designPoints;
+
+            // the design point should not depend on the number of processes
+            for (int processes : { 1, 4 })
+            {
+                auto calculator = SubsetSimulation();
+                calculator.Settings->SampleMethod = sampleMethod;
+                calculator.Settings->ParallelChains = true;
+
+                auto modelRunner = projectBuilder().BuildProject();
+                modelRunner->Settings->MaxParallelProcesses = processes;
+                modelRunner->initializeForRun();
+
+                designPoints.push_back(calculator.getDesignPoint(modelRunner));
+            }
+
+            ASSERT_EQ(designPoints[0]->Alphas.size(), 2);
+            EXPECT_NEAR(designPoints[0]->Beta, 1.88, 0.1);
+            EXPECT_NEAR(designPoints[1]->Beta, designPoints[0]->Beta, 1e-10);
+            for (size_t j = 0; j < designPoints[0]->Alphas.size(); j++)
+            {
+                EXPECT_NEAR(designPoints[1]->Alphas[j]->Alpha, designPoints[0]->Alphas[j]->Alpha, 1e-10);
+            }
+        }
+    }
+
+    void TestReliabilityMethods::testSubSetSimulationSamplers()
+    {
+        std::vector<std::shared_ptr<SubsetSimulationSampler>> samplers =
+        {
+            std::make_shared<DelayedRejectionSampler>(),
+            std::make_shared<CrankNicolsonSampler>(),
+            std::make_shared<HamiltonianSampler>()
+        };
+
+        for (const std::shared_ptr<SubsetSimulationSampler>& sampler : samplers)
+        {
+            auto calculator = SubsetSimulation();
+            calculator.Settings->Sampler = sampler;
+
+            auto modelRunner = projectBuilder().BuildProject();
+
+            auto designPoint = calculator.getDesignPoint(modelRunner);
+
+            ASSERT_EQ(designPoint->Alphas.size(), 2);
+            EXPECT_NEAR(designPoint->Beta, 1.88, 0.1);
+            EXPECT_GT(sampler->getAcceptedSamples(), 0);
+            EXPECT_GT(sampler->getRejectedSamples(), 0);
+            EXPECT_GE(sampler->getModelRuns(), sampler->getAcceptedSamples());
+        }
+
+        // the sample method creates a sampler
+        auto settings = SubsetSimulationSettings();
+        settings.SampleMethod = SubsetSimulationSettings::getSampleMethod("delayed_rejection");
+        EXPECT_EQ(settings.getSampler()->getName(), "delayed_rejection");
+    }
+
+    void TestReliabilityMethods::testSubSetSimulationDelayedRejection()
+    {
+        auto calculator = SubsetSimulation();
+        calculator.Settings->Sampler = std::make_shared<DelayedRejectionSampler>();
+        calculator.Settings->MinimumSamples = 20000;
+        calculator.Settings->MaximumSamples = 20000;
+
+        auto modelRunner = projectBuilder().BuildProject();
+
+        auto designPoint = calculator.getDesignPoint(modelRunner);
+
+        // exact reliability index, see numerical bisection
+        EXPECT_NEAR(designPoint->Beta, 1.87406654375, 0.01);
+    }
+
     void TestReliabilityMethods::testFDIRReliability()
     {
         auto calculator = FORMThenDirectionalSampling();
@@ -295,6 +446,65 @@ namespace Deltares::Probabilistic::Test
         }
     }
 
+    void TestReliabilityMethods::testNumericalIntegrationAdaptiveGrid()
+    {
+        // linear limit state in u-space, z = beta * sqrt(2) - u1 - u2, the other stochasts have a small influence
+        auto getModelRunner = [](int nStochasts, double beta)
+        {
+            auto z = std::make_shared<ZModel>([beta](std::shared_ptr<ModelSample> sample)
+            {
+                sample->Z = beta * std::sqrt(2.0) - sample->Values[0] - sample->Values[1];
+                for (size_t i = 2; i < sample->Values.size(); i++)
+                {
+                    sample->Z -= 0.01 * sample->Values[i];
+                }
+            });
+
+            std::vector<std::shared_ptr<Stochast>> stochasts;
+            for (int i = 0; i < nStochasts; i++)
+            {
+                stochasts.push_back(std::make_shared<Stochast>(DistributionType::Normal, std::vector<double>{ 0.0, 1.0 }));
+            }
+
+            auto uConverter = std::make_shared<UConverter>(stochasts, std::make_shared<CorrelationMatrix>(true));
+            uConverter->initializeForRun();
+            return std::make_shared<ModelRunner>(z, uConverter);
+        };
+
+        // same result as the full grid in two dimensions
+        auto fullGrid = NumericalIntegration();
+        auto fullDesignPoint = fullGrid.getDesignPoint(getModelRunner(2, 2.5));
+
+        auto adaptiveGrid = NumericalIntegration();
+        adaptiveGrid.Settings.GridType = NumericalIntegrationGridType::AdaptiveGrid;
+        adaptiveGrid.Settings.EpsilonBeta = 0.001;
+        auto adaptiveDesignPoint = adaptiveGrid.getDesignPoint(getModelRunner(2, 2.5));
+
+        EXPECT_NEAR(adaptiveDesignPoint->Beta, fullDesignPoint->Beta, 0.02);
+        EXPECT_NEAR(adaptiveDesignPoint->Alphas[0]->Alpha, fullDesignPoint->Alphas[0]->Alpha, 0.02);
+        EXPECT_LT(adaptiveDesignPoint->getTotalModelRuns(), fullDesignPoint->getTotalModelRuns());
+
+        // beyond the limit of the full grid
+        auto manyStochasts = NumericalIntegration();
+        manyStochasts.Settings.GridType = NumericalIntegrationGridType::AdaptiveGrid;
+        auto designPoint = manyStochasts.getDesignPoint(getModelRunner(12, 2.5));
+
+        ASSERT_EQ(designPoint->Alphas.size(), 12);
+        EXPECT_NEAR(designPoint->Beta, 2.5, 0.1);
+        EXPECT_NEAR(designPoint->Alphas[0]->Alpha, -1.0 / std::sqrt(2.0), 0.05);
+        EXPECT_LE(designPoint->getTotalModelRuns(), manyStochasts.Settings.MaximumSamples);
+
+        // refinements which do not fit in the maximum number of samples are not made
+        auto limitedGrid = NumericalIntegration();
+        limitedGrid.Settings.GridType = NumericalIntegrationGridType::AdaptiveGrid;
+        limitedGrid.Settings.MinimumSamples = 50;
+        limitedGrid.Settings.MaximumSamples = 100;
+        auto limitedDesignPoint = limitedGrid.getDesignPoint(getModelRunner(12, 2.5));
+
+        EXPECT_GT(limitedDesignPoint->getTotalModelRuns(), 1);
+        EXPECT_LE(limitedDesignPoint->getTotalModelRuns(), limitedGrid.Settings.MaximumSamples);
+    }
+
     void TestReliabilityMethods::testCrudeMonteCarloReliability()
     {
         auto calculator = CrudeMonteCarlo();
@@ -334,6 +544,94 @@ namespace Deltares::Probabilistic::Test
         EXPECT_NEAR(designPoint->Alphas[2]->X, 7.0, 1e-2);
     }
 
+    void TestReliabilityMethods::testCrudeMonteCarloChunks()
+    {
+        std::vector<std::shared_ptr<DesignPoint>> designPoints;
+
+        // the design point should not depend on the chunk size
+        for (int chunkSize : { 100, 2000, 100000 })
+        {
+            auto calculator = CrudeMonteCarlo();
+            auto modelRunner = projectBuilder().BuildProjectWithDeterminist(0.0);
+            modelRunner->Settings->MaxChunkSize = chunkSize;
+            calculator.Settings->MinimumSamples = 10000;
+            calculator.Settings->MaximumSamples = 20000;
+            calculator.Settings->designPointMethod = DesignPointMethod::CenterOfGravity;
+            calculator.Settings->randomSettings->GeneratorType = Deltares::Numeric::RandomGeneratorType::Philox;
+            designPoints.push_back(calculator.getDesignPoint(modelRunner));
+        }
+
+        for (size_t i = 1; i < designPoints.size(); i++)
+        {
+            EXPECT_NEAR(designPoints[i]->Beta, designPoints[0]->Beta, 1e-10);
+            ASSERT_EQ(designPoints[i]->Alphas.size(), designPoints[0]->Alphas.size());
+            for (size_t j = 0; j < designPoints[0]->Alphas.size(); j++)
+            {
+                EXPECT_NEAR(designPoints[i]->Alphas[j]->Alpha, designPoints[0]->Alphas[j]->Alpha, 1e-10);
+            }
+        }
+    }
+
+    void TestReliabilityMethods::testCrudeMonteCarloStreamed()
+    {
+        std::vector<std::shared_ptr<DesignPoint>> designPoints;
+
+        // the design point should not depend on whether the samples are calculated as a stream
+        for (bool streamed : { false, true })
+        {
+            auto calculator = CrudeMonteCarlo();
+            auto modelRunner = projectBuilder().BuildProjectWithDeterminist(0.0);
+            modelRunner->Settings->MaxParallelProcesses = 4;
+            modelRunner->Settings->MaxChunkSize = 100;
+            modelRunner->Settings->StreamEvaluations = streamed;
+            modelRunner->initializeForRun();
+            calculator.Settings->MinimumSamples = 10000;
+            calculator.Settings->MaximumSamples = 20000;
+            calculator.Settings->designPointMethod = DesignPointMethod::CenterOfGravity;
+            designPoints.push_back(calculator.getDesignPoint(modelRunner));
+
+            ASSERT_EQ(modelRunner->canStreamZValues(), streamed);
+        }
+
+        EXPECT_NEAR(designPoints[1]->Beta, designPoints[0]->Beta, 1e-10);
+        ASSERT_EQ(designPoints[1]->Alphas.size(), designPoints[0]->Alphas.size());
+        for (size_t j = 0; j < designPoints[0]->Alphas.size(); j++)
+        {
+            EXPECT_NEAR(designPoints[1]->Alphas[j]->Alpha, designPoints[0]->Alphas[j]->Alpha, 1e-10);
+        }
+    }
+
+    void TestReliabilityMethods::testDesignPointBuilderBlocks()
+    {
+        // zero weights before the first weighted sample and in a whole block after it
+        std::vector<std::shared_ptr<Sample>> samples;
+        for (int i = 0; i < 800; i++)
+        {
+            auto sample = std::make_shared<Sample>(std::vector<double>{ 0.01 * i, 1.0 - 0.002 * i });
+            sample->Weight = (i >= 300 && i < 512) ? 1.0 + 0.01 * i : 0.0;
+            samples.push_back(sample);
+        }
+
+        for (DesignPointMethod method : { DesignPointMethod::CenterOfGravity, DesignPointMethod::CenterOfAngles, DesignPointMethod::NearestToMean })
+        {
+            auto sequential = DesignPointBuilder(2, method);
+            for (const std::shared_ptr<Sample>& sample : samples)
+            {
+                sequential.addSample(sample);
+            }
+
+            auto blocks = DesignPointBuilder(2, method);
+            blocks.addSamples(samples);
+
+            std::shared_ptr<Sample> expected = sequential.getSample();
+            std::shared_ptr<Sample> actual = blocks.getSample();
+            for (size_t j = 0; j < expected->Values.size(); j++)
+            {
+                EXPECT_NEAR(expected->Values[j], actual->Values[j], 1e-10);
+            }
+        }
+    }
+
     void TestReliabilityMethods::testAdaptiveImportanceSampling()
     {
         auto calculator = AdaptiveImportanceSampling();
@@ -345,6 +643,33 @@ namespace Deltares::Probabilistic::Test
         EXPECT_NEAR(designPoint->Beta, 2.95, 0.01);
     }
 
+    void TestReliabilityMethods::testImportanceSamplingChunks()
+    {
+        std::vector<std::shared_ptr<DesignPoint>> designPoints;
+
+        // the design point should not depend on the chunk size, with which samples are prepared and added to the design point
+        for (int chunkSize : { 1, 500 })
+        {
+            auto calculator = ImportanceSampling();
+            calculator.Settings->MinimumSamples = 1000;
+            calculator.Settings->MaximumSamples = 5000;
+
+            auto modelRunner = projectBuilder().BuildProject();
+            modelRunner->Settings->MaxChunkSize = chunkSize;
+
+            designPoints.push_back(calculator.getDesignPoint(modelRunner));
+        }
+
+        ASSERT_EQ(designPoints[0]->Alphas.size(), 2);
+        EXPECT_NEAR(designPoints[0]->Beta, 1.88, 0.1);
+        EXPECT_NEAR(designPoints[1]->Beta, designPoints[0]->Beta, 1e-10);
+        EXPECT_EQ(designPoints[1]->convergenceReport->FailedSamples, designPoints[0]->convergenceReport->FailedSamples);
+        for (size_t j = 0; j < designPoints[0]->Alphas.size(); j++)
+        {
+            EXPECT_NEAR(designPoints[1]->Alphas[j]->Alpha, designPoints[0]->Alphas[j]->Alpha, 1e-10);
+        }
+    }
+
     void TestReliabilityMethods::testClustersAdpImpSampling()
     {
         auto expectedBetas = std::vector({ 0.80438, 0.753699, 0.78369, 0.7956208, 0.754192 });
@@ -387,6 +712,58 @@ namespace Deltares::Probabilistic::Test
         }
     }
 
+    void TestReliabilityMethods::testClustersProportionalAllocation()
+    {
+        // cluster with a larger standard deviation should get more samples
+        auto cluster1 = std::make_shared<ImportanceSamplingCluster>();
+        cluster1->Center = std::make_shared<Sample>(std::vector<double>{ 1.0, 0.0 });
+        cluster1->TotalCount = 100;
+        cluster1->FailWeight = 10;
+        cluster1->FailWeight2 = 4;
+
+        auto cluster2 = std::make_shared<ImportanceSamplingCluster>();
+        cluster2->Center = std::make_shared<Sample>(std::vector<double>{ -1.0, 0.0 });
+        cluster2->TotalCount = 100;
+        cluster2->FailWeight = 1;
+        cluster2->FailWeight2 = 0.04;
+
+        std::vector<double> fractions = ImportanceSampling::getClusterFractions({ cluster1->Center, cluster2->Center }, { cluster1, cluster2 }, 0.1);
+
+        ASSERT_EQ(fractions.size(), 2);
+        EXPECT_NEAR(fractions[0], 0.05 + 0.9 * 10.0 / 11.0, 1e-10);
+        EXPECT_NEAR(fractions[1], 0.05 + 0.9 * 1.0 / 11.0, 1e-10);
+
+        // without failing samples the allocation is unknown
+        cluster1->FailWeight = 0;
+        cluster1->FailWeight2 = 0;
+        cluster2->FailWeight = 0;
+        cluster2->FailWeight2 = 0;
+        EXPECT_TRUE(ImportanceSampling::getClusterFractions({ cluster1->Center, cluster2->Center }, { cluster1, cluster2 }, 0.1).empty());
+
+        // the allocation state is kept when the settings are copied
+        ImportanceSamplingSettings settings;
+        settings.ClusterFractions = { 0.25, 0.75 };
+        settings.DefensiveFraction = 0.2;
+        std::shared_ptr<ImportanceSamplingSettings> clone = settings.clone();
+        EXPECT_EQ(settings.ClusterFractions, clone->ClusterFractions);
+        EXPECT_DOUBLE_EQ(0.2, clone->DefensiveFraction);
+
+        // proportional allocation should give the same reliability as equal allocation
+        auto calculator = AdaptiveImportanceSampling();
+        auto modelRunner = projectBuilder::BuildQuadraticProject();
+        calculator.Settings->importanceSamplingSettings->MinimumSamples = 5000;
+        calculator.Settings->importanceSamplingSettings->MaximumSamples = 10000;
+        calculator.Settings->importanceSamplingSettings->ClusterAllocation = ClusterAllocationType::Proportional;
+        calculator.Settings->MinVarianceLoops = 2;
+        calculator.Settings->MaxVarianceLoops = 8;
+        calculator.Settings->importanceSamplingSettings->runSettings->MaxParallelProcesses = 1;
+        calculator.Settings->Clustering = true;
+        calculator.Settings->clusterSettings->MaxClusters = 4;
+        auto designPoint = calculator.getDesignPoint(modelRunner);
+
+        EXPECT_NEAR(designPoint->Beta, 0.80438, 0.05);
+    }
+
     void TestReliabilityMethods::testDirSamplingProxyModels(const bool useProxy, const ModelVaryingType varyingType,
         const double dsdu)
     {
@@ -453,5 +830,34 @@ namespace Deltares::Probabilistic::Test
         EXPECT_EQ(designPoint->convergenceReport->TotalModelRuns, refTotalModelRuns);
     }
 
-}
+    void TestReliabilityMethods::testDirSamplingPerThread()
+    {
+        std::vector<std::shared_ptr<DesignPoint>> designPoints;
+
+        // the design point should not depend on whether whole directions are calculated per thread
+        for (bool directionsPerThread : { false, true })
+        {
+            auto calculator = DirectionalSampling();
+            auto modelRunner = projectBuilder().BuildProjectTwoBranches(false);
+            modelRunner->Settings->MaxParallelProcesses = 4;
+            calculator.Settings->MinimumDirections = 10;
+            calculator.Settings->MaximumDirections = 500;
+            calculator.Settings->VariationCoefficient = 0.1;
+            calculator.Settings->randomSettings->Seed = 0;
+            calculator.Settings->DirectionsPerThread = directionsPerThread;
+
+            designPoints.push_back(calculator.getDesignPoint(modelRunner));
+
+            if (directionsPerThread)
+            {
+                EXPECT_EQ(calculator.preComputedCounter, 0);
+            }
+        }
 
+        EXPECT_NEAR(designPoints[1]->Beta, designPoints[0]->Beta, 1e-10);
+        for (size_t i = 0; i < designPoints[0]->Alphas.size(); i++)
+        {
+            EXPECT_NEAR(designPoints[1]->Alphas[i]->Alpha, designPoints[0]->Alphas[i]->Alpha, 1e-10);
+        }
+    }
+}
@@ -198,6 +198,7 @@ namespace Deltares::Probabilistic::Test
 
         const auto id5 = handler.Create("settings");
         handler.SetStringValue(id5, "reliability_method", "crude_monte_carlo");
+        handler.SetBoolValue(id5, "save_realizations", true);
         handler.SetIntValue(id1, "settings", id5);
 
         handler.Execute(id1, "run");
@@ -215,7 +216,15 @@ namespace Deltares::Probabilistic::Test
         EXPECT_NEAR(x1_through_server, 2.00, 1e-2);
         EXPECT_NEAR(x2_through_server, 2.06, 1e-2);
 
-        for (const int id : {id8, id7, id6, id5, id4, id3, id2, id1 })
+        // an evaluation keeps its id when it is requested again
+        ASSERT_GT(handler.GetIntValue(id6, "evaluations_count"), 0);
+        const int id9 = handler.GetIndexedIdValue(id6, "evaluations", 0);
+        EXPECT_EQ(id9, handler.GetIndexedIdValue(id6, "evaluations", 0));
+        EXPECT_NE(id9, handler.GetIndexedIdValue(id6, "evaluations", 1));
+
+        const int id10 = handler.GetIndexedIdValue(id6, "evaluations", 1);
+
+        for (const int id : {id10, id9, id8, id7, id6, id5, id4, id3, id2, id1 })
         {
             handler.Destroy(id);
         }
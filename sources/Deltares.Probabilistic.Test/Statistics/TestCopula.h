@@ -34,6 +34,7 @@ namespace Deltares::Probabilistic::Test
         static void testValidation();
         static void testValidationMessages();
         static void testGaussianValidationMessages();
+        static void testBatch();
     };
 }
 
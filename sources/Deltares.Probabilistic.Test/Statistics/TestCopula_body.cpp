@@ -198,5 +198,45 @@ namespace Deltares::Probabilistic::Test
         EXPECT_EQ(report.messages[0]->Text, "Cholesky decomposition fails.");
     }
 
-}
+    void TestCopula::testBatch()
+    {
+        constexpr double margin = 1e-9;
+
+        const std::vector<std::pair<double, CorrelationType>> correlations =
+        {
+            { 0.7, CorrelationType::Clayton }, { -1.0, CorrelationType::Clayton }, { 0.7, CorrelationType::Frank },
+            { -800.0, CorrelationType::Frank }, { 5.0, CorrelationType::Gumbel }, { 0.3, CorrelationType::DiagonalBand },
+            { 0.5, CorrelationType::Gaussian }
+        };
 
+        for (const auto& [value, type] : correlations)
+        {
+            // an uncorrelated stochast between the correlated pair
+            auto copulas = Statistics::CopulaCorrelation();
+            copulas.Init(3);
+            copulas.SetCorrelation(2, 0, value, type);
+
+            constexpr size_t count = 100;
+            constexpr size_t stride = 4;
+            std::vector<double> uValues(count * stride);
+            for (size_t k = 0; k < uValues.size(); k++)
+            {
+                uValues[k] = 3.0 * std::sin(0.71 * static_cast<double>(k));
+            }
+
+            std::vector<double> correlated(count * 3);
+            copulas.ApplyCorrelation(uValues.data(), 3, stride, count, correlated.data());
+
+            for (size_t j = 0; j < count; j++)
+            {
+                const std::vector<double> sample(uValues.begin() + j * stride, uValues.begin() + j * stride + 3);
+                const std::vector<double> expected = copulas.ApplyCorrelation(sample);
+
+                for (size_t i = 0; i < 3; i++)
+                {
+                    EXPECT_NEAR(correlated[i * count + j], expected[i], margin);
+                }
+            }
+        }
+    }
+}
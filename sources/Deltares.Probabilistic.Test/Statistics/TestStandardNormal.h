@@ -32,6 +32,7 @@ namespace Deltares::Probabilistic::Test
         void testReturnTime() const;
         void testFreqFromBeta() const;
         void testLogQFromBeta() const;
+        void testArrayConversions() const;
         const double margin = 1e-9;
     };
 }
@@ -20,6 +20,8 @@
 // All rights reserved.
 //
 #include <numbers>
+#include <limits>
+#include <cmath>
 #include <gtest/gtest.h>
 #include "TestStandardNormal.h"
 #include "../../Deltares.Probabilistic/Statistics/StandardNormal.h"
@@ -32,6 +34,7 @@ namespace Deltares::Probabilistic::Test
         testReturnTime();
         testFreqFromBeta();
         testLogQFromBeta();
+        testArrayConversions();
     }
 
     void TestStandardNormal::testPQbetaConversions() const
@@ -96,5 +99,62 @@ namespace Deltares::Probabilistic::Test
         }
     }
 
-}
+    // Test of the array versions, which should be equal to the single value versions within a few ULP
+    void TestStandardNormal::testArrayConversions() const
+    {
+        using namespace Deltares::Statistics;
+
+        constexpr double ulpTolerance = 8.0;
+        constexpr double eps = std::numeric_limits<double>::epsilon();
+
+        std::vector<double> u;
+        for (int i = -4000; i <= 4000; i++)
+        {
+            u.push_back(0.01 * static_cast<double>(i));
+        }
+        u.push_back(std::nan(""));
+
+        std::vector<double> p(u.size());
+        std::vector<double> q(u.size());
+        StandardNormal::getPFromU(u.data(), p.data(), u.size());
+        StandardNormal::getQFromU(u.data(), q.data(), u.size());
+
+        for (size_t i = 0; i < u.size() - 1; i++)
+        {
+            EXPECT_NEAR(p[i], StandardNormal::getPFromU(u[i]), ulpTolerance * eps * StandardNormal::getPFromU(u[i]));
+            EXPECT_NEAR(q[i], StandardNormal::getQFromU(u[i]), ulpTolerance * eps * StandardNormal::getQFromU(u[i]));
+        }
+        EXPECT_TRUE(std::isnan(p.back()));
 
+        std::vector<double> probabilities = { 0.0, 1.0, 1e-300, 1e-40, 1e-35, 1.0 - 1e-16, -0.5, 1.5, std::nan("") };
+        for (int i = 1; i < 1000; i++)
+        {
+            probabilities.push_back(0.001 * static_cast<double>(i));
+        }
+        for (int i = 1; i < 300; i++)
+        {
+            probabilities.push_back(std::pow(10.0, -0.1 * static_cast<double>(i)));
+        }
+
+        std::vector<double> uFromQ(probabilities.size());
+        std::vector<double> uFromP = probabilities;
+        StandardNormal::getUFromQ(probabilities.data(), uFromQ.data(), probabilities.size());
+        StandardNormal::getUFromP(uFromP.data(), uFromP.data(), uFromP.size());
+
+        for (size_t i = 0; i < probabilities.size(); i++)
+        {
+            const double expectedQ = StandardNormal::getUFromQ(probabilities[i]);
+            const double expectedP = StandardNormal::getUFromP(probabilities[i]);
+            if (std::isnan(expectedQ))
+            {
+                EXPECT_TRUE(std::isnan(uFromQ[i]));
+                EXPECT_TRUE(std::isnan(uFromP[i]));
+            }
+            else
+            {
+                EXPECT_NEAR(uFromQ[i], expectedQ, ulpTolerance * eps * std::max(1.0, std::fabs(expectedQ)));
+                EXPECT_NEAR(uFromP[i], expectedP, ulpTolerance * eps * std::max(1.0, std::fabs(expectedP)));
+            }
+        }
+    }
+}
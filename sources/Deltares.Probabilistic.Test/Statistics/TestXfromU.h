@@ -37,6 +37,7 @@ namespace Deltares::Probabilistic::Test
         static void TestRayleigh();
         static void TestRayleighN();
         static void TestTruncatedNormal();
+        static void TestBatch();
     private:
         static void TestRange(Statistics::Distribution& distribution, Statistics::StochastProperties& properties, const double margin,
             const int start=-8, const int stop=8);
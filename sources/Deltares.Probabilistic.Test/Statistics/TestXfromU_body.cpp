@@ -154,15 +154,58 @@ namespace Deltares::Probabilistic::Test
         }
     }
 
+    void TestXfromU::TestBatch()
+    {
+        constexpr double margin = 1e-12;
+
+        std::vector<double> uValues;
+        for (int i = -80; i <= 80; i++)
+        {
+            uValues.push_back(0.1 * i);
+        }
+
+        auto logNormal = Statistics::Stochast();
+        logNormal.setDistributionType(Statistics::DistributionType::LogNormal);
+        logNormal.setMeanAndDeviation(2.0, 0.5);
+        logNormal.getProperties()->Shift = 0.5;
+
+        auto truncatedNormal = Statistics::Stochast();
+        truncatedNormal.setDistributionType(Statistics::DistributionType::Normal);
+        truncatedNormal.setTruncated(true);
+        truncatedNormal.setMeanAndDeviation(0.0, 1.0);
+        truncatedNormal.getProperties()->Minimum = -0.5;
+
+        for (Statistics::Stochast* stochast : { &logNormal, &truncatedNormal })
+        {
+            std::vector<double> xValues(uValues.size());
+            stochast->getXFromU(uValues.data(), xValues.data(), uValues.size());
+
+            for (size_t i = 0; i < uValues.size(); i++)
+            {
+                EXPECT_NEAR(stochast->getXFromU(uValues[i]), xValues[i], margin);
+            }
+        }
+    }
+
     void TestXfromU::TestRange(Statistics::Distribution& distribution, Statistics::StochastProperties& properties, const double margin,
         const int start, const int stop)
     {
+        std::vector<double> uValues;
         for (int i = -start; i <= stop; i++)
         {
             const double u = i;
             const double x = distribution.getXFromU(properties, u);
             const double u2 = distribution.getUFromX(properties, x);
             EXPECT_NEAR(u, u2, margin);
+            uValues.push_back(u);
+        }
+
+        // the conversion of a number of values at once should give the same results
+        std::vector<double> xValues(uValues.size());
+        distribution.getXFromU(properties, uValues.data(), xValues.data(), uValues.size());
+        for (size_t i = 0; i < uValues.size(); i++)
+        {
+            EXPECT_NEAR(distribution.getXFromU(properties, uValues[i]), xValues[i], 1e-12);
         }
     }
 
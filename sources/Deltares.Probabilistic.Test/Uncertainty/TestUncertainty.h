@@ -41,6 +41,7 @@ namespace Deltares::Probabilistic::Test
         static void testFORM();
         static void testFORMoneFragilityValueAsResult();
         static void testFOSM();
+        static void testCorrelationMatrixBuilder();
     private:
         static constexpr double margin = 0.02;
         static constexpr double smallMargin = 1E-10;
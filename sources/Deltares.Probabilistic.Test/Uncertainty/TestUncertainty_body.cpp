@@ -30,6 +30,11 @@
 #include "../../Deltares.Probabilistic/Uncertainty/DirectionalSamplingS.h"
 #include "../../Deltares.Probabilistic/Uncertainty/FORMS.h"
 #include "../../Deltares.Probabilistic/Uncertainty/FOSM.h"
+#include "../../Deltares.Probabilistic/Uncertainty/CorrelationMatrixBuilder.h"
+#include "../../Deltares.Probabilistic/Statistics/CovarianceAccumulator.h"
+
+#include <numbers>
+#include <random>
 
 #include <gtest/gtest.h>
 
@@ -324,5 +329,120 @@ namespace Deltares::Probabilistic::Test
 
         ASSERT_NEAR(0.05, result->quantileEvaluations[0]->Quantile, margin);
     }
-}
 
+    void TestUncertainty::testCorrelationMatrixBuilder()
+    {
+        constexpr size_t nSamples = 20000;
+        constexpr double rho = 0.6;
+
+        std::mt19937 generator(1234);
+        std::normal_distribution<double> normal;
+
+        std::vector<std::shared_ptr<Statistics::Stochast>> inputs;
+        for (size_t i = 0; i < 3; i++)
+        {
+            inputs.push_back(std::make_shared<Statistics::Stochast>());
+        }
+
+        std::vector<std::vector<double>> uValues(nSamples, std::vector<double>(3));
+        for (size_t k = 0; k < nSamples; k++)
+        {
+            uValues[k][0] = normal(generator);
+            uValues[k][1] = rho * uValues[k][0] + std::sqrt(1 - rho * rho) * normal(generator);
+            uValues[k][2] = normal(generator);
+        }
+
+        // first output z1 = 1 + u1 + 2 u3, second output z2 = u2
+        auto output1 = std::make_shared<Statistics::Stochast>();
+        output1->setDistributionType(Statistics::DistributionType::Normal);
+        output1->setMeanAndDeviation(1.0, std::sqrt(5.0));
+
+        auto output2 = std::make_shared<Statistics::Stochast>();
+        output2->setDistributionType(Statistics::DistributionType::Normal);
+        output2->setMeanAndDeviation(0.0, 1.0);
+
+        std::vector<double> z1Values;
+        std::vector<double> z2Values;
+
+        Uncertainty::CorrelationMatrixBuilder builder;
+        Uncertainty::CorrelationMatrixBuilder rankBuilder;
+        rankBuilder.RankCorrelation = true;
+
+        for (size_t k = 0; k < nSamples; k++)
+        {
+            z1Values.push_back(1.0 + uValues[k][0] + 2.0 * uValues[k][2]);
+            builder.registerStochastValues(inputs, uValues[k], z1Values.back(), 1.0);
+            rankBuilder.registerStochastValues(inputs, uValues[k], z1Values.back(), 1.0);
+        }
+
+        builder.registerSamples(output1, z1Values);
+        rankBuilder.registerSamples(output1, z1Values);
+
+        for (size_t k = 0; k < nSamples; k++)
+        {
+            z2Values.push_back(uValues[k][1]);
+            builder.registerStochastValues(inputs, uValues[k], z2Values.back(), 1.0);
+        }
+
+        builder.registerSamples(output2, z2Values);
+
+        // reference values by a direct calculation
+        std::vector<double> rows;
+        for (size_t k = 0; k < nSamples; k++)
+        {
+            rows.insert(rows.end(), uValues[k].begin(), uValues[k].end());
+            rows.push_back((z1Values[k] - 1.0) / std::sqrt(5.0));
+            rows.push_back(z2Values[k]);
+        }
+
+        Statistics::CovarianceAccumulator reference(5);
+        for (size_t k = 0; k < nSamples; k++)
+        {
+            reference.add(rows.data() + 5 * k);
+        }
+
+        // chunked and merged accumulation give the same result as row by row accumulation
+        const std::vector<double> weights(nSamples, 1.0);
+        Statistics::CovarianceAccumulator chunked(5);
+        chunked.add(rows.data(), weights.data(), nSamples);
+
+        Statistics::CovarianceAccumulator firstHalf(5);
+        Statistics::CovarianceAccumulator secondHalf(5);
+        firstHalf.add(rows.data(), weights.data(), nSamples / 2);
+        secondHalf.add(rows.data() + 5 * (nSamples / 2), weights.data(), nSamples - nSamples / 2);
+        firstHalf.merge(secondHalf);
+
+        ASSERT_NEAR(static_cast<double>(nSamples), chunked.getWeight(), smallMargin);
+        for (size_t i = 0; i < 5; i++)
+        {
+            ASSERT_NEAR(reference.getMean(i), chunked.getMean(i), smallMargin);
+            for (size_t j = 0; j <= i; j++)
+            {
+                ASSERT_NEAR(reference.getCovariance(i, j), chunked.getCovariance(i, j), smallMargin);
+                ASSERT_NEAR(reference.getCovariance(i, j), firstHalf.getCovariance(i, j), smallMargin);
+            }
+        }
+
+        std::shared_ptr<Statistics::CorrelationMatrix> matrix = builder.getCorrelationMatrix();
+        std::vector<std::shared_ptr<Statistics::Stochast>> stochasts = { inputs[0], inputs[1], inputs[2], output1, output2 };
+
+        ASSERT_EQ(5, matrix->GetDimension());
+        ASSERT_NEAR(rho, matrix->GetCorrelation(inputs[0], inputs[1]).value, margin);
+
+        for (size_t i = 0; i < 5; i++)
+        {
+            for (size_t j = 0; j < i; j++)
+            {
+                // all Pearson correlations, also between inputs and outputs, are exact
+                ASSERT_NEAR(reference.getCorrelation(i, j), matrix->GetCorrelation(stochasts[i], stochasts[j]).value, smallMargin);
+            }
+        }
+
+        // Spearman correlation of a bivariate normal distribution
+        std::shared_ptr<Statistics::CorrelationMatrix> rankMatrix = rankBuilder.getCorrelationMatrix();
+        const double spearman = 6 / std::numbers::pi * std::asin(rho / 2);
+        ASSERT_NEAR(spearman, rankMatrix->GetCorrelation(inputs[0], inputs[1]).value, margin);
+        ASSERT_NEAR(0.0, rankMatrix->GetCorrelation(inputs[0], inputs[2]).value, margin);
+        ASSERT_NEAR(6 / std::numbers::pi * std::asin(1 / std::sqrt(5.0) / 2), rankMatrix->GetCorrelation(inputs[0], output1).value, margin);
+    }
+}
@@ -48,6 +48,7 @@
 #include "Uncertainty/TestUncertainty.h"
 #include "Sensitivity/TestSensitivity.h"
 #include "Optimization/testCobyla.h"
+#include "Optimization/testGridSearch.h"
 #include "Proxies/TestProxies.h"
 #include "Utils/TestExceptions.h"
 #include "Reliability/Waarts/TestWaartsLinearResistance.h"
@@ -233,6 +234,11 @@ TEST(ReliabilityMethodTest, TestFORM)
     Deltares::Probabilistic::Test::TestReliabilityMethods::testFORM();
 }
 
+TEST(ReliabilityMethodTest, TestFORMQuasiNewton)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testFORMQuasiNewton();
+}
+
 TEST(ReliabilityMethodTest, TestFORMArray)
 {
     Deltares::Probabilistic::Test::TestReliabilityMethods::testFORMArray();
@@ -268,6 +274,11 @@ TEST(ReliabilityMethodTest, TestNumBisection2)
     Deltares::Probabilistic::Test::TestReliabilityMethods::testNumericalBisectionLinear();
 }
 
+TEST(ReliabilityMethodTest, TestIntegrationDomain)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testIntegrationDomain();
+}
+
 TEST(ReliabilityMethodTest, TestSubSetSimulationReliabilityNearestToMean)
 {
     Deltares::Probabilistic::Test::TestReliabilityMethods::testSubSetSimulationReliabilityNearestToMean();
@@ -278,6 +289,21 @@ TEST(ReliabilityMethodTest, TestSubSetSimulationReliabilityCenterOfGravity)
     Deltares::Probabilistic::Test::TestReliabilityMethods::testSubSetSimulationReliabilityCenterOfGravity();
 }
 
+TEST(ReliabilityMethodTest, TestSubSetSimulationParallelChains)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testSubSetSimulationParallelChains();
+}
+
+TEST(ReliabilityMethodTest, TestSubSetSimulationSamplers)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testSubSetSimulationSamplers();
+}
+
+TEST(ReliabilityMethodTest, TestSubSetSimulationDelayedRejection)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testSubSetSimulationDelayedRejection();
+}
+
 TEST(ReliabilityMethodTest, TestFDIRReliability)
 {
     Deltares::Probabilistic::Test::TestReliabilityMethods::testFDIRReliability();
@@ -298,6 +324,11 @@ TEST(ReliabilityMethodTest, TestNumericalIntegrationReliability)
     Deltares::Probabilistic::Test::TestReliabilityMethods::testNumericalIntegrationReliability();
 }
 
+TEST(ReliabilityMethodTest, TestNumericalIntegrationAdaptiveGrid)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testNumericalIntegrationAdaptiveGrid();
+}
+
 TEST(ReliabilityMethodTest, TestCrudeMCReliability)
 {
     Deltares::Probabilistic::Test::TestReliabilityMethods::testCrudeMonteCarloReliability();
@@ -313,16 +344,41 @@ TEST(ReliabilityMethodTest, testCrudeMCwithQualitativeProject)
     Deltares::Probabilistic::Test::TestReliabilityMethods::testCrudeMonteCarloWithQualitativeProject();
 }
 
+TEST(ReliabilityMethodTest, testCrudeMCChunks)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testCrudeMonteCarloChunks();
+}
+
+TEST(ReliabilityMethodTest, testCrudeMCStreamed)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testCrudeMonteCarloStreamed();
+}
+
+TEST(ReliabilityMethodTest, testDesignPointBuilderBlocks)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testDesignPointBuilderBlocks();
+}
+
 TEST(ReliabilityMethodTest, TestAdaptiveImportanceSampling)
 {
     Deltares::Probabilistic::Test::TestReliabilityMethods::testAdaptiveImportanceSampling();
 }
 
+TEST(ReliabilityMethodTest, TestImportanceSamplingChunks)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testImportanceSamplingChunks();
+}
+
 TEST(ReliabilityMethodTest, TestClustersAdpImpSampling)
 {
     Deltares::Probabilistic::Test::TestReliabilityMethods::testClustersAdpImpSampling();
 }
 
+TEST(ReliabilityMethodTest, TestClustersProportionalAllocation)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testClustersProportionalAllocation();
+}
+
 TEST(ReliabilityMethodTest, TestDirSamplingTwoBranches)
 {
     Deltares::Probabilistic::Test::TestReliabilityMethods::testDirSamplingProxyModels(false, Deltares::Reliability::ModelVaryingType::Monotone, 1.0);
@@ -347,6 +403,12 @@ TEST(ReliabilityMethodTest, TestDirSamplingTwoBranchesLargerStepsize)
 {
     Deltares::Probabilistic::Test::TestReliabilityMethods::testDirSamplingProxyModels(false, Deltares::Reliability::ModelVaryingType::Monotone, 3.0);
 }
+
+TEST(ReliabilityMethodTest, TestDirSamplingPerThread)
+{
+    Deltares::Probabilistic::Test::TestReliabilityMethods::testDirSamplingPerThread();
+}
+
 TEST(DistributionTests, testConditionalStochast)
 {
     Deltares::Probabilistic::Test::testDistributions::testConditionalStochast();
@@ -487,6 +549,21 @@ TEST(DistributionTests, testRayleighN)
     Deltares::Probabilistic::Test::testDistributions::testRayleighN();
 }
 
+TEST(DistributionTests, testSumLogLikelihood)
+{
+    Deltares::Probabilistic::Test::testDistributions::testSumLogLikelihood();
+}
+
+TEST(DistributionTests, testFitNelderMead)
+{
+    Deltares::Probabilistic::Test::testDistributions::testFitNelderMead();
+}
+
+TEST(DistributionTests, testKSTest)
+{
+    Deltares::Probabilistic::Test::testDistributions::testKSTest();
+}
+
 TEST(DistributionTests, testBernoulli)
 {
     Deltares::Probabilistic::Test::testDistributions::testBernoulli();
@@ -567,6 +644,11 @@ TEST(XfromUTests, testTruncatedNormal)
     Deltares::Probabilistic::Test::TestXfromU::TestTruncatedNormal();
 }
 
+TEST(XfromUTests, testBatch)
+{
+    Deltares::Probabilistic::Test::TestXfromU::TestBatch();
+}
+
 TEST(UnitTests, testStandardNormal)
 {
     auto tstStdNormal = Deltares::Probabilistic::Test::TestStandardNormal();
@@ -628,6 +710,11 @@ TEST(CopulasTest, testGaussianValidationMessages)
     Deltares::Probabilistic::Test::TestCopula::testGaussianValidationMessages();
 }
 
+TEST(CopulasTest, testBatch)
+{
+    Deltares::Probabilistic::Test::TestCopula::testBatch();
+}
+
 TEST(UnitTests, testUncCrudeMonteCarloAddOne)
 {
     Deltares::Probabilistic::Test::TestUncertainty::testCrudeMonteCarloAddOne();
@@ -688,6 +775,11 @@ TEST(UnitTests, testUncFOSM)
     Deltares::Probabilistic::Test::TestUncertainty::testFOSM();
 }
 
+TEST(UnitTests, testUncCorrelationMatrixBuilder)
+{
+    Deltares::Probabilistic::Test::TestUncertainty::testCorrelationMatrixBuilder();
+}
+
 TEST(UnitTests, testSensitivity)
 {
     auto tstSensitivity = Deltares::Probabilistic::Test::TestSensitivity();
@@ -733,6 +825,21 @@ TEST(UnitTests, testCobylaOptimization)
     tstCobylaOpt.allCobylaTests();
 }
 
+TEST(UnitTests, testGridSearchNelderMeadRefinement)
+{
+    Deltares::Probabilistic::Test::testGridSearch::testNelderMeadRefinement();
+}
+
+TEST(UnitTests, testGridSearchNelderMeadWithoutRefinements)
+{
+    Deltares::Probabilistic::Test::testGridSearch::testNelderMeadWithoutRefinements();
+}
+
+TEST(UnitTests, testGridSearchNelderMeadInvalidValues)
+{
+    Deltares::Probabilistic::Test::testGridSearch::testNelderMeadInvalidValues();
+}
+
 TEST(WaartsTests, testLinearResistanceFORM)
 {
     auto tester = Deltares::Probabilistic::Test::TestWaartsLinearResistance();
@@ -21,7 +21,9 @@
 //
 #include "HohenbichlerNumInt.h"
 
-#include <unordered_set>
+#include <cmath>
+
+#include "HohenbichlerTable.h"
 
 #include "../Math/NumericSupport.h"
 #include "../Statistics/StandardNormal.h"
@@ -35,7 +37,7 @@ namespace Deltares::Reliability
 
     std::shared_ptr<DesignPoint> HohenbichlerNumInt::AlphaHohenbichler(const std::shared_ptr<DesignPoint>& designPoint1, const std::shared_ptr<DesignPoint>& designPoint2,
         const std::vector<std::shared_ptr<Stochast>>& stochasts,
-        const std::shared_ptr<SelfCorrelationMatrix>& selfCorrelation, const combineAndOr system)
+        const std::shared_ptr<SelfCorrelationMatrix>& selfCorrelation, const combineAndOr system) const
     {
         auto nVar = stochasts.size();
 
@@ -50,44 +52,38 @@ namespace Deltares::Reliability
             auto corr = selfCorrelation->getSelfCorrelation(stochasts[i], designPoint1, designPoint2);
             rho += reorderedDesignPoint1->Values[i] * reorderedDesignPoint2->Values[i] * corr;
         }
-        const double betaNew = BetaHohenbichler(designPoint1->Beta, designPoint2->Beta, rho, system);
 
-        auto alpha1 = std::vector<double>();
-        auto alpha2 = std::vector<double>();
+        constexpr double epsilon = 0.01;
 
-        std::vector<std::shared_ptr<StochastPointAlpha>> parameters1 = designPoint1->getAlphas(stochasts);
-        std::vector<std::shared_ptr<StochastPointAlpha>> parameters2 = designPoint2->getAlphas(stochasts);
+        // the unperturbed combination is followed by two perturbations per stochast, which are all computed at once
+        std::vector<HohenbichlerInput> inputs;
+        inputs.push_back({ designPoint1->Beta, designPoint2->Beta, rho });
 
         for (size_t i = 0; i < nVar; i++)
         {
-            constexpr double epsilon = 0.01;
             // perturbation of ui and its effect on beta.
-            // [1] determine alpha-value for correlated part
-
+            // [1] perturbation of beta-values for the correlated part
             double rhoSCi = selfCorrelation->getSelfCorrelation(stochasts[i]);
             double rhoCompl = sqrt(1.0 - rhoSCi * rhoSCi);
 
-            // [1a] perturbation of beta-values
-            auto dpj1 = GetRealization(designPoint1->Beta + reorderedDesignPoint1->Values[i] * epsilon, parameters1); // copy alphas
-            auto dpj2 = GetRealization(designPoint2->Beta + reorderedDesignPoint2->Values[i] * epsilon * rhoSCi, parameters2);
-
-            // [1b] Hohenbichler computation with perturbed beta-values
-            double betaj1 = BetaHohenbichler(dpj1.Beta, dpj2.Beta, rho, system);
-
-            // [1c] compute equivalent alpha-value for correlated part
-            alpha1.push_back((betaj1 - betaNew) / epsilon);
-
-            // [2] determine alpha - value for uncorrelated part
-            // [2a] perturbation of beta - values
+            inputs.push_back({ designPoint1->Beta + reorderedDesignPoint1->Values[i] * epsilon,
+                               designPoint2->Beta + reorderedDesignPoint2->Values[i] * epsilon * rhoSCi, rho });
 
-            auto dpx1 = GetRealization(designPoint1->Beta, parameters1); // copy alphas
-            auto dpx2 = GetRealization(designPoint2->Beta + reorderedDesignPoint2->Values[i] * epsilon * rhoCompl, parameters2);
+            // [2] perturbation of beta-values for the uncorrelated part
+            inputs.push_back({ designPoint1->Beta,
+                               designPoint2->Beta + reorderedDesignPoint2->Values[i] * epsilon * rhoCompl, rho });
+        }
 
-            // [2b] Hohenbichler computation with perturbed beta - values
-            double betax1 = BetaHohenbichler(dpx1.Beta, dpx2.Beta, rho, system);
+        const std::vector<double> betas = BetaHohenbichler(inputs, system);
+        const double betaNew = betas[0];
 
-            // [2c] compute equivalent alpha - value for correlated part
-            alpha2.push_back((betax1 - betaNew) / epsilon);
+        // equivalent alpha-values for the correlated and uncorrelated part
+        auto alpha1 = std::vector<double>();
+        auto alpha2 = std::vector<double>();
+        for (size_t i = 0; i < nVar; i++)
+        {
+            alpha1.push_back((betas[2 * i + 1] - betaNew) / epsilon);
+            alpha2.push_back((betas[2 * i + 2] - betaNew) / epsilon);
         }
 
         // combine alpha - values of correlated and uncorrelated part
@@ -113,23 +109,41 @@ namespace Deltares::Reliability
             for (auto &x : alphaNew) x /= length;
         }
 
+        std::vector<std::shared_ptr<StochastPointAlpha>> parameters1 = designPoint1->getAlphas(stochasts);
+
         auto returnedDp = std::make_shared<DesignPoint>();
         *returnedDp = GetRealization(betaNew, parameters1, alphaNew);
 
         return returnedDp;
     }
 
-    double HohenbichlerNumInt::BetaHohenbichler(double dp1, double dp2, const double rho, const combineAndOr system)
+    std::vector<double> HohenbichlerNumInt::BetaHohenbichler(const std::vector<HohenbichlerInput>& inputs, const combineAndOr system) const
     {
-        if (dp1 > dp2)
+        // make sure the grid is available before the parallel loop
+        getGridProbabilities();
+        if (UseTable)
         {
-            std::swap(dp1, dp2);
+            HohenbichlerTable::getTable();
         }
-        return Hohenbichler(dp1, dp2, rho, system);
+
+        std::vector<double> betas(inputs.size());
+
+#pragma omp parallel for
+        for (int i = 0; i < static_cast<int>(inputs.size()); i++)
+        {
+            betas[i] = BetaHohenbichler(inputs[i].Beta1, inputs[i].Beta2, inputs[i].Rho, system);
+        }
+
+        return betas;
     }
 
-    double HohenbichlerNumInt::Hohenbichler(const double dp1, const double dp2, const double rho, const combineAndOr system)
+    double HohenbichlerNumInt::BetaHohenbichler(double dp1, double dp2, const double rho, const combineAndOr system) const
     {
+        if (dp1 > dp2)
+        {
+            std::swap(dp1, dp2);
+        }
+
         constexpr double maxDiffRho = 1e-10;
 
         if (NumericSupport::areEqual(rho, 1.0, maxDiffRho))
@@ -159,66 +173,90 @@ namespace Deltares::Reliability
 
         // otherwise: start Hohenbichler procedure
 
-        double pCond = 0;
-        double rhoCompl = sqrt(1.0 - rho * rho);
-
-        if (-dp2 > -StandardNormal::UMax)
+        if (UseTable)
         {
-            const int ngridPerBeta = 1000;
-            int ngrid = (int)round((-dp2 + StandardNormal::UMax) * ngridPerBeta) + 1; // number of grids for numerical integration
+            const double betaBoth = HohenbichlerTable::getTable().getBetaBoth(dp1, dp2, rho);
+            if (!std::isnan(betaBoth))
+            {
+                return getBetaFromProbabilityBoth(StandardNormal::getQFromU(betaBoth), dp1, dp2, system);
+            }
+        }
 
-            auto u = NumericSupport::LinearSpaced(ngrid, -StandardNormal::UMax, -dp2); // grid end points
+        return getBetaFromProbabilityBoth(getProbabilityBoth(dp1, dp2, rho), dp1, dp2, system);
+    }
 
-            auto uCentered = std::vector<double>(); // grid centers
-            auto uDiff = std::vector<double>();
+    double HohenbichlerNumInt::getProbabilityBoth(double beta1, double beta2, double rho)
+    {
+        const double upper = -beta2;
 
-            for (size_t i = 0; i < u.size() - 1; i++)
-            {
-                uCentered.push_back((u[i] + u[i + 1]) / 2);
-                uDiff.push_back(u[i + 1] - u[i]);
-            }
+        if (upper <= -StandardNormal::UMax)
+        {
+            return 0.0;
+        }
 
-            double pTotal = 0;
+        const std::vector<double>& gridProbabilities = getGridProbabilities();
+        const size_t nGrid = gridProbabilities.size() - 1;
 
-            for (size_t i = 0; i < uCentered.size(); i++)
-            {
-                double prob = StandardNormal::getPFromU(-(dp1 + rho * uCentered[i]) / rhoCompl);
-                double pRange = StandardNormal::getPFromU(u[i + 1]) - StandardNormal::getPFromU(u[i]);
-                pTotal += pRange * prob;
-            }
+        // full grid cells below the upper limit, the remainder is integrated as one partial cell
+        const size_t nCells = std::min(nGrid, static_cast<size_t>(std::floor((upper + StandardNormal::UMax) / GridStep)));
+        const double lastNode = -StandardNormal::UMax + static_cast<double>(nCells) * GridStep;
+
+        const double rhoCompl = sqrt(1.0 - rho * rho);
+
+        // probability of u1 < -beta1 at the grid centers, conditional on u2
+        std::vector<double> conditional(nCells + 1);
+        for (size_t i = 0; i < nCells; i++)
+        {
+            const double uCentered = -StandardNormal::UMax + (static_cast<double>(i) + 0.5) * GridStep;
+            conditional[i] = -(beta1 + rho * uCentered) / rhoCompl;
+        }
+        conditional[nCells] = -(beta1 + rho * (lastNode + upper) / 2) / rhoCompl;
 
-            pCond = pTotal / StandardNormal::getPFromU(-dp2);
+        StandardNormal::getPFromU(conditional.data(), conditional.data(), conditional.size());
 
-            pCond = std::min(1.0, pCond);
+        double pTotal = 0;
+        for (size_t i = 0; i < nCells; i++)
+        {
+            pTotal += (gridProbabilities[i + 1] - gridProbabilities[i]) * conditional[i];
         }
 
-        double PfAND = pCond * StandardNormal::getQFromU(dp2);
+        const double pUpper = StandardNormal::getPFromU(upper);
+        pTotal += (pUpper - gridProbabilities[nCells]) * conditional[nCells];
+
+        const double pCond = std::min(1.0, pTotal / pUpper);
+
+        return pCond * StandardNormal::getQFromU(beta2);
+    }
 
+    double HohenbichlerNumInt::getBetaFromProbabilityBoth(double probabilityBoth, double dp1, double dp2, const combineAndOr system)
+    {
         if (system == combineAndOr::combAnd)
         {
-            double betaAND = StandardNormal::getUFromP(1.0 - PfAND);
+            double betaAND = StandardNormal::getUFromP(1.0 - probabilityBoth);
             return betaAND;
         }
         else
         {
             // compute P(Z1<0 OR PZ2<0)
-            double PfOR = StandardNormal::getPFromU(-dp1) + StandardNormal::getQFromU(dp2) - PfAND;
+            double PfOR = StandardNormal::getPFromU(-dp1) + StandardNormal::getQFromU(dp2) - probabilityBoth;
             double betaOR = StandardNormal::getUFromP(1.0 - PfOR);
             return betaOR;
         }
     }
 
-    DesignPoint HohenbichlerNumInt::GetRealization(const double beta, const std::vector<std::shared_ptr<StochastPointAlpha>>& alphas)
+    const std::vector<double>& HohenbichlerNumInt::getGridProbabilities()
     {
-        DesignPoint dp;
-        dp.Beta = beta;
-
-        for (const auto& alpha : alphas)
+        static const std::vector<double> gridProbabilities = []()
         {
-            dp.Alphas.push_back(alpha->clone());
-        }
+            const int nGrid = static_cast<int>(std::round(2 * StandardNormal::UMax / GridStep));
 
-        return dp;
+            std::vector<double> probabilities = NumericSupport::LinearSpaced(nGrid + 1, -StandardNormal::UMax, StandardNormal::UMax);
+            StandardNormal::getPFromU(probabilities.data(), probabilities.data(), probabilities.size());
+
+            return probabilities;
+        }();
+
+        return gridProbabilities;
     }
 
     DesignPoint HohenbichlerNumInt::GetRealization(const double beta, const std::vector<std::shared_ptr<StochastPointAlpha>>& alphas, const std::vector<double>& values)
@@ -29,17 +29,58 @@
 
 namespace Deltares::Reliability
 {
+    /**
+     * \brief Reliability indices and correlation of two design points to be combined
+     */
+    struct HohenbichlerInput
+    {
+        double Beta1 = 0.0;
+        double Beta2 = 0.0;
+        double Rho = 0.0;
+    };
+
     class HohenbichlerNumInt
     {
     public:
+        /**
+         * \brief Indicates whether combined reliability indices are interpolated in a precomputed table when possible
+         * \remark See HohenbichlerTable for the accuracy of the table
+         */
+        bool UseTable = false;
+
         std::shared_ptr<DesignPoint> AlphaHohenbichler(const std::shared_ptr<DesignPoint>& designPoint1, const std::shared_ptr<DesignPoint>& designPoint2,
             const std::vector<std::shared_ptr<Statistics::Stochast>>& stochasts,
-            const std::shared_ptr<Statistics::SelfCorrelationMatrix>& selfCorrelation, const combineAndOr system);
+            const std::shared_ptr<Statistics::SelfCorrelationMatrix>& selfCorrelation, const combineAndOr system) const;
+
+        /**
+         * \brief Gets the combined reliability indices for a number of pairs of reliability indices
+         * \param inputs Reliability indices and correlations of the pairs
+         * \param system Series (or-combination) or parallel (and-combination)
+         * \return Combined reliability index per pair
+         * \remark All pairs are integrated on the same grid, so small differences between pairs are not blurred by differences in discretization
+         */
+        std::vector<double> BetaHohenbichler(const std::vector<HohenbichlerInput>& inputs, const combineAndOr system) const;
+
+        /**
+         * \brief Gets the probability that both u1 < -beta1 and u2 < -beta2, where u1 and u2 are standard normal with correlation rho
+         * \remark Integrated numerically over u2, so beta1 should not exceed beta2 for best accuracy, rho should not be -1 or 1
+         */
+        static double getProbabilityBoth(double beta1, double beta2, double rho);
+
+        /**
+         * \brief Gets the standard normal non-exceeding probabilities at the nodes of the integration grid
+         * \remark The grid runs from -UMax to UMax with step GridStep and is shared by all computations
+         */
+        static const std::vector<double>& getGridProbabilities();
+
+        /**
+         * \brief Step size of the integration grid
+         */
+        static constexpr double GridStep = 0.001;
 
     private:
-        static double BetaHohenbichler(double dp1, double dp2, const double rho, const combineAndOr system);
-        static double Hohenbichler(const double dp1, const double dp2, const double rho, const combineAndOr system);
-        static DesignPoint GetRealization(const double beta, const std::vector<std::shared_ptr<Models::StochastPointAlpha>>& alphas);
+        double BetaHohenbichler(double dp1, double dp2, const double rho, const combineAndOr system) const;
+        static double getBetaFromProbabilityBoth(double probabilityBoth, double dp1, double dp2, const combineAndOr system);
         static DesignPoint GetRealization(const double beta, const std::vector<std::shared_ptr<Models::StochastPointAlpha>>& alphas, const std::vector<double>& values);
     };
 }
@@ -45,6 +45,7 @@ namespace Deltares::Reliability
 
         auto designPoint = std::make_shared<DesignPoint>();
         auto hh = HohenbichlerNumInt();
+        hh.UseTable = UseTable;
         while (!workDesignPoints.empty())
         {
             const auto [i1max, i2max] = findMaxCorrelatedDesignPoints(workDesignPoints, selfCorrelationMatrix, stochasts);
@@ -30,6 +30,11 @@ namespace Deltares::Reliability
     class HohenbichlerNumIntCombiner : public Combiner
     {
     public:
+        /**
+         * \brief Indicates whether combined reliability indices are interpolated in a precomputed table when possible
+         */
+        bool UseTable = false;
+
         std::shared_ptr<DesignPoint> combineDesignPoints(combineAndOr combineMethodType,
             std::vector<std::shared_ptr<DesignPoint>>& designPoints,
             const std::shared_ptr<Statistics::SelfCorrelationMatrix>& selfCorrelationMatrix,
@@ -0,0 +1,150 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "HohenbichlerTable.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "HohenbichlerNumInt.h"
+#include "../Statistics/StandardNormal.h"
+
+namespace Deltares::Reliability
+{
+    using namespace Deltares::Statistics;
+
+    const HohenbichlerTable& HohenbichlerTable::getTable()
+    {
+        static const HohenbichlerTable table;
+        return table;
+    }
+
+    HohenbichlerTable::HohenbichlerTable()
+    {
+        nBeta = static_cast<int>(std::round((BetaMaximum - BetaMinimum) / BetaStep)) + 1;
+        nRho = static_cast<int>(std::round((RhoMaximum - RhoMinimum) / RhoStep)) + 1;
+
+        betaBoth.resize(static_cast<size_t>(nRho) * nBeta * nBeta);
+
+        const std::vector<double>& gridProbabilities = HohenbichlerNumInt::getGridProbabilities();
+        const double gridStep = HohenbichlerNumInt::GridStep;
+
+        // number of grid cells per table step and up to the first table node, which has the lowest upper limit -beta2
+        const int cellsPerStep = static_cast<int>(std::round(BetaStep / gridStep));
+        const int cellsToFirst = static_cast<int>(std::round((StandardNormal::UMax - BetaMaximum) / gridStep));
+        const int nCells = cellsToFirst + (nBeta - 1) * cellsPerStep;
+
+        // the integral of all beta2 values is built up in one pass over the grid for each combination of rho and beta1
+#pragma omp parallel for
+        for (int row = 0; row < nRho * nBeta; row++)
+        {
+            const double rho = RhoMinimum + (row / nBeta) * RhoStep;
+            const double beta1 = BetaMinimum + (row % nBeta) * BetaStep;
+            const double rhoCompl = std::sqrt(1.0 - rho * rho);
+
+            std::vector<double> conditional(nCells);
+            for (int i = 0; i < nCells; i++)
+            {
+                const double uCentered = -StandardNormal::UMax + (i + 0.5) * gridStep;
+                conditional[i] = -(beta1 + rho * uCentered) / rhoCompl;
+            }
+
+            StandardNormal::getPFromU(conditional.data(), conditional.data(), conditional.size());
+
+            double pTotal = 0;
+            int cell = 0;
+
+            // upper limit -beta2 increases, so beta2 decreases
+            for (int i2 = nBeta - 1; i2 >= 0; i2--)
+            {
+                const int lastCell = cellsToFirst + (nBeta - 1 - i2) * cellsPerStep;
+                for (; cell < lastCell; cell++)
+                {
+                    pTotal += (gridProbabilities[cell + 1] - gridProbabilities[cell]) * conditional[cell];
+                }
+
+                const double beta2 = BetaMinimum + i2 * BetaStep;
+                const double pCond = std::min(1.0, pTotal / StandardNormal::getPFromU(-beta2));
+                const double probabilityBoth = pCond * StandardNormal::getQFromU(beta2);
+
+                betaBoth[static_cast<size_t>(row) * nBeta + i2] = StandardNormal::getUFromQ(probabilityBoth);
+            }
+        }
+    }
+
+    double HohenbichlerTable::getBetaBoth(double beta1, double beta2, double rho) const
+    {
+        if (!(beta1 >= BetaMinimum && beta1 <= BetaMaximum && beta2 >= BetaMinimum && beta2 <= BetaMaximum && rho >= RhoMinimum && rho <= RhoMaximum))
+        {
+            return std::nan("");
+        }
+
+        double weights1[4];
+        double weights2[4];
+        double weightsRho[4];
+
+        const int i1 = getInterpolationWeights((beta1 - BetaMinimum) / BetaStep, nBeta, weights1);
+        const int i2 = getInterpolationWeights((beta2 - BetaMinimum) / BetaStep, nBeta, weights2);
+        const int ir = getInterpolationWeights((rho - RhoMinimum) / RhoStep, nRho, weightsRho);
+
+        double value = 0;
+        for (int dr = 0; dr < 4; dr++)
+        {
+            for (int d1 = 0; d1 < 4; d1++)
+            {
+                for (int d2 = 0; d2 < 4; d2++)
+                {
+                    const double node = getValue(ir + dr, i1 + d1, i2 + d2);
+
+                    // very small probabilities are not tabulated accurately
+                    if (node > StandardNormal::UMax)
+                    {
+                        return std::nan("");
+                    }
+
+                    value += weightsRho[dr] * weights1[d1] * weights2[d2] * node;
+                }
+            }
+        }
+
+        return value;
+    }
+
+    /**
+     * \brief Gets the weights of cubic Lagrange interpolation between four nodes
+     * \param x Position in units of the table step, measured from the first node
+     * \param n Number of nodes
+     * \param weights Will be filled with the weights of the four nodes
+     * \return Index of the first of the four nodes
+     */
+    int HohenbichlerTable::getInterpolationWeights(double x, int n, double weights[4])
+    {
+        const int first = std::clamp(static_cast<int>(std::floor(x)) - 1, 0, n - 4);
+        const double t = x - first;
+
+        weights[0] = -(t - 1) * (t - 2) * (t - 3) / 6;
+        weights[1] = t * (t - 2) * (t - 3) / 2;
+        weights[2] = -t * (t - 1) * (t - 3) / 2;
+        weights[3] = t * (t - 1) * (t - 2) / 6;
+
+        return first;
+    }
+}
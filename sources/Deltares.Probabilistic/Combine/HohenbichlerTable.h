@@ -0,0 +1,91 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace Deltares::Reliability
+{
+    /**
+     * \brief Precomputed reliability indices of the probability that two correlated standard normal variables both exceed their reliability index
+     * \remark The table is computed with the numerical integration of HohenbichlerNumInt and interpolated with cubic polynomials in both reliability
+     *         indices and the correlation. Within the range of the table, the interpolated reliability index deviates at most 0.001 from the integrated one.
+     */
+    class HohenbichlerTable
+    {
+    public:
+        /**
+         * \brief Gets the table, which is computed at the first call
+         */
+        static const HohenbichlerTable& getTable();
+
+        /**
+         * \brief Gets the reliability index of the probability that both u1 < -beta1 and u2 < -beta2, where u1 and u2 have correlation rho
+         * \return Interpolated reliability index, nan if the arguments are out of range of the table
+         */
+        double getBetaBoth(double beta1, double beta2, double rho) const;
+
+        /**
+         * \brief Minimum reliability index in the table
+         */
+        static constexpr double BetaMinimum = 0.0;
+
+        /**
+         * \brief Maximum reliability index in the table
+         */
+        static constexpr double BetaMaximum = 7.0;
+
+        /**
+         * \brief Step size of the reliability indices in the table
+         */
+        static constexpr double BetaStep = 0.1;
+
+        /**
+         * \brief Minimum correlation in the table, the reliability index increases too steeply for stronger negative correlations
+         */
+        static constexpr double RhoMinimum = -0.7;
+
+        /**
+         * \brief Maximum correlation in the table
+         */
+        static constexpr double RhoMaximum = 0.95;
+
+        /**
+         * \brief Step size of the correlations in the table
+         */
+        static constexpr double RhoStep = 0.05;
+
+    private:
+        HohenbichlerTable();
+
+        int nBeta = 0;
+        int nRho = 0;
+        std::vector<double> betaBoth;
+
+        double getValue(int iRho, int i1, int i2) const
+        {
+            return betaBoth[(static_cast<size_t>(iRho) * nBeta + i1) * nBeta + i2];
+        }
+
+        static int getInterpolationWeights(double x, int n, double weights[4]);
+    };
+}
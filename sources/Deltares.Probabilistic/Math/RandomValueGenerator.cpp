@@ -25,10 +25,11 @@
 
 namespace Deltares::Numeric
 {
-    void RandomValueGenerator::initialize(bool repeatable, int seed, time_t fixedTimeStamp)
+    void RandomValueGenerator::initialize(bool repeatable, int seed, time_t fixedTimeStamp, RandomGeneratorType generatorType)
     {
         repeatable_ = repeatable;
         seed_ = seed;
+        generatorType_ = generatorType;
 
         if (!repeatable)
         {
@@ -53,11 +54,92 @@ namespace Deltares::Numeric
 
     double RandomValueGenerator::next()
     {
+        if (generatorType_ == RandomGeneratorType::Philox)
+        {
+            return getValue(position++);
+        }
+
+        position++;
+
         std::uniform_real_distribution<double> distribution(0.0, 1.0);
         double ri = distribution(generator);
         return ri;
     }
 
+    double RandomValueGenerator::getValue(std::uint64_t index) const
+    {
+        if (generatorType_ != RandomGeneratorType::Philox)
+        {
+            throw Reliability::probLibException("Random values can only be retrieved by index for a counter based generator");
+        }
+
+        // 53 most significant bits, uniform in [0, 1)
+        constexpr double scale = 1.0 / 9007199254740992.0;
+        return static_cast<double>(philox(index, key) >> 11) * scale;
+    }
+
+    void RandomValueGenerator::setPosition(std::uint64_t index)
+    {
+        if (generatorType_ == RandomGeneratorType::Philox)
+        {
+            position = index;
+        }
+        else
+        {
+            // each random value consumes one value of the mersenne twister
+            if (index < position)
+            {
+                restart();
+            }
+
+            generator.discard(index - position);
+            position = index;
+        }
+    }
+
+    /**
+     * \brief Philox-4x32-10 counter based random generator (Salmon et al., 2011)
+     * \param counter Counter, i.e. the index of the random value
+     * \param key Key derived from the seed
+     * \returns The first 64 bits of the random block
+     */
+    std::uint64_t RandomValueGenerator::philox(std::uint64_t counter, std::uint64_t key)
+    {
+        constexpr std::uint32_t multiplier0 = 0xD2511F53;
+        constexpr std::uint32_t multiplier1 = 0xCD9E8D57;
+        constexpr std::uint32_t weyl0 = 0x9E3779B9;
+        constexpr std::uint32_t weyl1 = 0xBB67AE85;
+        constexpr int rounds = 10;
+
+        std::uint32_t c0 = static_cast<std::uint32_t>(counter);
+        std::uint32_t c1 = static_cast<std::uint32_t>(counter >> 32);
+        std::uint32_t c2 = 0;
+        std::uint32_t c3 = 0;
+        std::uint32_t k0 = static_cast<std::uint32_t>(key);
+        std::uint32_t k1 = static_cast<std::uint32_t>(key >> 32);
+
+        for (int round = 0; round < rounds; round++)
+        {
+            const std::uint64_t product0 = static_cast<std::uint64_t>(multiplier0) * c0;
+            const std::uint64_t product1 = static_cast<std::uint64_t>(multiplier1) * c2;
+
+            const std::uint32_t hi0 = static_cast<std::uint32_t>(product0 >> 32);
+            const std::uint32_t lo0 = static_cast<std::uint32_t>(product0);
+            const std::uint32_t hi1 = static_cast<std::uint32_t>(product1 >> 32);
+            const std::uint32_t lo1 = static_cast<std::uint32_t>(product1);
+
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+
+            k0 += weyl0;
+            k1 += weyl1;
+        }
+
+        return (static_cast<std::uint64_t>(c0) << 32) | c1;
+    }
+
     void RandomValueGenerator::restart()
     {
         initializeGenerator(repeatable_, seed_, timeStamp);
@@ -65,13 +147,17 @@ namespace Deltares::Numeric
 
     void RandomValueGenerator::initializeGenerator(bool repeatable, int seed, time_t timeStamp)
     {
+        position = 0;
+
         if (repeatable)
         {
             generator.seed(seed);
+            key = static_cast<std::uint64_t>(static_cast<std::uint32_t>(seed));
         }
         else
         {
             generator.seed(timeStamp);
+            key = static_cast<std::uint64_t>(timeStamp);
         }
     }
 }
@@ -21,9 +21,26 @@
 //
 #pragma once
 #include <random>
+#include <cstdint>
 
 namespace Deltares::Numeric
 {
+    /**
+     * \brief Algorithm to generate random values
+     */
+    enum class RandomGeneratorType
+    {
+        /**
+         * \brief Sequential Mersenne twister generator
+         */
+        MersenneTwister,
+
+        /**
+         * \brief Counter based Philox-4x32-10 generator, random values can be retrieved by their index
+         */
+        Philox
+    };
+
     class RandomValueGenerator
     {
     private:
@@ -31,19 +48,33 @@ namespace Deltares::Numeric
         int seed_ = 0;
         time_t timeStamp = 0;
         time_t lastGeneratedTimeStamp = 0;
+        RandomGeneratorType generatorType_ = RandomGeneratorType::MersenneTwister;
 
         std::mt19937_64 generator;
 
+        /**
+         * \brief Key of the counter based generator
+         */
+        std::uint64_t key = 0;
+
+        /**
+         * \brief Index of the next random value
+         */
+        std::uint64_t position = 0;
+
         void initializeGenerator(bool repeatable, int seed, time_t timeStamp);
 
+        static std::uint64_t philox(std::uint64_t counter, std::uint64_t key);
+
     public:
         /**
          * \brief Initializes the random value generator
          * \param repeatable Indicates whether each time this method is called, subsequent calls to the random generator produces equal results
          * \param seed Seed value needed for random generation
          * \param fixedTimeStamp The time stamp to be used if not repeatable, 0 will generate a new time stamp 
+         * \param generatorType Algorithm to generate random values
          */
-        void initialize(bool repeatable = true, int seed = 0, time_t fixedTimeStamp = 0);
+        void initialize(bool repeatable = true, int seed = 0, time_t fixedTimeStamp = 0, RandomGeneratorType generatorType = RandomGeneratorType::MersenneTwister);
 
         /**
          * \brief Retrieves the next random value
@@ -51,6 +82,31 @@ namespace Deltares::Numeric
          */
         double next();
 
+        /**
+         * \brief Indicates whether random values can be retrieved by their index without generating the preceding values
+         */
+        bool isRandomAccessible() const { return generatorType_ == RandomGeneratorType::Philox; }
+
+        /**
+         * \brief Retrieves the random value at a given index in the sequence, without changing the state of the generator
+         * \param index Index of the random value
+         * \returns Random value
+         * \remark Only available if the generator is random accessible, can be called from parallel threads
+         */
+        double getValue(std::uint64_t index) const;
+
+        /**
+         * \brief Gets the index of the next random value
+         */
+        std::uint64_t getPosition() const { return position; }
+
+        /**
+         * \brief Sets the index of the next random value
+         * \param index Index of the next random value
+         * \remark Costs O(1) for a random accessible generator, otherwise all preceding values are generated
+         */
+        void setPosition(std::uint64_t index);
+
         /**
          * \brief Restarts the random value generator, so that same random values are generated (even if repeatable is false)
          */
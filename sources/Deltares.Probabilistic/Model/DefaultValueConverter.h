@@ -41,6 +41,14 @@ namespace Deltares::Models
                 sample->Z = sample->OutputValues[0];
             }
         }
+
+        void updateZValues(SampleBatch& batch) override
+        {
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                batch.Z[i] = batch.getOutputSize() == 0 ? std::nan("") : batch.getOutputValues(i)[0];
+            }
+        }
     };
 }
 
@@ -0,0 +1,84 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "EvaluationList.h"
+
+#include <algorithm>
+
+#include "../Utils/probLibException.h"
+
+namespace Deltares::Models
+{
+    std::shared_ptr<Evaluation> EvaluationList::operator[](size_t index) const
+    {
+        if (index >= count)
+        {
+            throw Reliability::probLibException("Evaluation index out of range");
+        }
+
+        const size_t segmentIndex = static_cast<size_t>(std::upper_bound(segmentStarts.begin(), segmentStarts.end(), index) - segmentStarts.begin()) - 1;
+        const Segment& segment = segments[segmentIndex];
+
+        return segment.store != nullptr
+            ? segment.store->getEvaluation(segment.start + index - segmentStarts[segmentIndex])
+            : segment.evaluation;
+    }
+
+    void EvaluationList::push_back(const std::shared_ptr<Evaluation>& evaluation)
+    {
+        addSegment(Segment{ nullptr, 0, 1, evaluation });
+    }
+
+    void EvaluationList::append(const std::shared_ptr<EvaluationStore>& store)
+    {
+        if (store != nullptr)
+        {
+            addSegment(Segment{ store, 0, store->size(), nullptr });
+        }
+    }
+
+    void EvaluationList::append(const EvaluationList& other)
+    {
+        // copy the segments rather than the evaluations, so that evaluations in a store remain lazy
+        const std::vector<Segment> otherSegments = other.segments;
+        for (const Segment& segment : otherSegments)
+        {
+            addSegment(segment);
+        }
+    }
+
+    void EvaluationList::addSegment(const Segment& segment)
+    {
+        if (segment.count > 0)
+        {
+            segmentStarts.push_back(count);
+            segments.push_back(segment);
+            count += segment.count;
+        }
+    }
+
+    void EvaluationList::clear()
+    {
+        count = 0;
+        segments.clear();
+        segmentStarts.clear();
+    }
+}
@@ -0,0 +1,119 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "Evaluation.h"
+#include "EvaluationStore.h"
+
+namespace Deltares::Models
+{
+    /**
+     * \brief List of evaluations, which is a view over ranges of evaluation stores and separately added evaluations
+     * \remark Evaluations in a store are created each time they are accessed and are not kept by the list,
+     *         so that the list can be read concurrently and the memory limit of the store is respected
+     */
+    class EvaluationList
+    {
+    public:
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::shared_ptr<Evaluation>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = std::shared_ptr<Evaluation>;
+
+            const_iterator(const EvaluationList* list, size_t index) : list(list), index(index) {}
+
+            reference operator*() const { return (*list)[index]; }
+            const_iterator& operator++() { index++; return *this; }
+            const_iterator operator++(int) { const_iterator copy = *this; index++; return copy; }
+            bool operator==(const const_iterator& other) const { return list == other.list && index == other.index; }
+            bool operator!=(const const_iterator& other) const { return !(*this == other); }
+        private:
+            const EvaluationList* list;
+            size_t index;
+        };
+
+        /**
+         * \brief Number of evaluations
+         */
+        size_t size() const { return count; }
+
+        /**
+         * \brief Indicates whether the list contains no evaluations
+         */
+        bool empty() const { return count == 0; }
+
+        /**
+         * \brief Gets the evaluation at a given index
+         */
+        std::shared_ptr<Evaluation> operator[](size_t index) const;
+
+        /**
+         * \brief Adds an evaluation
+         */
+        void push_back(const std::shared_ptr<Evaluation>& evaluation);
+
+        /**
+         * \brief Adds all evaluations in a store at this moment
+         */
+        void append(const std::shared_ptr<EvaluationStore>& store);
+
+        /**
+         * \brief Adds all evaluations of another list
+         */
+        void append(const EvaluationList& other);
+
+        /**
+         * \brief Removes all evaluations
+         */
+        void clear();
+
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, count); }
+
+    private:
+        /**
+         * \brief Range of evaluations in a store or a single evaluation
+         */
+        struct Segment
+        {
+            std::shared_ptr<EvaluationStore> store = nullptr;
+            size_t start = 0;
+            size_t count = 0;
+            std::shared_ptr<Evaluation> evaluation = nullptr;
+        };
+
+        size_t count = 0;
+        std::vector<Segment> segments;
+        std::vector<size_t> segmentStarts;
+
+        void addSegment(const Segment& segment);
+    };
+}
@@ -0,0 +1,310 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "EvaluationStore.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <random>
+
+#include "../Utils/probLibException.h"
+
+namespace Deltares::Models
+{
+    static std::atomic<size_t> storeCounter = 0;
+
+    EvaluationStore::EvaluationStore(size_t spillSize, const std::string& spillDirectory)
+    {
+        this->id = ++storeCounter;
+        this->spillSize = spillSize;
+        this->spillDirectory = spillDirectory;
+    }
+
+    EvaluationStore::~EvaluationStore()
+    {
+        mappedFile = nullptr;
+
+        if (spillStream.is_open())
+        {
+            spillStream.close();
+            std::error_code errorCode;
+            std::filesystem::remove(spillFileName, errorCode);
+        }
+
+        delete locker;
+    }
+
+    void EvaluationStore::add(const ModelSample& sample)
+    {
+        add(Row{ sample.Z, std::nan(""), sample.Beta, sample.Weight, sample.IterationIndex, sample.Tag, sample.UsedProxy,
+            sample.Values.data(), sample.Values.size(), sample.OutputValues.data(), sample.OutputValues.size() });
+    }
+
+    void EvaluationStore::add(const SampleBatch& batch, int index)
+    {
+        add(Row{ batch.Z[index], std::nan(""), batch.Beta[index], batch.Weight[index], batch.IterationIndex[index], batch.Tag[index],
+            batch.UsedProxy[index] != 0, batch.getXValues(index), static_cast<size_t>(batch.getInputSize()),
+            batch.getOutputValues(index), static_cast<size_t>(batch.getOutputSize()) });
+    }
+
+    void EvaluationStore::add(const Evaluation& evaluation)
+    {
+        add(Row{ evaluation.Z, evaluation.Quantile, evaluation.Beta, evaluation.Weight, evaluation.Iteration, evaluation.Tag, evaluation.usedProxy,
+            evaluation.InputValues.data(), evaluation.InputValues.size(), evaluation.OutputValues.data(), evaluation.OutputValues.size() });
+    }
+
+    void EvaluationStore::add(const Row& row)
+    {
+        Block* block = getThreadBlock();
+
+        if (block->count > 0 && (block->count >= BlockSize || block->inputSize != row.inputSize || block->outputSize != row.outputSize))
+        {
+            std::lock_guard<Utils::Locker> guard(*locker);
+            commit(threadBlocks[std::this_thread::get_id()]);
+
+            block = getThreadBlock();
+        }
+
+        if (block->count == 0)
+        {
+            block->inputSize = row.inputSize;
+            block->outputSize = row.outputSize;
+            block->inputValues.reserve(BlockSize * row.inputSize);
+            block->outputValues.reserve(BlockSize * row.outputSize);
+        }
+
+        block->z.push_back(row.z);
+        block->quantile.push_back(row.quantile);
+        block->beta.push_back(row.beta);
+        block->weight.push_back(row.weight);
+        block->iteration.push_back(row.iteration);
+        block->tag.push_back(row.tag);
+        block->usedProxy.push_back(row.usedProxy ? 1 : 0);
+        block->inputValues.insert(block->inputValues.end(), row.inputValues, row.inputValues + row.inputSize);
+        block->outputValues.insert(block->outputValues.end(), row.outputValues, row.outputValues + row.outputSize);
+        block->count++;
+    }
+
+    EvaluationStore::Block* EvaluationStore::getThreadBlock()
+    {
+        // the block of the current thread is cached, so that the lock is only needed for the first evaluation of a thread
+        thread_local size_t cachedId = 0;
+        thread_local std::unique_ptr<Block>* cachedBlock = nullptr;
+
+        if (cachedId != this->id || cachedBlock == nullptr || *cachedBlock == nullptr)
+        {
+            std::lock_guard<Utils::Locker> guard(*locker);
+            std::unique_ptr<Block>& block = threadBlocks[std::this_thread::get_id()];
+            if (block == nullptr)
+            {
+                block = std::make_unique<Block>();
+            }
+
+            cachedId = this->id;
+            cachedBlock = &block;
+        }
+
+        return cachedBlock->get();
+    }
+
+    void EvaluationStore::commit(std::unique_ptr<Block>& block)
+    {
+        if (block == nullptr || block->count == 0)
+        {
+            return;
+        }
+
+        blockStarts.push_back(blocks.empty() ? 0 : blockStarts.back() + blocks.back()->count);
+        memorySize += block->getByteSize();
+        blocks.push_back(std::move(block));
+        block = std::make_unique<Block>();
+
+        if (spillSize > 0)
+        {
+            for (size_t i = spilledBlocks; i < blocks.size() && memorySize > spillSize; i++)
+            {
+                spill(*blocks[i]);
+            }
+        }
+    }
+
+    void EvaluationStore::flush()
+    {
+        std::lock_guard<Utils::Locker> guard(*locker);
+        for (auto& [threadId, block] : threadBlocks)
+        {
+            commit(block);
+        }
+    }
+
+    size_t EvaluationStore::Block::getByteSize() const
+    {
+        const size_t size = count * ((4 + inputSize + outputSize) * sizeof(double) + 2 * sizeof(int) + sizeof(char));
+
+        // blocks in the file start at a multiple of eight bytes
+        return (size + 7) / 8 * 8;
+    }
+
+    void EvaluationStore::spill(Block& block)
+    {
+        if (!spillStream.is_open())
+        {
+            const std::filesystem::path directory = spillDirectory.empty() ? std::filesystem::temp_directory_path() : std::filesystem::path(spillDirectory);
+            std::random_device random;
+            spillFileName = (directory / ("evaluations_" + std::to_string(random()) + "_" + std::to_string(id) + ".bin")).string();
+
+            spillStream.open(spillFileName, std::ios::binary | std::ios::trunc);
+            if (!spillStream.is_open())
+            {
+                throw Reliability::probLibException("Evaluations file can not be created: " + spillFileName);
+            }
+
+            mappedFile = std::make_unique<Utils::MappedFile>(spillFileName);
+        }
+
+        const size_t byteSize = block.getByteSize();
+        size_t written = 0;
+
+        auto write = [this, &written](const auto& values)
+        {
+            const size_t size = values.size() * sizeof(values[0]);
+            spillStream.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(size));
+            written += size;
+        };
+
+        write(block.z);
+        write(block.quantile);
+        write(block.beta);
+        write(block.weight);
+        write(block.inputValues);
+        write(block.outputValues);
+        write(block.iteration);
+        write(block.tag);
+        write(block.usedProxy);
+        write(std::vector<char>(byteSize - written, 0));
+
+        spillStream.flush();
+        if (!spillStream.good())
+        {
+            throw Reliability::probLibException("Evaluations can not be written to " + spillFileName);
+        }
+
+        block.fileOffset = fileSize;
+        block.spilled = true;
+        fileSize += byteSize;
+        memorySize -= byteSize;
+        spilledBlocks++;
+
+        block.z = std::vector<double>();
+        block.quantile = std::vector<double>();
+        block.beta = std::vector<double>();
+        block.weight = std::vector<double>();
+        block.inputValues = std::vector<double>();
+        block.outputValues = std::vector<double>();
+        block.iteration = std::vector<int>();
+        block.tag = std::vector<int>();
+        block.usedProxy = std::vector<char>();
+    }
+
+    size_t EvaluationStore::size()
+    {
+        std::lock_guard<Utils::Locker> guard(*locker);
+        return getCount();
+    }
+
+    size_t EvaluationStore::getCount() const
+    {
+        return blocks.empty() ? 0 : blockStarts.back() + blocks.back()->count;
+    }
+
+    std::shared_ptr<Evaluation> EvaluationStore::getEvaluation(size_t index)
+    {
+        // blocks may be committed or spilled by other threads
+        std::lock_guard<Utils::Locker> guard(*locker);
+
+        if (index >= getCount())
+        {
+            throw Reliability::probLibException("Evaluation index out of range");
+        }
+
+        const size_t blockIndex = static_cast<size_t>(std::upper_bound(blockStarts.begin(), blockStarts.end(), index) - blockStarts.begin()) - 1;
+
+        return getEvaluation(*blocks[blockIndex], index - blockStarts[blockIndex]);
+    }
+
+    std::shared_ptr<Evaluation> EvaluationStore::getEvaluation(const Block& block, size_t index)
+    {
+        std::shared_ptr<Evaluation> evaluation = std::make_shared<Evaluation>();
+        evaluation->InputValues.resize(block.inputSize);
+        evaluation->OutputValues.resize(block.outputSize);
+
+        if (!block.spilled)
+        {
+            evaluation->Z = block.z[index];
+            evaluation->Quantile = block.quantile[index];
+            evaluation->Beta = block.beta[index];
+            evaluation->Weight = block.weight[index];
+            evaluation->Iteration = block.iteration[index];
+            evaluation->Tag = block.tag[index];
+            evaluation->usedProxy = block.usedProxy[index] != 0;
+            std::copy_n(block.inputValues.data() + index * block.inputSize, block.inputSize, evaluation->InputValues.data());
+            std::copy_n(block.outputValues.data() + index * block.outputSize, block.outputSize, evaluation->OutputValues.data());
+
+            return evaluation;
+        }
+
+        const char* data = mappedFile->getData(block.fileOffset + block.getByteSize()) + block.fileOffset;
+        const size_t n = block.count;
+
+        // same order of columns as in spill()
+        auto read = [data, n](size_t column, size_t width, size_t elementSize, size_t i, void* target)
+        {
+            std::memcpy(target, data + column + i * width * elementSize, width * elementSize);
+        };
+
+        size_t column = 0;
+        read(column, 1, sizeof(double), index, &evaluation->Z);
+        column += n * sizeof(double);
+        read(column, 1, sizeof(double), index, &evaluation->Quantile);
+        column += n * sizeof(double);
+        read(column, 1, sizeof(double), index, &evaluation->Beta);
+        column += n * sizeof(double);
+        read(column, 1, sizeof(double), index, &evaluation->Weight);
+        column += n * sizeof(double);
+        read(column, block.inputSize, sizeof(double), index, evaluation->InputValues.data());
+        column += n * block.inputSize * sizeof(double);
+        read(column, block.outputSize, sizeof(double), index, evaluation->OutputValues.data());
+        column += n * block.outputSize * sizeof(double);
+        read(column, 1, sizeof(int), index, &evaluation->Iteration);
+        column += n * sizeof(int);
+        read(column, 1, sizeof(int), index, &evaluation->Tag);
+        column += n * sizeof(int);
+
+        char usedProxy = 0;
+        read(column, 1, sizeof(char), index, &usedProxy);
+        evaluation->usedProxy = usedProxy != 0;
+
+        return evaluation;
+    }
+}
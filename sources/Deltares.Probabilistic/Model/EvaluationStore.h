@@ -0,0 +1,164 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Evaluation.h"
+#include "ModelSample.h"
+#include "SampleBatch.h"
+#include "../Utils/Locker.h"
+#include "../Utils/MappedFile.h"
+
+namespace Deltares::Models
+{
+    /**
+     * \brief Stores the evaluations of a calculation in a columnar layout
+     * \remark Each thread appends to its own block without locking, full blocks are moved to the store under a lock.
+     *         When the blocks in memory exceed a given size, they are moved to a binary file which is read memory mapped.
+     *         Evaluations become readable after flush(), which should be called when no evaluations are being added, for example at the end of a run.
+     */
+    class EvaluationStore
+    {
+    public:
+        /**
+         * \brief Constructor
+         * \param spillSize Size in bytes of the blocks in memory after which they are moved to a file (0 is never)
+         * \param spillDirectory Directory of the file (empty is the temporary directory)
+         */
+        explicit EvaluationStore(size_t spillSize = 0, const std::string& spillDirectory = "");
+        ~EvaluationStore();
+
+        EvaluationStore(const EvaluationStore&) = delete;
+        EvaluationStore& operator=(const EvaluationStore&) = delete;
+
+        /**
+         * \brief Adds the evaluation of a calculated sample
+         */
+        void add(const ModelSample& sample);
+
+        /**
+         * \brief Adds the evaluation of a calculated sample in a batch
+         */
+        void add(const SampleBatch& batch, int index);
+
+        /**
+         * \brief Adds an evaluation
+         */
+        void add(const Evaluation& evaluation);
+
+        /**
+         * \brief Moves the blocks of all threads to the store, so that their evaluations can be read
+         * \remark Should not be called while evaluations are being added
+         */
+        void flush();
+
+        /**
+         * \brief Number of evaluations moved to the store by flush() or by full blocks
+         */
+        size_t size();
+
+        /**
+         * \brief Creates the evaluation at a given index
+         */
+        std::shared_ptr<Evaluation> getEvaluation(size_t index);
+
+        /**
+         * \brief Indicates whether evaluations have been moved to a file
+         */
+        bool isSpilled() const { return spilledBlocks > 0; }
+
+        /**
+         * \brief Number of evaluations in a block
+         */
+        static constexpr size_t BlockSize = 1024;
+
+    private:
+        /**
+         * \brief Columns of a number of evaluations with the same number of input and output values
+         */
+        struct Block
+        {
+            size_t count = 0;
+            size_t inputSize = 0;
+            size_t outputSize = 0;
+
+            std::vector<double> z;
+            std::vector<double> quantile;
+            std::vector<double> beta;
+            std::vector<double> weight;
+            std::vector<double> inputValues;
+            std::vector<double> outputValues;
+            std::vector<int> iteration;
+            std::vector<int> tag;
+            std::vector<char> usedProxy;
+
+            bool spilled = false;
+            size_t fileOffset = 0;
+
+            size_t getByteSize() const;
+        };
+
+        struct Row
+        {
+            double z;
+            double quantile;
+            double beta;
+            double weight;
+            int iteration;
+            int tag;
+            bool usedProxy;
+            const double* inputValues;
+            size_t inputSize;
+            const double* outputValues;
+            size_t outputSize;
+        };
+
+        size_t id = 0;
+        size_t spillSize = 0;
+        std::string spillDirectory;
+        std::string spillFileName;
+        std::ofstream spillStream;
+        std::unique_ptr<Utils::MappedFile> mappedFile = nullptr;
+        size_t fileSize = 0;
+        size_t memorySize = 0;
+        size_t spilledBlocks = 0;
+
+        std::vector<std::unique_ptr<Block>> blocks;
+        std::vector<size_t> blockStarts;
+        std::unordered_map<std::thread::id, std::unique_ptr<Block>> threadBlocks;
+        Utils::Locker* locker = new Utils::Locker();
+
+        void add(const Row& row);
+        Block* getThreadBlock();
+        void commit(std::unique_ptr<Block>& block);
+        size_t getCount() const;
+        void spill(Block& block);
+        std::shared_ptr<Evaluation> getEvaluation(const Block& block, size_t index);
+    };
+}
@@ -21,11 +21,14 @@
 //
 #include "GradientCalculator.h"
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "GradientSettings.h"
 #include "Sample.h"
 #include "ModelRunner.h"
+#include "../Math/NumericSupport.h"
 #include "../Utils/probLibException.h"
 
 using namespace Deltares::Reliability;
@@ -35,18 +38,127 @@ namespace Deltares::Models
     using enum GradientType;
 
     std::vector<double> GradientCalculator::getGradient(Models::ModelRunner& modelRunner, const std::shared_ptr<Sample>& sample) const
+    {
+        return getGradient(modelRunner, sample, Settings->StepSize, false);
+    }
+
+    std::vector<double> GradientCalculator::getIterativeGradient(Models::ModelRunner& modelRunner, const std::shared_ptr<Sample>& sample)
+    {
+        // the z-value of the previous sample can be reused, for example when a full gradient is required at the same location
+        const bool isCenterKnown = sample->Values == previousValues && !std::isnan(previousZ);
+        if (isCenterKnown)
+        {
+            sample->Z = previousZ;
+        }
+
+        std::vector<double> gradient;
+
+        const bool canUpdate = !previousGradient.empty() && !isCenterKnown &&
+            updatesSinceFullGradient < Settings->FullGradientInterval - 1;
+
+        if (canUpdate)
+        {
+            modelRunner.getZValue(sample);
+
+            if (!std::isnan(sample->Z))
+            {
+                gradient = getUpdatedGradient(sample);
+                updatesSinceFullGradient++;
+                fullGradient = false;
+            }
+        }
+
+        if (gradient.empty())
+        {
+            const double stepSize = getStepSize(sample, isCenterKnown || canUpdate);
+            gradient = getGradient(modelRunner, sample, stepSize, isCenterKnown || canUpdate);
+            updatesSinceFullGradient = 0;
+            fullGradient = true;
+        }
+
+        previousValues = sample->Values;
+        previousZ = sample->Z;
+        previousGradient = gradient;
+
+        return gradient;
+    }
+
+    std::vector<double> GradientCalculator::getUpdatedGradient(const std::shared_ptr<Sample>& sample) const
+    {
+        const size_t nStochasts = previousGradient.size();
+
+        // Broyden rank one update: the updated gradient reproduces the z-difference with the previous sample
+        double stepSquared = 0;
+        double predictedDifference = 0;
+        for (size_t k = 0; k < nStochasts; k++)
+        {
+            const double step = sample->Values[k] - previousValues[k];
+            stepSquared += step * step;
+            predictedDifference += previousGradient[k] * step;
+        }
+
+        std::vector<double> gradient = previousGradient;
+
+        if (stepSquared > 0)
+        {
+            const double factor = (sample->Z - previousZ - predictedDifference) / stepSquared;
+            for (size_t k = 0; k < nStochasts; k++)
+            {
+                gradient[k] += factor * (sample->Values[k] - previousValues[k]);
+            }
+        }
+
+        return gradient;
+    }
+
+    double GradientCalculator::getStepSize(const std::shared_ptr<Sample>& sample, bool isCenterKnown) const
+    {
+        if (!Settings->AdaptiveStepSize || previousGradient.empty())
+        {
+            return Settings->StepSize;
+        }
+
+        // use the known z-value or estimate it with the previous gradient
+        double z = sample->Z;
+        if (!isCenterKnown)
+        {
+            z = previousZ;
+            for (size_t k = 0; k < previousGradient.size(); k++)
+            {
+                z += previousGradient[k] * (sample->Values[k] - previousValues[k]);
+            }
+        }
+
+        const double gradientLength = Numeric::NumericSupport::GetLength(previousGradient);
+        if (std::isnan(z) || std::isnan(gradientLength) || gradientLength == 0)
+        {
+            return Settings->StepSize;
+        }
+
+        // the distance to the limit state is the scale at which z changes sign
+        const double distance = std::fabs(z) / gradientLength;
+
+        return std::clamp(distance, minimumStepSizeFactor * Settings->StepSize, Settings->StepSize);
+    }
+
+    std::vector<double> GradientCalculator::getGradient(Models::ModelRunner& modelRunner, const std::shared_ptr<Sample>& sample, double stepSize, bool isCenterKnown) const
     {
         int nStochasts = modelRunner.getVaryingStochastCount();
 
         std::vector<std::shared_ptr<Sample>> samples;
         std::vector<double> gradient(nStochasts);
 
-        // first sample is the sample itself
-        samples.push_back(sample);
+        // first sample is the sample itself, unless its z-value is known already
+        if (!isCenterKnown)
+        {
+            samples.push_back(sample);
+        }
+
+        const size_t offset = samples.size();
 
         if (Settings->gradientType == OneDirection)
         {
-            double du = Settings->StepSize * 0.5;
+            double du = stepSize * 0.5;
             for (int k = 0; k < nStochasts; k++)
             {
                 std::shared_ptr<Sample> uNew = sample->clone();
@@ -57,10 +169,10 @@ namespace Deltares::Models
 
             std::vector<double> zValues = modelRunner.getZValues(samples);
 
-            double z = zValues[0];
+            double z = sample->Z;
             for (int k = 0; k < nStochasts; k++)
             {
-                double zp = zValues[k + 1];
+                double zp = zValues[k + offset];
                 gradient[k] = (zp - z) / du;
             }
         }
@@ -69,11 +181,11 @@ namespace Deltares::Models
             for (int k = 0; k < nStochasts; k++)
             {
                 std::shared_ptr<Sample> u1 = sample->clone();
-                u1->Values[k] -= Settings->StepSize * 0.5;
+                u1->Values[k] -= stepSize * 0.5;
                 samples.push_back(u1);
 
                 std::shared_ptr<Sample> u2 = sample->clone();
-                u2->Values[k] += Settings->StepSize * 0.5;
+                u2->Values[k] += stepSize * 0.5;
                 samples.push_back(u2);
             }
 
@@ -81,10 +193,10 @@ namespace Deltares::Models
 
             for (int k = 0; k < nStochasts; k++)
             {
-                const double zLow = zValues[2 * k + 1];
-                const double zHigh = zValues[2 * k + 2];
+                const double zLow = zValues[2 * k + offset];
+                const double zHigh = zValues[2 * k + offset + 1];
 
-                gradient[k] = (zHigh - zLow) / Settings->StepSize;
+                gradient[k] = (zHigh - zLow) / stepSize;
             }
         }
         else
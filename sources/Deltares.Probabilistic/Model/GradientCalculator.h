@@ -21,6 +21,7 @@
 //
 #pragma once
 
+#include <cmath>
 #include <vector>
 #include "GradientSettings.h"
 #include "ModelRunner.h"
@@ -48,6 +49,42 @@ namespace Deltares::Models
          * \remarks The z-value of the given sample is calculated too and stored in sample->Z
          */
         std::vector<double> getGradient(Models::ModelRunner& modelRunner, const std::shared_ptr<Sample>& sample) const;
+
+        /**
+         * \brief Calculates the gradient in an iterative procedure, using the results of the previous call where possible
+         * \param modelRunner The model for which the gradient is calculated
+         * \param sample The location at which the gradient is calculated
+         * \return Gradient, vector with size of sample size
+         * \remarks The z-value of the sample is not calculated again when the sample is equal to the sample of the previous call.
+         *          Between finite difference calculations the gradient is updated with a Broyden rank one update, see GradientSettings::FullGradientInterval.
+         */
+        std::vector<double> getIterativeGradient(Models::ModelRunner& modelRunner, const std::shared_ptr<Sample>& sample);
+
+        /**
+         * \brief Indicates whether the last gradient of getIterativeGradient() was calculated by finite differences
+         */
+        bool isFullGradient() const { return fullGradient; }
+
+        /**
+         * \brief Forces the next call of getIterativeGradient() to calculate the gradient by finite differences
+         */
+        void requireFullGradient() { updatesSinceFullGradient = Settings->FullGradientInterval; }
+
+    private:
+        std::vector<double> previousValues;
+        std::vector<double> previousGradient;
+        double previousZ = std::nan("");
+        int updatesSinceFullGradient = 0;
+        bool fullGradient = true;
+
+        /**
+         * \brief Smallest step size of the adaptive step size, relative to the step size in the settings
+         */
+        static constexpr double minimumStepSizeFactor = 0.1;
+
+        std::vector<double> getGradient(Models::ModelRunner& modelRunner, const std::shared_ptr<Sample>& sample, double stepSize, bool isCenterKnown) const;
+        std::vector<double> getUpdatedGradient(const std::shared_ptr<Sample>& sample) const;
+        double getStepSize(const std::shared_ptr<Sample>& sample, bool isCenterKnown) const;
     };
 }
 
@@ -41,9 +41,22 @@ namespace Deltares::Models
         double StepSize = 0.3;
         bool OnlyInitializationAllowed = false;
 
+        /**
+         * \brief Number of iterations in which one gradient is calculated by finite differences
+         * \remark In the other iterations the gradient is updated with a Broyden rank one update, which takes one model run (1 is always finite differences)
+         */
+        int FullGradientInterval = 1;
+
+        /**
+         * \brief Indicates whether the step size is reduced near the limit state
+         * \remark The step size is limited to the distance to the limit state, estimated with the previous gradient, but not less than a tenth of the step size
+         */
+        bool AdaptiveStepSize = false;
+
         void validate(Logging::ValidationReport& report) const
         {
             Logging::ValidationSupport::checkMinimum(report, 0.01, StepSize, "step size");
+            Logging::ValidationSupport::checkMinimumInt(report, 1, FullGradientInterval, "full gradient interval");
         }
 
         static std::string getGradientTypeString(GradientType method);
@@ -24,6 +24,7 @@
 #include "../Math/NumericSupport.h"
 #include "../Statistics/Stochast.h"
 #include <cmath>
+#include <deque>
 
 #include "../Proxies/ProxyModel.h"
 #include <format>
@@ -66,20 +67,19 @@ namespace Deltares::Models
         this->zModel->setMaxProcesses(this->Settings->MaxParallelProcesses);
         this->zModel->setHandleInvalidType(this->Settings->handleInvalidType);
         this->zModel->setAllowRepository(this->Settings->AllowRepository);
+        this->zModel->setMaxRepositorySize(this->Settings->MaxRepositorySize);
         this->zModel->setUseZFromSample(this->Settings->UseZFromSample);
         this->zModel->resetModelRuns();
 
         this->zModel->initializeForRun();
+        this->zModel->setCacheFile(this->Settings->CacheFile, this->Settings->CacheTag);
 
         if (!this->Settings->ReuseCalculations)
         {
             this->zModel->clearRepository();
         }
 
-        if (this->locker == nullptr)
-        {
-            this->locker = new Utils::Locker();
-        }
+        this->evaluations = createEvaluationStore();
 
         if (sampleProvider == nullptr)
         {
@@ -96,7 +96,7 @@ namespace Deltares::Models
     void ModelRunner::clearLists()
     {
         this->reliabilityResults.clear();
-        this->evaluations.clear();
+        this->evaluations = createEvaluationStore();
         this->messages.clear();
     }
 
@@ -252,28 +252,82 @@ namespace Deltares::Models
      */
     std::vector<double> ModelRunner::getZValues(const std::vector<std::shared_ptr<Sample>>& samples)
     {
-        std::vector<std::shared_ptr<ModelSample>> xSamples;
+        SampleBatch batch = SampleBatch::fromSamples(samples);
+
+        std::vector<double> zValues = getZValues(batch);
+
+        batch.updateSamples(samples);
+
+        return zValues;
+    }
+
+    /**
+     * \brief Calculates a batch of samples
+     * \param batch Samples to be calculated, the results are stored in the batch
+     * \return Z-values of the samples
+     */
+    std::vector<double> ModelRunner::getZValues(SampleBatch& batch)
+    {
+        batch.setModelSize(this->uConverter->getStochastCount(), static_cast<int>(this->zModel->outputParameters.size()));
+
+        this->uConverter->getXValues(batch);
 
-        for (const auto& sample : samples)
+        for (int i = 0; i < batch.getSize(); i++)
         {
-            xSamples.push_back(getModelSample(sample));
+            batch.Beta[i] = batch.getBeta(i);
         }
 
-        this->zModel->invoke(xSamples);
+        this->zModel->invoke(batch);
 
-        std::vector<double> zValues(xSamples.size());
+        registerEvaluations(batch);
 
-        for (size_t i = 0; i < xSamples.size(); i++)
-        {
-            registerEvaluation(xSamples[i]);
+        return batch.Z;
+    }
 
-            samples[i]->Z = xSamples[i]->Z;
-            samples[i]->AllowProxy = xSamples[i]->AllowProxy;
-            samples[i]->IsRestartRequired = xSamples[i]->IsRestartRequired;
-            zValues[i] = xSamples[i]->Z;
-        }
+    /**
+     * \brief Indicates whether samples can be calculated as a stream, see getZValuesStreamed()
+     * \return Indication
+     */
+    bool ModelRunner::canStreamZValues() const
+    {
+        return this->Settings->StreamEvaluations && this->zModel->canInvokeStreamed();
+    }
 
-        return zValues;
+    /**
+     * \brief Calculates samples as a stream, a new sample is started as soon as a process becomes available
+     * \param nextSample Provides the next sample to be calculated, returns nullptr when there are no more samples
+     * \param processSample Processes a calculated sample, in the order in which the samples were provided, returns false to stop
+     */
+    void ModelRunner::getZValuesStreamed(const NextSampleLambda& nextSample, const ProcessSampleLambda& processSample)
+    {
+        std::deque<std::shared_ptr<Sample>> providedSamples;
+
+        this->zModel->invokeStreamed(
+            [this, &nextSample, &providedSamples]() -> std::shared_ptr<ModelSample>
+            {
+                std::shared_ptr<Sample> sample = nextSample();
+                if (sample == nullptr)
+                {
+                    return nullptr;
+                }
+
+                providedSamples.push_back(sample);
+                return getModelSample(sample);
+            },
+            [this, &processSample, &providedSamples](const std::shared_ptr<ModelSample>& xSample)
+            {
+                // samples are processed in the order in which they were provided
+                std::shared_ptr<Sample> sample = providedSamples.front();
+                providedSamples.pop_front();
+
+                registerEvaluation(xSample);
+
+                sample->Z = xSample->Z;
+                sample->AllowProxy = xSample->AllowProxy;
+                sample->IsRestartRequired = xSample->IsRestartRequired;
+
+                return processSample(sample);
+            });
     }
 
     /**
@@ -330,21 +384,32 @@ namespace Deltares::Models
     {
         if (this->Settings->SaveEvaluations)
         {
-            std::shared_ptr<Evaluation> evaluation = std::make_shared<Evaluation>(getEvaluationFromSample(sample));
+            this->evaluations->add(*sample);
+        }
+    }
 
-            if (this->Settings->MaxParallelProcesses > 1)
-            {
-                locker->lock();
-                this->evaluations.push_back(evaluation);
-                locker->unlock();
-            }
-            else
+    /**
+     * \brief Registers the evaluations for all samples in a calculated batch
+     * \param batch Calculated batch
+     */
+    void ModelRunner::registerEvaluations(const SampleBatch& batch)
+    {
+        if (this->Settings->SaveEvaluations)
+        {
+            for (int i = 0; i < batch.getSize(); i++)
             {
-                this->evaluations.push_back(evaluation);
+                this->evaluations->add(batch, i);
             }
         }
     }
 
+    std::shared_ptr<EvaluationStore> ModelRunner::createEvaluationStore() const
+    {
+        const size_t spillSize = this->Settings == nullptr ? 0 : static_cast<size_t>(this->Settings->MaxEvaluationsMemory) * 1024 * 1024;
+
+        return std::make_shared<EvaluationStore>(spillSize, this->Settings == nullptr ? "" : this->Settings->EvaluationsDirectory);
+    }
+
     /**
      * \brief Indicates whether the reliability algorithm should be stopped
      * \param samples Already calculated samples
@@ -526,10 +591,8 @@ namespace Deltares::Models
             designPoint->ReliabilityResults.push_back(reliabilityResult);
         }
 
-        for (const auto& value : evaluations)
-        {
-            designPoint->Evaluations.push_back(value);
-        }
+        evaluations->flush();
+        designPoint->Evaluations.append(evaluations);
 
         for (const auto& message : this->messages)
         {
@@ -550,10 +613,8 @@ namespace Deltares::Models
 
         result.stochast = stochast;
 
-        for (const auto& evaluation : evaluations)
-        {
-            result.evaluations.push_back(evaluation);
-        }
+        evaluations->flush();
+        result.evaluations.append(evaluations);
 
         for (const auto& message : messages)
         {
@@ -570,10 +631,8 @@ namespace Deltares::Models
     {
         Sensitivity::SensitivityResult result = uConverter->getSensitivityResult();
 
-        for (const auto& evaluation : evaluations)
-        {
-            result.evaluations.push_back(evaluation);
-        }
+        evaluations->flush();
+        result.evaluations.append(evaluations);
 
         for (const auto& message : messages)
         {
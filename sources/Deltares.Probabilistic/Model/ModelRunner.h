@@ -23,13 +23,13 @@
 #include <string>
 
 #include "Sample.h"
+#include "SampleBatch.h"
 #include <vector>
 
 #include "../Reliability/ReliabilityReport.h"
 #include "../Reliability/ReliabilityResult.h"
 #include "../Reliability/DesignPoint.h"
 #include "../Reliability/StochastSettingsSet.h"
-#include "../Utils/Locker.h"
 #include "SampleProvider.h"
 #include "RunSettings.h"
 #include "UConverter.h"
@@ -37,6 +37,7 @@
 #include "../Logging/Message.h"
 #include "../Proxies/ProxySettings.h"
 #include "ModelSample.h"
+#include "EvaluationStore.h"
 #include "ProgressIndicator.h"
 #include "../Uncertainty/CorrelationMatrixBuilder.h"
 #include "../Uncertainty/UncertaintyResult.h"
@@ -52,6 +53,8 @@ namespace Deltares::Models
     typedef std::function<bool(bool finalCall)> ShouldExitLambda;
     typedef std::function<void(int iterationIndex)> RemoveTaskLambda;
     typedef std::function<bool(int stochastIndex)> ShouldInvertLambda;
+    typedef std::function<std::shared_ptr<Sample>()> NextSampleLambda;
+    typedef std::function<bool(const std::shared_ptr<Sample>& sample)> ProcessSampleLambda;
 
     class ModelRunner
     {
@@ -63,11 +66,6 @@ namespace Deltares::Models
             this->progressIndicator = progressIndicator;
         }
 
-        ~ModelRunner()
-        {
-            delete this->locker;
-        }
-
         std::shared_ptr<RunSettings> Settings = std::make_shared<RunSettings>();
         std::shared_ptr<Proxies::ProxySettings> ProxySettings = std::make_shared<Proxies::ProxySettings>();
 
@@ -80,6 +78,9 @@ namespace Deltares::Models
         void setSampleProvider(const std::shared_ptr<SampleProvider>& sample_provider);
         double getZValue(const std::shared_ptr<Sample>& sample);
         std::vector<double> getZValues(const std::vector<std::shared_ptr<Sample>>& samples);
+        std::vector<double> getZValues(SampleBatch& batch);
+        bool canStreamZValues() const;
+        void getZValuesStreamed(const NextSampleLambda& nextSample, const ProcessSampleLambda& processSample);
         double getBeta(const std::shared_ptr<Sample>& sample) const;
         bool canCalculateBeta() const;
         int getStochastCount() const;
@@ -119,13 +120,15 @@ namespace Deltares::Models
         int runDesignPointCounter = 1;
         bool usingProxy = false;
         std::vector<std::shared_ptr<Reliability::ReliabilityResult>> reliabilityResults;
-        std::vector<std::shared_ptr<Evaluation>> evaluations;
+        std::shared_ptr<EvaluationStore> evaluations = std::make_shared<EvaluationStore>();
         std::vector< std::shared_ptr<Logging::Message>> messages;
         std::shared_ptr<ProgressIndicator> progressIndicator = nullptr;
 
         static Evaluation getEvaluationFromSample(const std::shared_ptr<ModelSample>& sample);
 
         void registerEvaluation(const std::shared_ptr<ModelSample>& sample);
+        void registerEvaluations(const SampleBatch& batch);
+        std::shared_ptr<EvaluationStore> createEvaluationStore() const;
 
         std::shared_ptr<SampleProvider> sampleProvider = nullptr;
 
@@ -133,7 +136,6 @@ namespace Deltares::Models
         ShouldInvertLambda shouldInvertFunction = nullptr;
         RemoveTaskLambda removeTaskFunction = nullptr;
 
-        Utils::Locker* locker = nullptr;
     };
 }
 
@@ -68,4 +68,15 @@ namespace Deltares::Models
             sample->Z = parameterIndexFromInput ? sample->Values[parameterIndex] : sample->OutputValues[parameterIndex];
         }
     }
+
+    void ParameterSelector::updateZValues(SampleBatch& batch)
+    {
+        if (!useSampleZValue)
+        {
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                batch.Z[i] = parameterIndexFromInput ? batch.getXValues(i)[parameterIndex] : batch.getOutputValues(i)[parameterIndex];
+            }
+        }
+    }
 }
@@ -32,6 +32,7 @@ namespace Deltares::Models
         int arrayIndex = 0;
         void initialize(std::vector<std::shared_ptr<ModelInputParameter>>& inputParameters, std::vector<std::shared_ptr<ModelInputParameter>>& outputParameters) override;
         void updateZValue(std::shared_ptr<ModelSample> sample) override;
+        void updateZValues(SampleBatch& batch) override;
         std::string getIdentifier() override { return parameter; }
 
     private:
@@ -0,0 +1,373 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "PersistentSampleRepository.h"
+#include "SampleRepository.h"
+#include "../Utils/probLibException.h"
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace Deltares::Models
+{
+    namespace
+    {
+        constexpr std::uint64_t fnvOffset = 14695981039346656037ull;
+        constexpr std::uint64_t fnvPrime = 1099511628211ull;
+
+        std::uint64_t addToHash(std::uint64_t hash, const char* data, size_t size)
+        {
+            for (size_t i = 0; i < size; i++)
+            {
+                hash ^= static_cast<unsigned char>(data[i]);
+                hash *= fnvPrime;
+            }
+            return hash;
+        }
+
+        std::uint64_t addToHash(std::uint64_t hash, const std::string& text)
+        {
+            // include the terminating zero, so that concatenated texts can not produce the same hash
+            return addToHash(hash, text.c_str(), text.size() + 1);
+        }
+
+        std::uint64_t addToHash(std::uint64_t hash, std::int32_t value)
+        {
+            char bytes[sizeof(value)];
+            std::memcpy(bytes, &value, sizeof(value));
+            return addToHash(hash, bytes, sizeof(value));
+        }
+
+        /**
+         * \brief Size of the fixed part of a record: identifier, values count, output values count, reserved and model key
+         */
+        constexpr size_t recordHeaderSize = 4 * sizeof(std::uint32_t) + sizeof(std::uint64_t);
+
+        constexpr size_t fileHeaderSize = 8 + 2 * sizeof(std::uint32_t);
+
+        bool isFinite(const std::vector<double>& values)
+        {
+            for (double value : values)
+            {
+                if (!std::isfinite(value))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    PersistentSampleRepository::PersistentSampleRepository(const std::string& fileName, std::uint64_t modelKey)
+    {
+        this->fileName = fileName;
+        this->modelKey = modelKey;
+        this->fileLocker = std::make_unique<Utils::FileLocker>(fileName + ".lock");
+
+        fileLocker->lock();
+
+        try
+        {
+            initializeFile();
+            readRecords();
+        }
+        catch (...)
+        {
+            fileLocker->unlock();
+            throw;
+        }
+
+        fileLocker->unlock();
+    }
+
+    std::uint64_t PersistentSampleRepository::getModelKey(const std::string& modelName,
+        const std::vector<std::shared_ptr<ModelInputParameter>>& inputParameters,
+        const std::vector<std::shared_ptr<ModelInputParameter>>& outputParameters,
+        const std::string& tag)
+    {
+        // std::hash is not used, because the key must be the same in all processes and builds
+        std::uint64_t hash = addToHash(fnvOffset, modelName);
+
+        hash = addToHash(hash, static_cast<std::int32_t>(inputParameters.size()));
+        for (const auto& parameter : inputParameters)
+        {
+            hash = addToHash(hash, parameter->name);
+            hash = addToHash(hash, static_cast<std::int32_t>(parameter->isArray ? parameter->arraySize : 1));
+        }
+
+        hash = addToHash(hash, static_cast<std::int32_t>(outputParameters.size()));
+        for (const auto& parameter : outputParameters)
+        {
+            hash = addToHash(hash, parameter->name);
+            hash = addToHash(hash, static_cast<std::int32_t>(parameter->isArray ? parameter->arraySize : 1));
+        }
+
+        return addToHash(hash, tag);
+    }
+
+    void PersistentSampleRepository::initializeFile()
+    {
+        std::error_code error;
+        const auto fileSize = std::filesystem::file_size(fileName, error);
+
+        if (error || fileSize == 0)
+        {
+            std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+            file.write(fileIdentifier, sizeof(fileIdentifier));
+            file.write(reinterpret_cast<const char*>(&fileVersion), sizeof(fileVersion));
+            const std::uint32_t reserved = 0;
+            file.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+            file.close();
+
+            if (!file)
+            {
+                throw Reliability::probLibException("Cache file can not be written: " + fileName);
+            }
+        }
+        else
+        {
+            std::ifstream file(fileName, std::ios::binary);
+            char identifier[sizeof(fileIdentifier)] = {};
+            std::uint32_t version = 0;
+            file.read(identifier, sizeof(identifier));
+            file.read(reinterpret_cast<char*>(&version), sizeof(version));
+
+            if (!file || std::memcmp(identifier, fileIdentifier, sizeof(fileIdentifier)) != 0)
+            {
+                throw Reliability::probLibException("File is not a cache file: " + fileName);
+            }
+            else if (version != fileVersion)
+            {
+                throw Reliability::probLibException("Cache file has an unsupported version: " + fileName);
+            }
+        }
+
+        readPosition = fileHeaderSize;
+    }
+
+    bool PersistentSampleRepository::isFileExtended() const
+    {
+        std::error_code error;
+        const auto fileSize = std::filesystem::file_size(fileName, error);
+        return !error && fileSize > readPosition;
+    }
+
+    void PersistentSampleRepository::readRecords()
+    {
+        if (corrupted || !isFileExtended())
+        {
+            return;
+        }
+
+        std::ifstream file(fileName, std::ios::binary);
+        file.seekg(static_cast<std::streamoff>(readPosition));
+
+        std::vector<char> buffer;
+
+        while (true)
+        {
+            buffer.resize(recordHeaderSize);
+            file.read(buffer.data(), static_cast<std::streamsize>(recordHeaderSize));
+            if (file.gcount() == 0)
+            {
+                break;
+            }
+            else if (file.gcount() < static_cast<std::streamsize>(recordHeaderSize))
+            {
+                corrupted = true;
+                break;
+            }
+
+            std::uint32_t header[4];
+            std::uint64_t key;
+            std::memcpy(header, buffer.data(), sizeof(header));
+            std::memcpy(&key, buffer.data() + sizeof(header), sizeof(key));
+
+            const std::uint32_t valuesCount = header[1];
+            const std::uint32_t outputValuesCount = header[2];
+
+            if (header[0] != recordIdentifier)
+            {
+                corrupted = true;
+                break;
+            }
+
+            const size_t doublesCount = static_cast<size_t>(valuesCount) + outputValuesCount + 1;
+            const size_t recordSize = recordHeaderSize + doublesCount * sizeof(double) + sizeof(std::uint64_t);
+
+            buffer.resize(recordSize);
+            file.read(buffer.data() + recordHeaderSize, static_cast<std::streamsize>(recordSize - recordHeaderSize));
+            if (file.gcount() < static_cast<std::streamsize>(recordSize - recordHeaderSize))
+            {
+                corrupted = true;
+                break;
+            }
+
+            std::uint64_t checksum;
+            std::memcpy(&checksum, buffer.data() + recordSize - sizeof(checksum), sizeof(checksum));
+            if (checksum != addToHash(fnvOffset, buffer.data(), recordSize - sizeof(checksum)))
+            {
+                corrupted = true;
+                break;
+            }
+
+            readPosition += recordSize;
+
+            if (key == modelKey)
+            {
+                const double* doubles = reinterpret_cast<const double*>(buffer.data() + recordHeaderSize);
+
+                Entry entry;
+                entry.values.resize(valuesCount);
+                entry.outputValues.resize(outputValuesCount);
+                std::memcpy(entry.values.data(), doubles, valuesCount * sizeof(double));
+                std::memcpy(entry.outputValues.data(), doubles + valuesCount, outputValuesCount * sizeof(double));
+                std::memcpy(&entry.z, doubles + valuesCount + outputValuesCount, sizeof(double));
+
+                if (find(entry.values, SampleRepository::getHash(entry.values)) == nullptr)
+                {
+                    addEntry(std::move(entry));
+                }
+            }
+        }
+    }
+
+    const PersistentSampleRepository::Entry* PersistentSampleRepository::find(const std::vector<double>& values, size_t hash) const
+    {
+        auto [first, last] = index.equal_range(hash);
+        for (auto it = first; it != last; ++it)
+        {
+            const Entry& entry = entries[it->second];
+            if (entry.values == values)
+            {
+                return &entry;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void PersistentSampleRepository::addEntry(Entry entry)
+    {
+        index.emplace(SampleRepository::getHash(entry.values), entries.size());
+        entries.push_back(std::move(entry));
+    }
+
+    void PersistentSampleRepository::registerSample(const std::shared_ptr<ModelSample>& sample)
+    {
+        if (sample->UsedProxy || !std::isfinite(sample->Z) || !isFinite(sample->Values))
+        {
+            return;
+        }
+
+        const size_t hash = SampleRepository::getHash(sample->Values);
+
+        locker->lock();
+        fileLocker->lock();
+
+        // another process may have calculated the same sample in the meantime
+        readRecords();
+
+        if (find(sample->Values, hash) == nullptr)
+        {
+            Entry entry;
+            entry.values = sample->Values;
+            entry.outputValues = sample->OutputValues;
+            entry.z = sample->Z;
+
+            // records are only appended to a valid file, otherwise the sample is only kept in memory
+            std::error_code error;
+            const auto fileSize = std::filesystem::file_size(fileName, error);
+            if (!corrupted && !error && fileSize == readPosition)
+            {
+                const std::uint32_t header[4] = { recordIdentifier,
+                    static_cast<std::uint32_t>(entry.values.size()),
+                    static_cast<std::uint32_t>(entry.outputValues.size()), 0 };
+
+                std::vector<char> buffer(sizeof(header) + sizeof(modelKey));
+                std::memcpy(buffer.data(), header, sizeof(header));
+                std::memcpy(buffer.data() + sizeof(header), &modelKey, sizeof(modelKey));
+
+                auto append = [&buffer](const void* data, size_t size)
+                {
+                    const char* bytes = static_cast<const char*>(data);
+                    buffer.insert(buffer.end(), bytes, bytes + size);
+                };
+
+                append(entry.values.data(), entry.values.size() * sizeof(double));
+                append(entry.outputValues.data(), entry.outputValues.size() * sizeof(double));
+                append(&entry.z, sizeof(double));
+
+                const std::uint64_t checksum = addToHash(fnvOffset, buffer.data(), buffer.size());
+                append(&checksum, sizeof(checksum));
+
+                std::ofstream file(fileName, std::ios::binary | std::ios::app);
+                file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                file.close();
+
+                if (file)
+                {
+                    readPosition += buffer.size();
+                }
+                else
+                {
+                    corrupted = true;
+                }
+            }
+
+            addEntry(std::move(entry));
+        }
+
+        fileLocker->unlock();
+        locker->unlock();
+    }
+
+    bool PersistentSampleRepository::retrieveSample(const std::shared_ptr<ModelSample>& sample)
+    {
+        const size_t hash = SampleRepository::getHash(sample->Values);
+
+        locker->lock();
+
+        const Entry* entry = find(sample->Values, hash);
+
+        if (entry == nullptr && isFileExtended())
+        {
+            fileLocker->lockShared();
+            readRecords();
+            fileLocker->unlock();
+
+            entry = find(sample->Values, hash);
+        }
+
+        if (entry != nullptr)
+        {
+            sample->OutputValues = entry->outputValues;
+            sample->Z = entry->z;
+            hits++;
+        }
+
+        locker->unlock();
+
+        return entry != nullptr;
+    }
+}
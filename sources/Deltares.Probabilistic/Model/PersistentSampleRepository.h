@@ -0,0 +1,125 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ModelSample.h"
+#include "ModelInputParameter.h"
+#include "../Utils/Locker.h"
+#include "../Utils/FileLocker.h"
+
+namespace Deltares::Models
+{
+    /**
+     * \brief Stores model results in a file, so that they can be reused in other runs
+     * \remark The file is append only and can be shared by processes on the same machine. Results are
+     *         stored per model key, which identifies the model and its parameters, so different models can use the same file.
+     */
+    class PersistentSampleRepository
+    {
+    public:
+        /**
+         * \brief Constructor
+         * \param fileName File containing the stored results, it is created if it does not exist
+         * \param modelKey Key identifying the model, see getModelKey()
+         */
+        PersistentSampleRepository(const std::string& fileName, std::uint64_t modelKey);
+
+        /**
+         * \brief Stores the results of a sample in the file
+         * \remark Samples calculated by a proxy or with non finite values are not stored
+         */
+        void registerSample(const std::shared_ptr<ModelSample>& sample);
+
+        /**
+         * \brief Copies the stored results to a sample with the same values
+         * \return Indication whether results were found
+         */
+        bool retrieveSample(const std::shared_ptr<ModelSample>& sample);
+
+        std::string getFileName() const { return fileName; }
+
+        std::uint64_t getModelKey() const { return modelKey; }
+
+        /**
+         * \brief Gets the number of retrieved samples which were found in the file
+         */
+        long long getHits() const { return hits; }
+
+        /**
+         * \brief Gets a key identifying the model, based on its name and parameters
+         * \param modelName Name of the model
+         * \param inputParameters Input parameters of the model
+         * \param outputParameters Output parameters of the model
+         * \param tag User defined tag, which should be changed when the model changes, so that old results are not reused
+         * \return Key, which is equal in all processes
+         */
+        static std::uint64_t getModelKey(const std::string& modelName,
+            const std::vector<std::shared_ptr<ModelInputParameter>>& inputParameters,
+            const std::vector<std::shared_ptr<ModelInputParameter>>& outputParameters,
+            const std::string& tag);
+
+    private:
+        struct Entry
+        {
+            std::vector<double> values;
+            std::vector<double> outputValues;
+            double z = 0;
+        };
+
+        std::string fileName;
+        std::uint64_t modelKey = 0;
+
+        std::vector<Entry> entries;
+        std::unordered_multimap<size_t, size_t> index;
+
+        /**
+         * \brief Position in the file until which the records have been read
+         */
+        std::uint64_t readPosition = 0;
+
+        long long hits = 0;
+
+        /**
+         * \brief Indicates that an invalid record was found, no records are read or written after it
+         */
+        bool corrupted = false;
+
+        std::unique_ptr<Utils::Locker> locker = std::make_unique<Utils::Locker>();
+        std::unique_ptr<Utils::FileLocker> fileLocker = nullptr;
+
+        static constexpr char fileIdentifier[8] = { 'P', 'L', 'C', 'A', 'C', 'H', 'E', '\0' };
+        static constexpr std::uint32_t fileVersion = 1;
+        static constexpr std::uint32_t recordIdentifier = 0x31434552;
+
+        void initializeFile();
+        void readRecords();
+        bool isFileExtended() const;
+        const Entry* find(const std::vector<double>& values, size_t hash) const;
+        void addEntry(Entry entry);
+    };
+}
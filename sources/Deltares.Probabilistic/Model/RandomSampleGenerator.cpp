@@ -32,7 +32,7 @@ namespace Deltares::Models
      */
     void RandomSampleGenerator::initialize()
     {
-        random.initialize(this->Settings->IsRepeatableRandom, this->Settings->Seed, this->Settings->getTimeStamp());
+        random.initialize(this->Settings->IsRepeatableRandom, this->Settings->Seed, this->Settings->getTimeStamp(), this->Settings->GeneratorType);
 
         if (sampleProvider == nullptr)
         {
@@ -64,13 +64,72 @@ namespace Deltares::Models
             randomValues[i] = random.next();
         }
 
+        return getSampleFromRandomValues(randomValues);
+    }
+
+    std::shared_ptr<Sample> RandomSampleGenerator::getRandomSample(int sampleIndex)
+    {
+        random.setPosition(static_cast<std::uint64_t>(sampleIndex) * this->getSampleSize());
+
+        return getRandomSample();
+    }
+
+    std::vector<std::shared_ptr<Sample>> RandomSampleGenerator::getRandomSamples(int nSamples)
+    {
+        std::vector<std::shared_ptr<Sample>> samples(nSamples);
+
+        if (random.isRandomAccessible())
+        {
+            const int size = this->getSampleSize();
+            const std::uint64_t start = random.getPosition();
+
+#pragma omp parallel for
+            for (int i = 0; i < nSamples; i++)
+            {
+                std::vector<double> randomValues = std::vector<double>(size);
+
+                for (int j = 0; j < size; j++)
+                {
+                    randomValues[j] = random.getValue(start + static_cast<std::uint64_t>(i) * size + j);
+                }
+
+                samples[i] = getSampleFromRandomValues(randomValues);
+            }
+
+            random.setPosition(start + static_cast<std::uint64_t>(nSamples) * size);
+        }
+        else
+        {
+            for (int i = 0; i < nSamples; i++)
+            {
+                samples[i] = getRandomSample();
+            }
+        }
+
+        return samples;
+    }
+
+    std::shared_ptr<Sample> RandomSampleGenerator::getSampleFromRandomValues(const std::vector<double>& randomValues)
+    {
         std::shared_ptr<Sample> sample = sampleProvider->getSample();
 
         for (int i = 0; i < this->Settings->StochastSet->getVaryingStochastCount(); i++)
         {
             const int variableIndex = this->Settings->SkipUnvaryingParameters ? this->Settings->StochastSet->VaryingStochastSettings[i]->StochastIndex : i;
-            const double x = randomValues[variableIndex];
-            sample->Values[i] = Deltares::Statistics::StandardNormal::getUFromQ(x);
+            sample->Values[i] = randomValues[variableIndex];
+        }
+
+        if (this->Settings->GeneratorType == Numeric::RandomGeneratorType::MersenneTwister)
+        {
+            // scalar conversion, so that samples are bit-identical to earlier releases
+            for (size_t i = 0; i < sample->Values.size(); i++)
+            {
+                sample->Values[i] = Deltares::Statistics::StandardNormal::getUFromQ(sample->Values[i]);
+            }
+        }
+        else
+        {
+            Deltares::Statistics::StandardNormal::getUFromQ(sample->Values.data(), sample->Values.data(), sample->Values.size());
         }
 
         return sample;
@@ -78,14 +137,7 @@ namespace Deltares::Models
 
     void RandomSampleGenerator::proceed(int nSamples)
     {
-        const int size = getSampleSize();
-        for (int i = 0; i < nSamples; i++)
-        {
-            for (int j = 0; j < size; j++)
-            {
-                double _ = random.next();
-            }
-        }
+        random.setPosition(random.getPosition() + static_cast<std::uint64_t>(nSamples) * getSampleSize());
     }
 
     int RandomSampleGenerator::getSampleSize() const
@@ -56,12 +56,35 @@ namespace Deltares::Models
          */
         std::shared_ptr<Sample> getRandomSample();
 
+        /**
+         * \brief Gets the random sample with a given index, as if it was generated after a restart and the given number of samples
+         * \param sampleIndex Index of the sample
+         * \returns random sample
+         * \remark Subsequent samples follow the sample with the given index
+         */
+        std::shared_ptr<Sample> getRandomSample(int sampleIndex);
+
+        /**
+         * \brief Gets a number of subsequent random samples
+         * \param nSamples Number of samples
+         * \returns random samples
+         * \remark Generated in parallel if the random generator is random accessible, results do not depend on the number of threads
+         */
+        std::vector<std::shared_ptr<Sample>> getRandomSamples(int nSamples);
+
         /**
          * \brief Proceeds the random sample generator for an equivalent of a number of samples
          * \param nSamples Equivalent number of samples
          */
         void proceed(int nSamples);
     private:
+        /**
+         * \brief Creates a sample from random values in the range [0, 1)
+         * \param randomValues Random values, one per stochast or one per varying stochast
+         * \returns Sample in u-space
+         */
+        std::shared_ptr<Sample> getSampleFromRandomValues(const std::vector<double>& randomValues);
+
         /**
          * \brief Gets the size of a sample to be generated
          * \returns Sample size
@@ -20,6 +20,7 @@
 // All rights reserved.
 //
 #include "RandomSettings.h"
+#include "../Utils/probLibException.h"
 
 namespace Deltares::Models
 {
@@ -45,5 +46,21 @@ namespace Deltares::Models
 
         timeStamp = newTimeStamp;
     }
-}
 
+    std::string RandomSettings::getRandomGeneratorTypeString(Numeric::RandomGeneratorType generatorType)
+    {
+        switch (generatorType)
+        {
+        case Numeric::RandomGeneratorType::MersenneTwister: return "mersenne_twister";
+        case Numeric::RandomGeneratorType::Philox: return "philox";
+        default: throw Reliability::probLibException("Random generator type");
+        }
+    }
+
+    Numeric::RandomGeneratorType RandomSettings::getRandomGeneratorType(std::string generatorType)
+    {
+        if (generatorType == "mersenne_twister") return Numeric::RandomGeneratorType::MersenneTwister;
+        else if (generatorType == "philox") return Numeric::RandomGeneratorType::Philox;
+        else throw Reliability::probLibException("Random generator type");
+    }
+}
@@ -22,7 +22,9 @@
 #pragma once
 
 #include "../Reliability/StochastSettingsSet.h"
+#include "../Math/RandomValueGenerator.h"
 #include <ctime>
+#include <string>
 
 namespace Deltares::Models
 {
@@ -47,6 +49,12 @@ namespace Deltares::Models
          */
         int Seed = 0;
 
+        /**
+         * \brief Algorithm to generate random values
+         * \remark A counter based generator allows random access to samples and parallel generation of samples
+         */
+        Numeric::RandomGeneratorType GeneratorType = Numeric::RandomGeneratorType::MersenneTwister;
+
         /**
          * \brief If true, fixates the random generator so that it produces same random values when restarted or initialized
          * \param fixed Indication whether the unrepeatable random generator is fixed
@@ -82,6 +90,9 @@ namespace Deltares::Models
 
         std::shared_ptr<Reliability::StochastSettingsSet> StochastSet = std::make_shared<Reliability::StochastSettingsSet>();
 
+        static std::string getRandomGeneratorTypeString(Numeric::RandomGeneratorType generatorType);
+        static Numeric::RandomGeneratorType getRandomGeneratorType(std::string generatorType);
+
     private:
         /**
          * \brief The last non-zero generated time stamp
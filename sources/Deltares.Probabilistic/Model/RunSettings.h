@@ -21,6 +21,7 @@
 //
 #pragma once
 #include <memory>
+#include <string>
 
 #include "../Logging/ValidationReport.h"
 #include "../Logging/ValidationSupport.h"
@@ -46,11 +47,42 @@ namespace Deltares::Models
     public:
         int MaxParallelProcesses = 1;
         int MaxChunkSize = 16;
+
+        /**
+         * \brief Indicates whether samples are calculated as a stream instead of in chunks, so that no process waits for the other processes
+         * \remark Only applies to models which calculate one sample at a time and when more than one parallel process is allowed
+         */
+        bool StreamEvaluations = false;
         bool SaveEvaluations = false;
+
+        /**
+         * \brief Memory in MB used by saved evaluations, after which they are moved to a memory mapped file (0 is unlimited)
+         */
+        int MaxEvaluationsMemory = 0;
+
+        /**
+         * \brief Directory of the file with saved evaluations (empty is the temporary directory)
+         */
+        std::string EvaluationsDirectory = "";
         bool SaveConvergence = false;
         bool SaveMessages = false;
         bool ReuseCalculations = true;
         bool AllowRepository = true;
+
+        /**
+         * \brief Maximum number of samples kept for reuse, the least recently used samples are removed first (0 is unlimited)
+         */
+        int MaxRepositorySize = 100000;
+
+        /**
+         * \brief File in which model results are stored for reuse in other runs (empty is no file)
+         */
+        std::string CacheFile = "";
+
+        /**
+         * \brief Tag identifying the model version in the cache file, change it when the model changes
+         */
+        std::string CacheTag = "";
         bool UseZFromSample = false;
         bool RunAtDesignPoint = false;
         bool ExtendedLoggingAtDesignPoint = false;
@@ -62,6 +94,8 @@ namespace Deltares::Models
         void validate(Logging::ValidationReport& report) const
         {
             Logging::ValidationSupport::checkMinimumInt(report, 1, MaxParallelProcesses, "max parallel processes");
+            Logging::ValidationSupport::checkMinimumInt(report, 0, MaxRepositorySize, "max repository size");
+            Logging::ValidationSupport::checkMinimumInt(report, 0, MaxEvaluationsMemory, "max evaluations memory");
         }
 
         static std::string getHandleInvalidTypeString(Deltares::Models::HandleInvalidType type);
@@ -0,0 +1,244 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "SampleBatch.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../Utils/probLibException.h"
+
+namespace Deltares::Models
+{
+    void SampleBatch::resize(int size, int sampleSize)
+    {
+        this->size = size;
+        this->sampleSize = sampleSize;
+
+        UValues.assign(static_cast<size_t>(size) * sampleSize, 0.0);
+        Z.assign(size, std::nan(""));
+        Weight.assign(size, std::nan(""));
+        Beta.assign(size, 0.0);
+        IterationIndex.assign(size, -1);
+        ThreadId.assign(size, 0);
+        Tag.assign(size, 0);
+        AllowProxy.assign(size, true);
+        UsedProxy.assign(size, false);
+        IsRestartRequired.assign(size, false);
+
+        setModelSize(inputSize, outputSize);
+    }
+
+    void SampleBatch::setModelSize(int inputSize, int outputSize)
+    {
+        this->inputSize = inputSize;
+        this->outputSize = outputSize;
+
+        XValues.assign(static_cast<size_t>(size) * inputSize, 0.0);
+        OutputValues.assign(static_cast<size_t>(size) * outputSize, std::nan(""));
+    }
+
+    void SampleBatch::setOutputSize(int outputSize)
+    {
+        if (outputSize != this->outputSize)
+        {
+            std::vector<double> newOutputValues(static_cast<size_t>(size) * outputSize, std::nan(""));
+
+            const int copySize = std::min(outputSize, this->outputSize);
+            for (int i = 0; i < size; i++)
+            {
+                std::copy_n(getOutputValues(i), copySize, newOutputValues.data() + static_cast<size_t>(i) * outputSize);
+            }
+
+            this->outputSize = outputSize;
+            OutputValues = std::move(newOutputValues);
+        }
+    }
+
+    double SampleBatch::getBeta(int index) const
+    {
+        const double* values = getValues(index);
+
+        double sum = 0;
+        for (int j = 0; j < sampleSize; j++)
+        {
+            sum += values[j] * values[j];
+        }
+
+        return std::sqrt(sum);
+    }
+
+    void SampleBatch::setSample(int index, const std::shared_ptr<Sample>& sample)
+    {
+        std::copy_n(sample->Values.data(), std::min(sampleSize, static_cast<int>(sample->Values.size())), getValues(index));
+
+        IterationIndex[index] = sample->IterationIndex;
+        ThreadId[index] = sample->threadId;
+        Weight[index] = sample->Weight;
+        AllowProxy[index] = sample->AllowProxy;
+        IsRestartRequired[index] = sample->IsRestartRequired;
+        Z[index] = sample->Z;
+    }
+
+    std::shared_ptr<Sample> SampleBatch::getSample(int index) const
+    {
+        const double* values = getValues(index);
+        std::shared_ptr<Sample> sample = std::make_shared<Sample>(std::vector<double>(values, values + sampleSize));
+
+        sample->IterationIndex = IterationIndex[index];
+        sample->threadId = ThreadId[index];
+        sample->Weight = Weight[index];
+        sample->AllowProxy = AllowProxy[index];
+        sample->IsRestartRequired = IsRestartRequired[index];
+        sample->Z = Z[index];
+
+        return sample;
+    }
+
+    void SampleBatch::updateSample(int index, Sample& sample) const
+    {
+        sample.Z = Z[index];
+        sample.AllowProxy = AllowProxy[index];
+        sample.IsRestartRequired = IsRestartRequired[index];
+    }
+
+    std::shared_ptr<ModelSample> SampleBatch::getModelSample(int index) const
+    {
+        std::shared_ptr<ModelSample> sample = std::make_shared<ModelSample>(std::vector<double>(inputSize));
+
+        fillModelSample(index, *sample);
+
+        return sample;
+    }
+
+    void SampleBatch::fillModelSample(int index, ModelSample& sample) const
+    {
+        const double* xValues = getXValues(index);
+        const double* outputValues = getOutputValues(index);
+
+        sample.Values.assign(xValues, xValues + inputSize);
+        sample.OutputValues.assign(outputValues, outputValues + outputSize);
+
+        sample.IterationIndex = IterationIndex[index];
+        sample.threadId = ThreadId[index];
+        sample.Weight = Weight[index];
+        sample.AllowProxy = AllowProxy[index];
+        sample.UsedProxy = UsedProxy[index];
+        sample.IsRestartRequired = IsRestartRequired[index];
+        sample.Beta = Beta[index];
+        sample.Z = Z[index];
+        sample.Tag = Tag[index];
+    }
+
+    void SampleBatch::setModelSample(int index, const ModelSample& sample)
+    {
+        if (static_cast<int>(sample.OutputValues.size()) > outputSize)
+        {
+            setOutputSize(static_cast<int>(sample.OutputValues.size()));
+        }
+
+        std::copy_n(sample.Values.data(), std::min(inputSize, static_cast<int>(sample.Values.size())), getXValues(index));
+
+        double* outputValues = getOutputValues(index);
+        for (int j = 0; j < outputSize; j++)
+        {
+            outputValues[j] = j < static_cast<int>(sample.OutputValues.size()) ? sample.OutputValues[j] : std::nan("");
+        }
+
+        ThreadId[index] = sample.threadId;
+        AllowProxy[index] = sample.AllowProxy;
+        UsedProxy[index] = sample.UsedProxy;
+        IsRestartRequired[index] = sample.IsRestartRequired;
+        Z[index] = sample.Z;
+        Tag[index] = sample.Tag;
+    }
+
+    void SampleBatch::fillModelSampleStruct(int index, ModelSampleStruct* sampleStruct)
+    {
+        sampleStruct->Values = getXValues(index);
+        sampleStruct->ValuesCount = inputSize;
+
+        sampleStruct->OutputValues = getOutputValues(index);
+        sampleStruct->OutputValuesCount = outputSize;
+
+        sampleStruct->IterationIndex = IterationIndex[index];
+        sampleStruct->threadId = ThreadId[index];
+        sampleStruct->Weight = Weight[index];
+        sampleStruct->AllowProxy = AllowProxy[index];
+        sampleStruct->UsedProxy = UsedProxy[index];
+        sampleStruct->IsRestartRequired = IsRestartRequired[index];
+        sampleStruct->Beta = Beta[index];
+        sampleStruct->Z = Z[index];
+        sampleStruct->ExtendedLogging = false;
+        sampleStruct->LoggingCounter = 0;
+        sampleStruct->Tag = Tag[index];
+    }
+
+    void SampleBatch::setModelSampleStruct(int index, const ModelSampleStruct* sampleStruct)
+    {
+        // the callback may have replaced the arrays, otherwise the values are already in place
+        if (sampleStruct->Values != getXValues(index))
+        {
+            std::copy_n(sampleStruct->Values, std::min(inputSize, sampleStruct->ValuesCount), getXValues(index));
+        }
+
+        if (sampleStruct->OutputValues != getOutputValues(index))
+        {
+            std::copy_n(sampleStruct->OutputValues, std::min(outputSize, sampleStruct->OutputValuesCount), getOutputValues(index));
+        }
+
+        ThreadId[index] = sampleStruct->threadId;
+        AllowProxy[index] = sampleStruct->AllowProxy;
+        UsedProxy[index] = sampleStruct->UsedProxy;
+        IsRestartRequired[index] = sampleStruct->IsRestartRequired;
+        Z[index] = sampleStruct->Z;
+        Tag[index] = sampleStruct->Tag;
+    }
+
+    SampleBatch SampleBatch::fromSamples(const std::vector<std::shared_ptr<Sample>>& samples)
+    {
+        const int sampleSize = samples.empty() ? 0 : static_cast<int>(samples[0]->Values.size());
+        for (const std::shared_ptr<Sample>& sample : samples)
+        {
+            if (static_cast<int>(sample->Values.size()) != sampleSize)
+            {
+                throw Reliability::probLibException("All samples in a batch should have the same number of values");
+            }
+        }
+
+        SampleBatch batch(static_cast<int>(samples.size()), sampleSize);
+
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            batch.setSample(static_cast<int>(i), samples[i]);
+        }
+
+        return batch;
+    }
+
+    void SampleBatch::updateSamples(const std::vector<std::shared_ptr<Sample>>& samples) const
+    {
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            updateSample(static_cast<int>(i), *samples[i]);
+        }
+    }
+}
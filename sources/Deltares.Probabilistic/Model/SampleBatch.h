@@ -0,0 +1,162 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include <vector>
+#include <memory>
+
+#include "Sample.h"
+#include "ModelSample.h"
+#include "ModelSampleStruct.h"
+
+namespace Deltares::Models
+{
+    /**
+     * \brief Contiguous block of samples, which are calculated together in a reliability or sensitivity algorithm
+     * \remark All values are stored row by row in one block per quantity, so a chunk of samples can be
+     *         converted and calculated without allocating a sample object per row
+     */
+    class SampleBatch
+    {
+    public:
+        SampleBatch() = default;
+
+        SampleBatch(int size, int sampleSize)
+        {
+            this->resize(size, sampleSize);
+        }
+
+        /**
+         * \brief Values in u-space, row by row
+         */
+        std::vector<double> UValues;
+
+        /**
+         * \brief Values in x-space, row by row
+         */
+        std::vector<double> XValues;
+
+        /**
+         * \brief Output values of the model, row by row
+         */
+        std::vector<double> OutputValues;
+
+        std::vector<double> Z;
+        std::vector<double> Weight;
+        std::vector<double> Beta;
+        std::vector<int> IterationIndex;
+        std::vector<int> ThreadId;
+        std::vector<int> Tag;
+        std::vector<char> AllowProxy;
+        std::vector<char> UsedProxy;
+        std::vector<char> IsRestartRequired;
+
+        /**
+         * \brief Sets the number of samples and the number of u-values per sample, all contents are reset
+         */
+        void resize(int size, int sampleSize);
+
+        /**
+         * \brief Sets the number of x-values and output values per sample
+         */
+        void setModelSize(int inputSize, int outputSize);
+
+        /**
+         * \brief Sets the number of output values per sample, already assigned output values are preserved
+         */
+        void setOutputSize(int outputSize);
+
+        int getSize() const { return size; }
+        int getSampleSize() const { return sampleSize; }
+        int getInputSize() const { return inputSize; }
+        int getOutputSize() const { return outputSize; }
+
+        double* getValues(int index) { return UValues.data() + static_cast<size_t>(index) * sampleSize; }
+        const double* getValues(int index) const { return UValues.data() + static_cast<size_t>(index) * sampleSize; }
+        double* getXValues(int index) { return XValues.data() + static_cast<size_t>(index) * inputSize; }
+        const double* getXValues(int index) const { return XValues.data() + static_cast<size_t>(index) * inputSize; }
+        double* getOutputValues(int index) { return OutputValues.data() + static_cast<size_t>(index) * outputSize; }
+        const double* getOutputValues(int index) const { return OutputValues.data() + static_cast<size_t>(index) * outputSize; }
+
+        /**
+         * \brief Gets the distance to the origin in u-space of a sample
+         */
+        double getBeta(int index) const;
+
+        /**
+         * \brief Copies the u-values and settings of a sample into a row
+         */
+        void setSample(int index, const std::shared_ptr<Sample>& sample);
+
+        /**
+         * \brief Creates a sample from a row
+         */
+        std::shared_ptr<Sample> getSample(int index) const;
+
+        /**
+         * \brief Copies the results of a row back to a sample
+         */
+        void updateSample(int index, Sample& sample) const;
+
+        /**
+         * \brief Creates a sample in x-space from a row
+         */
+        std::shared_ptr<ModelSample> getModelSample(int index) const;
+
+        /**
+         * \brief Copies the values and settings of a row into an existing sample in x-space
+         */
+        void fillModelSample(int index, ModelSample& sample) const;
+
+        /**
+         * \brief Copies the values and results of a sample in x-space into a row
+         */
+        void setModelSample(int index, const ModelSample& sample);
+
+        /**
+         * \brief Lets a model sample struct refer to the values of a row
+         */
+        void fillModelSampleStruct(int index, ModelSampleStruct* sampleStruct);
+
+        /**
+         * \brief Copies the results in a model sample struct into a row
+         */
+        void setModelSampleStruct(int index, const ModelSampleStruct* sampleStruct);
+
+        /**
+         * \brief Creates a batch from a collection of samples
+         * \remark All samples should have the same number of values
+         */
+        static SampleBatch fromSamples(const std::vector<std::shared_ptr<Sample>>& samples);
+
+        /**
+         * \brief Copies the results of all rows back to a collection of samples
+         */
+        void updateSamples(const std::vector<std::shared_ptr<Sample>>& samples) const;
+
+    private:
+        int size = 0;
+        int sampleSize = 0;
+        int inputSize = 0;
+        int outputSize = 0;
+    };
+}
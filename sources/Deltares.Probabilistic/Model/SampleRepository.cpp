@@ -22,81 +22,188 @@
 
 #include "SampleRepository.h"
 
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
 namespace Deltares::Models
 {
-    void SampleRepository::SampleCollection::registerSample(std::shared_ptr<ModelSample> sample)
+    SampleRepository::SampleRepository()
     {
-        this->samples.push_back(sample);
+        for (int i = 0; i < shardCount; i++)
+        {
+            shards.push_back(std::make_unique<Shard>());
+        }
     }
 
-    std::shared_ptr<ModelSample> SampleRepository::SampleCollection::retrieveSample(std::shared_ptr<ModelSample> sample) const
+    SampleRepository::Shard::SampleList::iterator SampleRepository::Shard::find(const std::shared_ptr<ModelSample>& sample, size_t hash)
     {
-        for (std::shared_ptr<ModelSample> existingSample : samples)
+        auto [first, last] = index.equal_range(hash);
+
+        for (auto it = first; it != last; ++it)
         {
-            if (existingSample->hasSameValues(sample))
+            if ((*it->second)->hasSameValues(sample))
             {
-                return existingSample;
+                return it->second;
             }
         }
 
-        return nullptr;
+        return samples.end();
     }
 
-    double SampleRepository::getKey(std::shared_ptr<ModelSample> sample)
+    void SampleRepository::Shard::registerSample(std::shared_ptr<ModelSample> sample, size_t hash, int maxSize, std::atomic<int>& size)
     {
-        // calculates a sample key for the sample sample
-        double sum = 0;
-        for (size_t i = 0; i < sample->Values.size(); i++)
+        locker->lock();
+
+        auto existing = find(sample, hash);
+
+        if (existing != samples.end())
         {
-            int index = static_cast<int>(i) + 1;
-            sum += index * sample->Values[i];
+            *existing = sample;
+            samples.splice(samples.begin(), samples, existing);
         }
+        else
+        {
+            samples.push_front(sample);
+            index.emplace(hash, samples.begin());
+            size++;
 
-        return sum;
+            if (maxSize > 0 && static_cast<int>(samples.size()) > maxSize)
+            {
+                // remove the least recently used sample
+                auto leastRecentlyUsed = std::prev(samples.end());
+                auto [first, last] = index.equal_range(getHash((*leastRecentlyUsed)->Values));
+                for (auto it = first; it != last; ++it)
+                {
+                    if (it->second == leastRecentlyUsed)
+                    {
+                        index.erase(it);
+                        break;
+                    }
+                }
+
+                samples.erase(leastRecentlyUsed);
+                size--;
+            }
+        }
+
+        locker->unlock();
     }
 
-    bool SampleRepository::shouldRegisterSample(std::shared_ptr<ModelSample> sample)
+    std::shared_ptr<ModelSample> SampleRepository::Shard::retrieveSample(std::shared_ptr<ModelSample> sample, size_t hash)
     {
-        return !(sample->UsedProxy);
+        std::shared_ptr<ModelSample> result = nullptr;
+
+        locker->lock();
+
+        auto existing = find(sample, hash);
+
+        if (existing != samples.end())
+        {
+            samples.splice(samples.begin(), samples, existing);
+            result = *existing;
+        }
+
+        locker->unlock();
+
+        return result;
     }
 
-    void SampleRepository::registerSample(std::shared_ptr<ModelSample> sample)
+    void SampleRepository::Shard::clear(std::atomic<int>& size)
     {
-        if (shouldRegisterSample(sample))
+        locker->lock();
+
+        size -= static_cast<int>(samples.size());
+        index.clear();
+        samples.clear();
+
+        locker->unlock();
+    }
+
+    size_t SampleRepository::getHash(const std::vector<double>& values)
+    {
+        // samples are equal when the values are exactly equal, so the bits of the values are hashed
+        std::uint64_t hash = 14695981039346656037ull;
+
+        for (double value : values)
         {
-            double key = this->getKey(sample);
+            // 0 and -0 are equal
+            const std::uint64_t bits = value == 0.0 ? 0 : std::bit_cast<std::uint64_t>(value);
 
-            if (!std::isnan(key) && !std::isinf(key))
-            {
-                locker->lock();
+            hash ^= bits;
+            hash *= 1099511628211ull;
+            hash ^= hash >> 29;
+        }
 
-                if (!this->sampleCollections.contains(key))
-                {
-                    sampleCollections[key] = std::make_unique<SampleCollection>();
-                }
+        return static_cast<size_t>(hash);
+    }
 
-                locker->unlock();
+    bool SampleRepository::shouldRegisterSample(std::shared_ptr<ModelSample> sample)
+    {
+        if (sample->UsedProxy)
+        {
+            return false;
+        }
 
-                sampleCollections[key]->registerSample(sample);
+        // samples with nan values can never be retrieved
+        for (double value : sample->Values)
+        {
+            if (!std::isfinite(value))
+            {
+                return false;
             }
         }
+
+        return true;
     }
 
-    std::shared_ptr<ModelSample> SampleRepository::retrieveSample(std::shared_ptr<ModelSample> sample)
+    void SampleRepository::registerSample(std::shared_ptr<ModelSample> sample)
     {
-        double key = this->getKey(sample);
+        if (shouldRegisterSample(sample))
+        {
+            const size_t hash = getHash(sample->Values);
+            const int shardMaxSize = maxSize > 0 ? (maxSize + shardCount - 1) / shardCount : 0;
+
+            shards[hash % shardCount]->registerSample(sample, hash, shardMaxSize, size);
+        }
+    }
 
-        if (!this->sampleCollections.contains(key))
+    std::shared_ptr<ModelSample> SampleRepository::retrieveSample(std::shared_ptr<ModelSample> sample)
+    {
+        if (isEmpty())
         {
             return nullptr;
         }
 
-        return this->sampleCollections[key]->retrieveSample(sample);
+        const size_t hash = getHash(sample->Values);
+
+        std::shared_ptr<ModelSample> existingSample = shards[hash % shardCount]->retrieveSample(sample, hash);
+
+        if (existingSample != nullptr)
+        {
+            hits++;
+        }
+        else
+        {
+            misses++;
+        }
+
+        return existingSample;
+    }
+
+    void SampleRepository::setMaxSize(int maxSize)
+    {
+        this->maxSize = maxSize;
     }
 
     void SampleRepository::clear()
     {
-        this->sampleCollections.clear();
+        for (const std::unique_ptr<Shard>& shard : shards)
+        {
+            shard->clear(size);
+        }
+
+        hits = 0;
+        misses = 0;
     }
 }
-
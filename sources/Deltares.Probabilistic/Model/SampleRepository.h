@@ -21,8 +21,11 @@
 //
 #pragma once
 
+#include <atomic>
+#include <list>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "ModelSample.h"
 #include "../Utils/Locker.h"
@@ -31,13 +34,13 @@ namespace Deltares::Models
 {
     /**
      * \brief Stores samples for reuse
+     * \remark Samples are distributed over shards by a hash of their values, each shard has its own lock.
+     *         When the maximum size is exceeded, the least recently used samples are removed.
      */
     class SampleRepository
     {
     public:
-        SampleRepository()
-        {
-        }
+        SampleRepository();
 
         void registerSample(std::shared_ptr<ModelSample> sample);
 
@@ -45,37 +48,80 @@ namespace Deltares::Models
 
         void clear();
 
+        /**
+         * \brief Sets the maximum number of samples in the repository
+         * \param maxSize Maximum number of samples, 0 means unlimited
+         * \remark The maximum is applied per shard, so the actual maximum can deviate slightly
+         */
+        void setMaxSize(int maxSize);
+
+        /**
+         * \brief Gets the number of samples in the repository
+         */
+        int getSize() const { return size; }
+
+        /**
+         * \brief Indicates whether the repository contains no samples
+         */
+        bool isEmpty() const { return size == 0; }
+
+        /**
+         * \brief Gets the number of retrieved samples which were found in the repository
+         */
+        long long getHits() const { return hits; }
+
+        /**
+         * \brief Gets the number of retrieved samples which were not found in the repository
+         * \remark Retrievals from an empty repository are not counted
+         */
+        long long getMisses() const { return misses; }
+
+        /**
+         * \brief Gets a hash for the values of a sample, based on the exact values
+         * \param values values of a sample
+         * \return the hash for the values
+         */
+        static size_t getHash(const std::vector<double>& values);
+
     private:
-        class SampleCollection
+        class Shard
         {
         public:
-            void registerSample(std::shared_ptr<ModelSample> sample);
-            std::shared_ptr<ModelSample> retrieveSample(std::shared_ptr<ModelSample> sample) const;
-            int size() { return static_cast<int>(samples.size()); }
+            void registerSample(std::shared_ptr<ModelSample> sample, size_t hash, int maxSize, std::atomic<int>& size);
+            std::shared_ptr<ModelSample> retrieveSample(std::shared_ptr<ModelSample> sample, size_t hash);
+            void clear(std::atomic<int>& size);
         private:
-            std::vector<std::shared_ptr<ModelSample>> samples;
+            using SampleList = std::list<std::shared_ptr<ModelSample>>;
+
+            /**
+             * \brief Samples in order of usage, most recently used sample first
+             */
+            SampleList samples;
+
+            /**
+             * \brief Hash index to the samples
+             */
+            std::unordered_multimap<size_t, SampleList::iterator> index;
+
+            SampleList::iterator find(const std::shared_ptr<ModelSample>& sample, size_t hash);
+
+            std::unique_ptr<Utils::Locker> locker = std::make_unique<Utils::Locker>();
         };
 
-        std::unordered_map<double, std::unique_ptr<SampleCollection>> sampleCollections;
+        static constexpr int shardCount = 16;
 
-        /**
-         * \brief Gets a simple key for a sample, the key is meant for grouping and quick access to the sample
-         * \param sample sample
-         * \return the key for the sample
-         * \remarks The key is not unique 
-         */
-        double getKey(std::shared_ptr<ModelSample> sample);
+        std::vector<std::unique_ptr<Shard>> shards;
+
+        int maxSize = 0;
+
+        std::atomic<int> size = 0;
+        std::atomic<long long> hits = 0;
+        std::atomic<long long> misses = 0;
 
         /**
          * \brief Indicates whether the sample us useful to be registered in the repository
          * \return Indication
          */
         bool shouldRegisterSample(std::shared_ptr<ModelSample> sample);
-
-        /**
-         * \brief Supporting utility for multi threading
-         */
-        std::unique_ptr<Utils::Locker> locker = std::make_unique<Utils::Locker>();
     };
 }
-
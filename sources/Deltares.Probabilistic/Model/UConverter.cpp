@@ -21,6 +21,8 @@
 //
 #include "UConverter.h"
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 
 #include "../Statistics/Stochast.h"
@@ -400,15 +402,16 @@ namespace Deltares::Models
 
     std::vector<double> UConverter::getExpandedUValues(std::shared_ptr<Sample> sample)
     {
-        std::vector<double> unexpandedUValues = sample->Values;
+        return getExpandedUValues(sample->Values);
+    }
+
+    std::vector<double> UConverter::getExpandedUValues(const std::vector<double>& values)
+    {
+        std::vector<double> unexpandedUValues = values;
 
-        if (sample->Values.size() > varyingStochasts.size())
+        if (values.size() > varyingStochasts.size())
         {
-            unexpandedUValues.clear();
-            for (size_t i = 0; i < varyingStochasts.size(); i++)
-            {
-                unexpandedUValues.push_back(sample->Values[i]);
-            }
+            unexpandedUValues.resize(varyingStochasts.size());
         }
 
         std::vector<double> uCorrelated = varyingCorrelationMatrix->ApplyCorrelation(unexpandedUValues);
@@ -424,6 +427,99 @@ namespace Deltares::Models
 
         auto xValues = std::vector<double>(this->stochasts.size());
 
+        assignXValues(expandedUValues, xValues.data());
+
+        return xValues;
+    }
+
+    /**
+     * \brief Assigns the x-values of all samples in a batch
+     * \param batch Batch with assigned u-values, of which the x-values will be assigned
+     * \remark The conversion is performed stochast by stochast, so that each distribution converts all values of the batch at once
+     */
+    void UConverter::getXValues(SampleBatch& batch)
+    {
+        const size_t count = batch.getSize();
+        const size_t stochastCount = this->stochasts.size();
+
+        if (batch.getInputSize() != static_cast<int>(stochastCount))
+        {
+            batch.setModelSize(static_cast<int>(stochastCount), batch.getOutputSize());
+        }
+
+        // u-values and x-values are stored column by column, i.e. all values of a stochast are adjacent
+        std::vector<double> uColumns(stochastCount * count);
+        std::vector<double> xColumns(stochastCount * count);
+
+        const size_t varyingCount = this->varyingStochasts.size();
+
+        if (count > 0 && batch.getSampleSize() < static_cast<int>(varyingCount))
+        {
+            throw Reliability::probLibException("number of u-values per sample is less than the number of varying stochasts");
+        }
+
+        std::vector<double> correlatedColumns(varyingCount * count);
+        varyingCorrelationMatrix->ApplyCorrelation(batch.UValues.data(), varyingCount, batch.getSampleSize(), count, correlatedColumns.data());
+
+        size_t varyingIndex = 0;
+        for (size_t i = 0; i < stochastCount; i++)
+        {
+            if (this->varyingStochastIndex[i] >= 0)
+            {
+                std::copy_n(&correlatedColumns[varyingIndex * count], count, &uColumns[i * count]);
+                varyingIndex++;
+            }
+        }
+
+        for (size_t i = 0; i < stochastCount; i++)
+        {
+            if (this->varyingStochastIndex[i] < 0)
+            {
+                const auto dependent = varyingCorrelationMatrix->FindDependent(static_cast<int>(i));
+                if (dependent.index >= 0)
+                {
+                    for (size_t j = 0; j < count; j++)
+                    {
+                        uColumns[i * count + j] = dependent.correlation * uColumns[static_cast<size_t>(dependent.index) * count + j];
+                    }
+                }
+            }
+        }
+
+        for (size_t i = 0; i < stochastCount; i++)
+        {
+            if (!this->hasVariableStochasts || !stochasts[i]->definition->isVariable())
+            {
+                this->stochasts[i]->definition->getXFromU(&uColumns[i * count], &xColumns[i * count], count);
+            }
+        }
+
+        if (this->hasVariableStochasts)
+        {
+            for (int stochastIndex : variableStochastList)
+            {
+                const size_t sourceIndex = variableStochastIndex[stochastIndex];
+
+                for (size_t j = 0; j < count; j++)
+                {
+                    double xSource = xColumns[sourceIndex * count + j];
+                    xColumns[stochastIndex * count + j] = stochasts[stochastIndex]->definition->getXFromUAndSource(xSource, uColumns[stochastIndex * count + j]);
+                }
+            }
+        }
+
+        for (size_t j = 0; j < count; j++)
+        {
+            double* xValues = batch.getXValues(static_cast<int>(j));
+            for (size_t i = 0; i < stochastCount; i++)
+            {
+                xValues[i] = xColumns[i * count + j];
+            }
+        }
+    }
+
+    void UConverter::assignXValues(const std::vector<double>& expandedUValues, double* xValues)
+    {
         for (size_t i = 0; i < this->stochasts.size(); i++)
         {
             if (!this->hasVariableStochasts || !stochasts[i]->definition->isVariable())
@@ -443,8 +539,6 @@ namespace Deltares::Models
                 xValues[stochastIndex] = stochasts[stochastIndex]->definition->getXFromUAndSource(xSource, expandedUValues[stochastIndex]);
             }
         }
-
-        return xValues;
     }
 
     std::vector<double> UConverter::getValuesFromType(Statistics::RunValuesType type) const
@@ -720,10 +814,18 @@ namespace Deltares::Models
     {
         std::vector<double> uValues = this->getExpandedUValues(sample);
 
+        std::vector<std::shared_ptr<Statistics::Stochast>> stochasts;
+        std::vector<double> varyingUValues;
+
         for (int i = 0; i < this->getVaryingStochastCount(); i++)
         {
-            correlationMatrixBuilder->registerStochastValue(this->varyingStochasts[i]->definition, uValues[varyingStochastIndex[i]]);
+            stochasts.push_back(this->varyingStochasts[i]->definition);
+            varyingUValues.push_back(uValues[varyingStochastIndex[i]]);
         }
+
+        const double weight = std::isnan(sample->Weight) ? 1.0 : sample->Weight;
+
+        correlationMatrixBuilder->registerStochastValues(stochasts, varyingUValues, sample->Z, weight);
     }
 }
 
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "Sample.h"
+#include "SampleBatch.h"
 #include "StochastPoint.h"
 #include "ComputationalStochast.h"
 #include "../Statistics/Stochast.h"
@@ -60,6 +61,8 @@ namespace Deltares::Models
         void updateDependentParameter(std::vector<double>& uValues, const int i);
         std::shared_ptr<Sample> getQualitativeExcludedSample(std::shared_ptr<Sample> sample);
         std::vector<int> getVariableStochastIndex();
+        std::vector<double> getExpandedUValues(const std::vector<double>& values);
+        void assignXValues(const std::vector<double>& expandedUValues, double* xValues);
 
     public:
 
@@ -68,6 +71,7 @@ namespace Deltares::Models
         std::vector<double> getUValues(std::shared_ptr<Sample> sample);
         std::vector<double> getExpandedUValues(std::shared_ptr<Sample> sample);
         std::vector<double> getXValues(std::shared_ptr<Sample> sample);
+        void getXValues(SampleBatch& batch);
         std::vector<double> getValuesFromType(Statistics::RunValuesType type) const;
         int getStochastCount();
         int getVaryingStochastCount();
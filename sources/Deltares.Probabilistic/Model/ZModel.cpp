@@ -21,7 +21,13 @@
 //
 #include "ZModel.h"
 
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
 #include <omp.h>
 
 #include "ModelSample.h"
@@ -46,6 +52,8 @@ namespace Deltares::Models
     {
         this->zLambda = nullptr;
         this->zMultipleLambda = nullptr;
+        this->zBatchLambda = nullptr;
+        this->zMultipleBatchLambda = nullptr;
     }
 
     ZLambda ZModel::getLambdaFromZValuesCallBack(ZValuesCallBack zValuesLambda) const
@@ -109,6 +117,39 @@ namespace Deltares::Models
         return calcValuesLambda;
     }
 
+    ZMultipleLambda ZModel::getLambdaFromZValuesBatchCallBack(ZValuesBatchCallBack zValuesBatchLambda) const
+    {
+        ZMultipleLambda calcValuesLambda = [zValuesBatchLambda, this](std::vector<std::shared_ptr<ModelSample>> samples)
+        {
+            const size_t inputSize = this->inputParametersCount;
+            const size_t outputSize = this->outputParametersCount;
+
+            std::vector<double> inputValues(samples.size() * inputSize);
+            std::vector<double> outputValues(samples.size() * outputSize, std::nan(""));
+            for (size_t i = 0; i < samples.size(); i++)
+            {
+                std::copy_n(samples[i]->Values.begin(), std::min(inputSize, samples[i]->Values.size()), inputValues.begin() + i * inputSize);
+            }
+
+            try
+            {
+                (*zValuesBatchLambda)(static_cast<int>(samples.size()), inputValues.data(), this->inputParametersCount,
+                    outputValues.data(), this->outputParametersCount);
+            }
+            catch (const std::exception&)
+            {
+                // empty on purpose
+            }
+
+            for (size_t i = 0; i < samples.size(); i++)
+            {
+                samples[i]->OutputValues.assign(outputValues.begin() + i * outputSize, outputValues.begin() + (i + 1) * outputSize);
+            }
+        };
+
+        return calcValuesLambda;
+    }
+
     ZLambda ZModel::getLambdaFromModelSampleCallBack(ModelSampleCallback modelSampleLambda) const
     {
         ZLambda calcValuesLambda = [modelSampleLambda](std::shared_ptr<ModelSample> sample)
@@ -146,6 +187,124 @@ namespace Deltares::Models
         return calcValuesLambda;
     }
 
+    ZBatchLambda ZModel::getBatchLambdaFromZValuesCallBack(ZValuesCallBack zValuesLambda) const
+    {
+        ZBatchLambda calcValuesLambda = [zValuesLambda, this](SampleBatch& batch)
+        {
+#pragma omp parallel for
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                batch.ThreadId[i] = omp_get_thread_num();
+                (*zValuesLambda)(batch.getXValues(i), this->inputParametersCount, batch.getOutputValues(i));
+            }
+        };
+
+        return calcValuesLambda;
+    }
+
+    ZBatchLambda ZModel::getBatchLambdaFromZValuesMultipleCallBack(ZValuesMultipleCallBack zValuesMultipleLambda) const
+    {
+        ZBatchLambda calcValuesLambda = [zValuesMultipleLambda, this](SampleBatch& batch)
+        {
+            std::vector<double*> inputValues(batch.getSize());
+            std::vector<double*> outputValues(batch.getSize());
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                inputValues[i] = batch.getXValues(i);
+                outputValues[i] = batch.getOutputValues(i);
+            }
+
+            try
+            {
+                (*zValuesMultipleLambda)(batch.getSize(), inputValues.data(), this->inputParametersCount, outputValues.data());
+            }
+            catch (const std::exception&)
+            {
+                // empty on purpose
+            }
+        };
+
+        return calcValuesLambda;
+    }
+
+    ZBatchLambda ZModel::getBatchLambdaFromZValuesBatchCallBack(ZValuesBatchCallBack zValuesBatchLambda) const
+    {
+        ZBatchLambda calcValuesLambda = [zValuesBatchLambda, this](SampleBatch& batch)
+        {
+            // the x-values of the batch are already one block, only copy them when the row size differs from the model
+            const double* inputValues = batch.XValues.data();
+            std::vector<double> copiedValues;
+            if (batch.getInputSize() != this->inputParametersCount)
+            {
+                const size_t inputSize = this->inputParametersCount;
+                const size_t copySize = std::min(inputSize, static_cast<size_t>(std::max(0, batch.getInputSize())));
+                copiedValues.resize(static_cast<size_t>(batch.getSize()) * inputSize, 0.0);
+                for (int i = 0; i < batch.getSize(); i++)
+                {
+                    std::copy_n(batch.getXValues(i), copySize, copiedValues.begin() + i * inputSize);
+                }
+                inputValues = copiedValues.data();
+            }
+
+            std::fill(batch.OutputValues.begin(), batch.OutputValues.end(), std::nan(""));
+
+            try
+            {
+                (*zValuesBatchLambda)(batch.getSize(), inputValues, this->inputParametersCount,
+                    batch.OutputValues.data(), batch.getOutputSize());
+            }
+            catch (const std::exception&)
+            {
+                // empty on purpose
+            }
+        };
+
+        return calcValuesLambda;
+    }
+
+    ZBatchLambda ZModel::getBatchLambdaFromModelSampleCallBack(ModelSampleCallback modelSampleLambda) const
+    {
+        ZBatchLambda calcValuesLambda = [modelSampleLambda](SampleBatch& batch)
+        {
+#pragma omp parallel for
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                batch.ThreadId[i] = omp_get_thread_num();
+
+                ModelSampleStruct modelSampleStruct;
+                batch.fillModelSampleStruct(i, &modelSampleStruct);
+
+                (*modelSampleLambda)(&modelSampleStruct);
+
+                batch.setModelSampleStruct(i, &modelSampleStruct);
+            }
+        };
+
+        return calcValuesLambda;
+    }
+
+    ZBatchLambda ZModel::getBatchLambdaFromMultipleModelSampleCallBack(MultipleModelSampleCallback modelSampleLambda) const
+    {
+        ZBatchLambda calcValuesLambda = [modelSampleLambda](SampleBatch& batch)
+        {
+            std::vector<ModelSampleStruct> modelSamples(batch.getSize());
+
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                batch.fillModelSampleStruct(i, &modelSamples[i]);
+            }
+
+            (*modelSampleLambda)(modelSamples.data(), batch.getSize());
+
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                batch.setModelSampleStruct(i, &modelSamples[i]);
+            }
+        };
+
+        return calcValuesLambda;
+    }
+
     void ZModel::initializeForRun()
     {
         this->inputParametersCount = 0;
@@ -204,9 +363,9 @@ namespace Deltares::Models
 
     void ZModel::invoke(const std::shared_ptr<ModelSample>& sample)
     {
-        std::shared_ptr<ModelSample> alreadyExecutedSample = isRepositoryAllowed ? repository.retrieveSample(sample) : nullptr;
+        const bool executed = !retrieveSample(sample);
 
-        if (alreadyExecutedSample == nullptr)
+        if (executed)
         {
             if (measureCalculationTime && isRepositoryAllowed)
             {
@@ -229,20 +388,43 @@ namespace Deltares::Models
                 repository.registerSample(sample);
             }
         }
-        else
-        {
-            sample->copyFrom(alreadyExecutedSample);
-        }
 
         if (!useZFromSample)
         {
             this->zValueConverter->updateZValue(sample);
         }
+
+        // the z-value is only known after the conversion for models which only provide output values
+        if (executed && persistentRepository != nullptr && isRepositoryAllowed)
+        {
+            persistentRepository->registerSample(sample);
+        }
+
         this->handleInvalidSample(sample);
 
+        // samples are also calculated in parallel, for example per direction in directional sampling
+#pragma omp atomic
         this->modelRuns++;
     }
 
+    bool ZModel::retrieveSample(const std::shared_ptr<ModelSample>& sample)
+    {
+        if (!isRepositoryAllowed)
+        {
+            return false;
+        }
+
+        std::shared_ptr<ModelSample> alreadyExecutedSample = repository.retrieveSample(sample);
+
+        if (alreadyExecutedSample != nullptr)
+        {
+            sample->copyFrom(alreadyExecutedSample);
+            return true;
+        }
+
+        return persistentRepository != nullptr && persistentRepository->retrieveSample(sample);
+    }
+
     void ZModel::invokeLambda(std::shared_ptr<ModelSample> sample) const
     {
         if (this->zLambda == nullptr)
@@ -276,16 +458,10 @@ namespace Deltares::Models
 
         for (const std::shared_ptr<ModelSample>& sample : samples)
         {
-            std::shared_ptr<ModelSample> alreadyExecutedSample = isRepositoryAllowed ? repository.retrieveSample(sample) : nullptr;
-
-            if (alreadyExecutedSample == nullptr)
+            if (!retrieveSample(sample))
             {
                 executeSamples.push_back(sample);
             }
-            else
-            {
-                sample->copyFrom(alreadyExecutedSample);
-            }
         }
 
         if (!executeSamples.empty())
@@ -319,14 +495,302 @@ namespace Deltares::Models
             }
         }
 
-        for (size_t i = 0; i < samples.size(); i++)
+        if (!useZFromSample)
+        {
+            for (const std::shared_ptr<ModelSample>& sample : samples)
+            {
+                this->zValueConverter->updateZValue(sample);
+            }
+        }
+
+        // the z-value is only known after the conversion for models which only provide output values
+        if (persistentRepository != nullptr && isRepositoryAllowed)
+        {
+            for (const std::shared_ptr<ModelSample>& sample : executeSamples)
+            {
+                persistentRepository->registerSample(sample);
+            }
+        }
+
+        for (const std::shared_ptr<ModelSample>& sample : samples)
+        {
+            this->handleInvalidSample(sample);
+        }
+    }
+
+    bool ZModel::canInvokeStreamed() const
+    {
+        // a callback for multiple samples decides itself how to calculate the samples,
+        // in a parallel region no threads are available to calculate the stream
+        return zLambda != nullptr && zMultipleLambda == nullptr && maxProcesses > 1 && !omp_in_parallel();
+    }
+
+    void ZModel::invokeStreamed(const NextModelSampleLambda& nextSample, const ProcessModelSampleLambda& processSample)
+    {
+        struct StreamItem
         {
-            if (!useZFromSample)
+            std::shared_ptr<ModelSample> sample;
+            bool executed = false;
+            bool ready = false;
+            long long elapsedTime = 0;
+        };
+
+        const size_t maxPending = static_cast<size_t>(streamedSamplesPerProcess) * maxProcesses;
+
+        std::deque<std::shared_ptr<StreamItem>> pending;
+        std::mutex mutex;
+        std::condition_variable readyCondition;
+        std::atomic<bool> cancelled = false;
+        std::exception_ptr exception = nullptr;
+
+        // one thread provides and processes the samples, the other threads calculate them
+#pragma omp parallel num_threads(maxProcesses + 1)
+#pragma omp single
+        {
+            const int providingThread = omp_get_thread_num();
+
+            // when the team has only one thread (thread limit), nobody else runs the tasks and they are executed immediately
+            const bool concurrent = omp_get_num_threads() >= 2;
+
+            try
+            {
+                bool provided = true;
+
+                while (true)
+                {
+                    while (provided && pending.size() < maxPending)
+                    {
+                        std::shared_ptr<ModelSample> sample = nextSample();
+                        if (sample == nullptr)
+                        {
+                            provided = false;
+                            break;
+                        }
+
+                        auto item = std::make_shared<StreamItem>();
+                        item->sample = sample;
+                        pending.push_back(item);
+
+                        if (retrieveSample(sample))
+                        {
+                            item->ready = true;
+                        }
+                        else
+                        {
+                            item->executed = true;
+
+#pragma omp task if(concurrent) firstprivate(item) shared(mutex, readyCondition, cancelled, exception)
+                            {
+                                if (!cancelled)
+                                {
+                                    try
+                                    {
+                                        // thread ids of the calculating threads are kept below the maximum number of processes
+                                        const int threadId = omp_get_thread_num();
+                                        item->sample->threadId = threadId > providingThread ? threadId - 1 : threadId;
+
+                                        std::chrono::time_point start = std::chrono::high_resolution_clock::now();
+                                        this->zLambda(item->sample);
+                                        std::chrono::time_point end = std::chrono::high_resolution_clock::now();
+
+                                        item->elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+                                    }
+                                    catch (...)
+                                    {
+                                        std::lock_guard lock(mutex);
+                                        if (exception == nullptr)
+                                        {
+                                            exception = std::current_exception();
+                                        }
+                                        cancelled = true;
+                                    }
+                                }
+
+                                {
+                                    std::lock_guard lock(mutex);
+                                    item->ready = true;
+                                }
+                                readyCondition.notify_all();
+                            }
+                        }
+                    }
+
+                    if (pending.empty())
+                    {
+                        break;
+                    }
+
+                    std::shared_ptr<StreamItem> item = pending.front();
+                    pending.pop_front();
+
+                    bool failed;
+                    {
+                        std::unique_lock lock(mutex);
+                        readyCondition.wait(lock, [&item] { return item->ready; });
+                        failed = exception != nullptr;
+                    }
+
+                    if (failed)
+                    {
+                        break;
+                    }
+
+                    if (item->executed)
+                    {
+                        if (measureCalculationTime && isRepositoryAllowed)
+                        {
+                            RegisterCalculationTime(item->elapsedTime);
+                        }
+
+                        if (useSampleRepository && isRepositoryAllowed && !item->sample->UsedProxy)
+                        {
+                            repository.registerSample(item->sample);
+                        }
+
+                        this->modelRuns++;
+                    }
+
+                    if (!useZFromSample)
+                    {
+                        this->zValueConverter->updateZValue(item->sample);
+                    }
+
+                    if (item->executed && persistentRepository != nullptr && isRepositoryAllowed)
+                    {
+                        persistentRepository->registerSample(item->sample);
+                    }
+
+                    this->handleInvalidSample(item->sample);
+
+                    if (!processSample(item->sample))
+                    {
+                        break;
+                    }
+                }
+            }
+            catch (...)
             {
-                this->zValueConverter->updateZValue(samples[i]);
+                std::lock_guard lock(mutex);
+                if (exception == nullptr)
+                {
+                    exception = std::current_exception();
+                }
             }
 
-            this->handleInvalidSample(samples[i]);
+            // samples which have not been started yet are not calculated anymore
+            cancelled = true;
+
+#pragma omp taskwait
+        }
+
+        if (exception != nullptr)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    void ZModel::setCacheFile(const std::string& fileName, const std::string& tag)
+    {
+        if (fileName.empty())
+        {
+            this->persistentRepository = nullptr;
+            return;
+        }
+
+        const std::uint64_t modelKey = PersistentSampleRepository::getModelKey(this->name, this->inputParameters, this->outputParameters, tag);
+
+        // keep the samples already read when the same file is used again
+        if (this->persistentRepository == nullptr || this->persistentRepository->getFileName() != fileName ||
+            this->persistentRepository->getModelKey() != modelKey)
+        {
+            this->persistentRepository = std::make_shared<PersistentSampleRepository>(fileName, modelKey);
+        }
+    }
+
+    bool ZModel::canInvokeBatch() const
+    {
+        // the repository works with model samples
+        if (isRepositoryAllowed && (useSampleRepository || !repository.isEmpty() || persistentRepository != nullptr))
+        {
+            return false;
+        }
+
+        return zMultipleBatchLambda != nullptr || (zMultipleLambda == nullptr && zBatchLambda != nullptr);
+    }
+
+    void ZModel::invokeBatchLambda(SampleBatch& batch) const
+    {
+        if (zMultipleBatchLambda != nullptr)
+        {
+            this->zMultipleBatchLambda(batch);
+        }
+        else
+        {
+            this->zBatchLambda(batch);
+        }
+    }
+
+    void ZModel::invoke(SampleBatch& batch)
+    {
+        if (!canInvokeBatch())
+        {
+            std::vector<std::shared_ptr<ModelSample>> samples(batch.getSize());
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                samples[i] = batch.getModelSample(i);
+            }
+
+            this->invoke(samples);
+
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                batch.setModelSample(i, *samples[i]);
+            }
+
+            return;
+        }
+
+        if (batch.getSize() == 0)
+        {
+            return;
+        }
+
+        batch.setOutputSize(this->outputParametersCount);
+
+        if (this->measureCalculationTime && isRepositoryAllowed)
+        {
+            std::chrono::time_point started = std::chrono::high_resolution_clock::now();
+            invokeBatchLambda(batch);
+            std::chrono::time_point done = std::chrono::high_resolution_clock::now();
+
+            long long elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(done - started).count();
+
+            RegisterCalculationTime(elapsedTime, batch.getSize());
+        }
+        else
+        {
+            invokeBatchLambda(batch);
+        }
+
+        this->modelRuns += batch.getSize();
+
+        if (!useZFromSample)
+        {
+            this->zValueConverter->updateZValues(batch);
+        }
+
+        for (int i = 0; i < batch.getSize(); i++)
+        {
+            this->handleInvalidValue(batch.Z[i]);
+        }
+
+        // the calculation time of this batch may have switched on the repository, later batches use the sample path
+        if (useSampleRepository && isRepositoryAllowed)
+        {
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                repository.registerSample(batch.getModelSample(i));
+            }
         }
     }
 
@@ -337,15 +801,20 @@ namespace Deltares::Models
 
     void ZModel::handleInvalidSample(const std::shared_ptr<ModelSample>& sample) const
     {
-        if (std::isnan(sample->Z))
+        this->handleInvalidValue(sample->Z);
+    }
+
+    void ZModel::handleInvalidValue(double& z) const
+    {
+        if (std::isnan(z))
         {
             switch (handleInvalidType)
             {
                 using enum HandleInvalidType;
 
                 case Ignore: break; // nothing to do
-                case Fail: sample->Z = -std::numeric_limits<double>::max();  break;
-                case NoFail: sample->Z = std::numeric_limits<double>::max();  break;
+                case Fail: z = -std::numeric_limits<double>::max();  break;
+                case NoFail: z = std::numeric_limits<double>::max();  break;
                 default: throw Reliability::probLibException("invalid handle type not known");
             }
         }
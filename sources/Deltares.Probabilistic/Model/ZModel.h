@@ -25,18 +25,24 @@
 
 #include "ModelInputParameter.h"
 #include "ModelSample.h"
+#include "SampleBatch.h"
 #include "RunSettings.h"
 #include "ZValueConverter.h"
 #include "SampleRepository.h"
+#include "PersistentSampleRepository.h"
 
 namespace Deltares::Models
 {
     using ZLambda = std::function<void(std::shared_ptr<ModelSample>)>;
     using ZMultipleLambda = std::function<void(std::vector<std::shared_ptr<ModelSample>>)>;
     using ZBetaLambda = std::function<double(std::shared_ptr<ModelSample>)>;
+    using ZBatchLambda = std::function<void(SampleBatch&)>;
+    using NextModelSampleLambda = std::function<std::shared_ptr<ModelSample>()>;
+    using ProcessModelSampleLambda = std::function<bool(const std::shared_ptr<ModelSample>&)>;
 
     using ZValuesCallBack = void(*)(const double* data, int size, double* outputValues);
     using ZValuesMultipleCallBack = void(*)(int arraySize, double** data, int inputSize, double** outputValues);
+    using ZValuesBatchCallBack = void(*)(int arraySize, const double* data, int inputSize, double* outputValues, int outputSize);
     using EmptyCallBack = void(*)();
 
     using ProgressCallBack = void(*)(double progress);
@@ -57,9 +63,11 @@ namespace Deltares::Models
         ZModel(ZValuesCallBack zValuesLambda, ZValuesMultipleCallBack zValuesMultipleLambda = nullptr)
         {
             this->zLambda = this->getLambdaFromZValuesCallBack(zValuesLambda);
+            this->zBatchLambda = this->getBatchLambdaFromZValuesCallBack(zValuesLambda);
             if (zValuesMultipleLambda != nullptr)
             {
                 this->zMultipleLambda = this->getLambdaFromZValuesMultipleCallBack(zValuesMultipleLambda);
+                this->zMultipleBatchLambda = this->getBatchLambdaFromZValuesMultipleCallBack(zValuesMultipleLambda);
             }
 
             callbackAssigned = this->zLambda != nullptr;
@@ -68,16 +76,39 @@ namespace Deltares::Models
         void setMultipleCallback(ZValuesMultipleCallBack multipleCallBack)
         {
             this->zMultipleLambda = this->getLambdaFromZValuesMultipleCallBack(multipleCallBack);
+            this->zMultipleBatchLambda = this->getBatchLambdaFromZValuesMultipleCallBack(multipleCallBack);
+        }
+
+        /**
+         * \brief Sets a callback which calculates all samples at once in one contiguous block
+         * \remark The input values are passed row by row (array size x input size), the callback
+         *         fills the output values row by row (array size x output size)
+         */
+        void setBatchCallback(ZValuesBatchCallBack batchCallBack)
+        {
+            this->zMultipleLambda = this->getLambdaFromZValuesBatchCallBack(batchCallBack);
+            this->zMultipleBatchLambda = this->getBatchLambdaFromZValuesBatchCallBack(batchCallBack);
         }
 
         void setModelSampleCallback(Models::ModelSampleCallback modelSampleCallBack)
         {
             this->zLambda = this->getLambdaFromModelSampleCallBack(modelSampleCallBack);
+            this->zBatchLambda = this->getBatchLambdaFromModelSampleCallBack(modelSampleCallBack);
         }
 
         void setMultipleModelSampleCallback(Models::MultipleModelSampleCallback modelSampleCallBack)
         {
             this->zMultipleLambda = this->getLambdaFromMultipleModelSampleCallBack(modelSampleCallBack);
+            this->zMultipleBatchLambda = this->getBatchLambdaFromMultipleModelSampleCallBack(modelSampleCallBack);
+        }
+
+        /**
+         * \brief Sets a callback which calculates all samples in a batch at once
+         * \remark The callback should fill the output values or the z-values of the batch
+         */
+        void setBatchLambda(const ZBatchLambda& batchLambda)
+        {
+            this->zMultipleBatchLambda = batchLambda;
         }
 
         /**
@@ -152,6 +183,26 @@ namespace Deltares::Models
          */
         virtual void invoke(const std::vector<std::shared_ptr<ModelSample>>& samples);
 
+        /**
+         * \brief Calculates a batch of samples
+         * \remark The x-values of the batch should have been assigned
+         */
+        virtual void invoke(SampleBatch& batch);
+
+        /**
+         * \brief Indicates whether samples can be calculated as a stream, see invokeStreamed()
+         */
+        bool canInvokeStreamed() const;
+
+        /**
+         * \brief Calculates samples as a stream, a new sample is started as soon as a process becomes available
+         * \param nextSample Provides the next sample to be calculated, returns nullptr when there are no more samples
+         * \param processSample Processes a calculated sample, returns false to stop the stream
+         * \remark Samples are processed in the order in which they were provided, so results do not depend on calculation times.
+         *         Samples which were provided but not yet processed when the stream stops are discarded.
+         */
+        void invokeStreamed(const NextModelSampleLambda& nextSample, const ProcessModelSampleLambda& processSample);
+
         double getBeta(std::shared_ptr<ModelSample> sample) const;
 
         bool canCalculateBeta() const
@@ -184,6 +235,42 @@ namespace Deltares::Models
             this->repository.clear();
         }
 
+        void setMaxRepositorySize(int maxSize)
+        {
+            this->repository.setMaxSize(maxSize);
+        }
+
+        /**
+         * \brief Gets the number of samples retrieved from the repository instead of being calculated
+         */
+        long long getRepositoryHits() const
+        {
+            return this->repository.getHits();
+        }
+
+        /**
+         * \brief Gets the number of samples not found in a non empty repository
+         */
+        long long getRepositoryMisses() const
+        {
+            return this->repository.getMisses();
+        }
+
+        /**
+         * \brief Sets the file in which model results are stored for reuse in other runs
+         * \param fileName Name of the file, an empty name means that results are not stored in a file
+         * \param tag Tag identifying the model version, results stored with another tag are not reused
+         */
+        void setCacheFile(const std::string& fileName, const std::string& tag);
+
+        /**
+         * \brief Gets the number of samples retrieved from the cache file instead of being calculated
+         */
+        long long getCacheHits() const
+        {
+            return this->persistentRepository != nullptr ? this->persistentRepository->getHits() : 0;
+        }
+
         /**
          * \brief Reports whether these settings have valid values
          * \param report Report in which the validity is reported
@@ -211,6 +298,8 @@ namespace Deltares::Models
         ZLambda zLambda = nullptr;
         ZMultipleLambda zMultipleLambda = nullptr;
         ZBetaLambda zBetaLambda = nullptr;
+        ZBatchLambda zBatchLambda = nullptr;
+        ZBatchLambda zMultipleBatchLambda = nullptr;
         EmptyCallBack runMethod = nullptr;
         EmptyCallBack nextMethod = nullptr;
         int maxProcesses = 1;
@@ -219,11 +308,28 @@ namespace Deltares::Models
         int outputParametersCount = 0;
         ZLambda getLambdaFromZValuesCallBack(ZValuesCallBack zValuesLambda) const;
         ZMultipleLambda getLambdaFromZValuesMultipleCallBack(ZValuesMultipleCallBack zValuesMultipleLambda) const;
+        ZMultipleLambda getLambdaFromZValuesBatchCallBack(ZValuesBatchCallBack zValuesBatchLambda) const;
         HandleInvalidType handleInvalidType = HandleInvalidType::Ignore;
 
         ZLambda getLambdaFromModelSampleCallBack(ModelSampleCallback modelSampleLambda) const;
         ZMultipleLambda getLambdaFromMultipleModelSampleCallBack(MultipleModelSampleCallback modelSampleLambda) const;
 
+        ZBatchLambda getBatchLambdaFromZValuesCallBack(ZValuesCallBack zValuesLambda) const;
+        ZBatchLambda getBatchLambdaFromZValuesMultipleCallBack(ZValuesMultipleCallBack zValuesMultipleLambda) const;
+        ZBatchLambda getBatchLambdaFromZValuesBatchCallBack(ZValuesBatchCallBack zValuesBatchLambda) const;
+        ZBatchLambda getBatchLambdaFromModelSampleCallBack(ModelSampleCallback modelSampleLambda) const;
+        ZBatchLambda getBatchLambdaFromMultipleModelSampleCallBack(MultipleModelSampleCallback modelSampleLambda) const;
+
+        /**
+         * \brief Indicates whether a batch can be calculated without converting it to model samples
+         */
+        bool canInvokeBatch() const;
+
+        /**
+         * \brief Calculates a batch of samples, which has been prepared to be calculated directly
+         */
+        void invokeBatchLambda(SampleBatch& batch) const;
+
         /**
          * \brief Calculates a sample
          */
@@ -234,6 +340,17 @@ namespace Deltares::Models
          */
         void invokeMultipleLambda(std::vector<std::shared_ptr<ModelSample>>& samples) const;
 
+        /**
+         * \brief Retrieves the results of a sample from the repository or the cache file
+         * \return Indication whether the results were found
+         */
+        bool retrieveSample(const std::shared_ptr<ModelSample>& sample);
+
+        /**
+         * \brief Number of samples per process which can be in progress or waiting to be processed in a stream
+         */
+        static constexpr int streamedSamplesPerProcess = 4;
+
         /**
          * \brief Handles the calculation time
          */
@@ -274,11 +391,22 @@ namespace Deltares::Models
          */
         SampleRepository repository = SampleRepository();
 
+        /**
+         * \brief Holds calculated samples of this and previous runs in a file
+         */
+        std::shared_ptr<PersistentSampleRepository> persistentRepository = nullptr;
+
         /**
          * \brief Handles an invalid sample
          * \param sample The sample which can be invalid
          */
         void handleInvalidSample(const std::shared_ptr<ModelSample>& sample) const;
+
+        /**
+         * \brief Handles an invalid result in a batch
+         * \param z The z-value which can be invalid
+         */
+        void handleInvalidValue(double& z) const;
     };
 }
 
@@ -20,3 +20,18 @@
 // All rights reserved.
 //
 #include "ZValueConverter.h"
+
+namespace Deltares::Models
+{
+    void ZValueConverter::updateZValues(SampleBatch& batch)
+    {
+        auto sample = std::make_shared<ModelSample>(std::vector<double>(batch.getInputSize()));
+
+        for (int i = 0; i < batch.getSize(); i++)
+        {
+            batch.fillModelSample(i, *sample);
+            this->updateZValue(sample);
+            batch.Z[i] = sample->Z;
+        }
+    }
+}
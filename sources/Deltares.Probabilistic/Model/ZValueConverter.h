@@ -24,6 +24,7 @@
 
 #include "ModelInputParameter.h"
 #include "ModelSample.h"
+#include "SampleBatch.h"
 
 namespace Deltares::Models
 {
@@ -32,6 +33,12 @@ namespace Deltares::Models
     public:
         virtual void initialize(std::vector<std::shared_ptr<ModelInputParameter>>& inputParameters, std::vector<std::shared_ptr<ModelInputParameter>>& outputParameters) {}
         virtual void updateZValue(std::shared_ptr<ModelSample> sample) {}
+
+        /**
+         * \brief Updates the z-values of all samples in a batch
+         * \remark By default each row is converted via a model sample, derived classes can override this with a direct implementation
+         */
+        virtual void updateZValues(SampleBatch& batch);
         virtual std::string getIdentifier() { return "z"; }
     };
 }
@@ -22,6 +22,10 @@
 #include "GridSearch.h"
 #include "../Math/NumericSupport.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace Deltares::Optimization
 {
     std::shared_ptr<Models::ModelSample> GridSearch::getOptimizedSample(std::shared_ptr<SearchParameterSettingsSet> searchArea, std::shared_ptr<Models::ZModel> model)
@@ -43,15 +47,22 @@ namespace Deltares::Optimization
                 reusedCounter = 0;
             }
 
-            int refinements = 0;
-            while (canRefine(searchArea, refinements))
+            if (UseNelderMead)
             {
-                refineGrid(searchArea, refinements, sample);
-                sample = findGridExtreme(searchArea, model, sample, 1 + gridMoves + refinements);
-                refinements++;
+                sample = refineByNelderMead(searchArea, model, sample);
+            }
+            else
+            {
+                int refinements = 0;
+                while (canRefine(searchArea, refinements))
+                {
+                    refineGrid(searchArea, refinements, sample);
+                    sample = findGridExtreme(searchArea, model, sample, 1 + gridMoves + refinements);
+                    refinements++;
 
-                counter = 0;
-                reusedCounter = 0;
+                    counter = 0;
+                    reusedCounter = 0;
+                }
             }
         }
 
@@ -73,20 +84,19 @@ namespace Deltares::Optimization
             throw Reliability::probLibException("No dimensions or empty dimensions are not allowed");
         }
 
-        int gridCounter = 0;
-        int gridIntervalCounter = 0;
-
-        for (auto combination : combinations)
+        std::vector<std::shared_ptr<Models::ModelSample>> samples;
+        for (const std::vector<double>& combination : combinations)
         {
-            gridCounter++;
-            gridIntervalCounter++;
-
-            const std::shared_ptr<Models::ModelSample> sample = std::make_shared<Models::ModelSample>(combination);
+            samples.push_back(std::make_shared<Models::ModelSample>(combination));
+        }
 
-            model->invoke(sample);
+        // the model calculates all grid points in one batch, in parallel if possible
+        model->invoke(samples);
 
-            counter++;
+        counter += static_cast<int>(samples.size());
 
+        for (const std::shared_ptr<Models::ModelSample>& sample : samples)
+        {
             if (!std::isnan(sample->Z) && (minSample == nullptr || sample->Z < minSample->Z))
             {
                 minSample = sample;
@@ -193,6 +203,144 @@ namespace Deltares::Optimization
         }
     }
 
+    std::shared_ptr<Models::ModelSample> GridSearch::refineByNelderMead(std::shared_ptr<SearchParameterSettingsSet> searchArea, std::shared_ptr<Models::ZModel> model, std::shared_ptr<Models::ModelSample> sample)
+    {
+        constexpr double reflection = 1.0;
+        constexpr double expansion = 2.0;
+        constexpr double contraction = 0.5;
+        constexpr double shrinkage = 0.5;
+
+        const size_t nDimensions = searchArea->Dimensions.size();
+
+        // initial simplex: the grid minimum and a step of one grid interval in each refinable dimension
+        std::vector<std::shared_ptr<Models::ModelSample>> simplex = { sample };
+        std::vector<double> tolerances(nDimensions, 0);
+
+        std::vector<std::shared_ptr<Models::ModelSample>> newVertices;
+        for (size_t i = 0; i < nDimensions; i++)
+        {
+            std::shared_ptr<SearchParameterSettings> dimension = searchArea->Dimensions[i];
+            const double interval = dimension->getInterval();
+
+            if (dimension->NumberOfRefinements > 0 && dimension->NumberOfValues > 1 && interval > 0)
+            {
+                std::vector<double> values = sample->Values;
+                values[i] += interval;
+                newVertices.push_back(std::make_shared<Models::ModelSample>(values));
+
+                tolerances[i] = interval * std::pow(0.5, dimension->NumberOfRefinements);
+            }
+        }
+
+        if (newVertices.empty())
+        {
+            return sample;
+        }
+
+        model->invoke(newVertices);
+        counter += static_cast<int>(newVertices.size());
+
+        simplex.insert(simplex.end(), newVertices.begin(), newVertices.end());
+
+        auto getVertex = [&model, this](const std::vector<double>& values)
+        {
+            std::shared_ptr<Models::ModelSample> vertex = std::make_shared<Models::ModelSample>(values);
+            model->invoke(vertex);
+            counter++;
+            return vertex;
+        };
+
+        auto combine = [nDimensions](const std::vector<double>& center, const std::vector<double>& point, double factor)
+        {
+            std::vector<double> values(nDimensions);
+            for (size_t i = 0; i < nDimensions; i++)
+            {
+                values[i] = center[i] + factor * (point[i] - center[i]);
+            }
+            return values;
+        };
+
+        for (int iteration = 0; iteration < MaxNelderMeadIterations; iteration++)
+        {
+            std::ranges::stable_sort(simplex, [](const std::shared_ptr<Models::ModelSample>& s1, const std::shared_ptr<Models::ModelSample>& s2)
+                { return getMinimizedValue(s1) < getMinimizedValue(s2); });
+
+            const std::shared_ptr<Models::ModelSample> best = simplex.front();
+            const std::shared_ptr<Models::ModelSample> worst = simplex.back();
+
+            bool converged = true;
+            for (const std::shared_ptr<Models::ModelSample>& vertex : simplex)
+            {
+                for (size_t i = 0; i < nDimensions; i++)
+                {
+                    converged &= std::fabs(vertex->Values[i] - best->Values[i]) <= tolerances[i];
+                }
+            }
+
+            if (converged)
+            {
+                break;
+            }
+
+            std::vector<double> centroid(nDimensions, 0);
+            for (size_t j = 0; j + 1 < simplex.size(); j++)
+            {
+                for (size_t i = 0; i < nDimensions; i++)
+                {
+                    centroid[i] += simplex[j]->Values[i] / static_cast<double>(simplex.size() - 1);
+                }
+            }
+
+            std::shared_ptr<Models::ModelSample> reflected = getVertex(combine(centroid, worst->Values, -reflection));
+
+            if (getMinimizedValue(reflected) < getMinimizedValue(best))
+            {
+                std::shared_ptr<Models::ModelSample> expanded = getVertex(combine(centroid, worst->Values, -expansion));
+                simplex.back() = getMinimizedValue(expanded) < getMinimizedValue(reflected) ? expanded : reflected;
+            }
+            else if (getMinimizedValue(reflected) < getMinimizedValue(simplex[simplex.size() - 2]))
+            {
+                simplex.back() = reflected;
+            }
+            else
+            {
+                const bool outside = getMinimizedValue(reflected) < getMinimizedValue(worst);
+                std::shared_ptr<Models::ModelSample> contracted = outside ?
+                    getVertex(combine(centroid, reflected->Values, contraction)) :
+                    getVertex(combine(centroid, worst->Values, contraction));
+
+                if (getMinimizedValue(contracted) < std::min(getMinimizedValue(reflected), getMinimizedValue(worst)))
+                {
+                    simplex.back() = contracted;
+                }
+                else
+                {
+                    // shrink all vertices towards the best vertex
+                    std::vector<std::shared_ptr<Models::ModelSample>> shrunkVertices;
+                    for (size_t j = 1; j < simplex.size(); j++)
+                    {
+                        shrunkVertices.push_back(std::make_shared<Models::ModelSample>(combine(best->Values, simplex[j]->Values, shrinkage)));
+                    }
+
+                    model->invoke(shrunkVertices);
+                    counter += static_cast<int>(shrunkVertices.size());
+
+                    std::ranges::copy(shrunkVertices, simplex.begin() + 1);
+                }
+            }
+        }
+
+        const auto minimum = std::ranges::min_element(simplex, [](const std::shared_ptr<Models::ModelSample>& s1, const std::shared_ptr<Models::ModelSample>& s2)
+            { return getMinimizedValue(s1) < getMinimizedValue(s2); });
+
+        return getMinimizedValue(*minimum) < getMinimizedValue(sample) ? *minimum : sample;
+    }
+
+    double GridSearch::getMinimizedValue(const std::shared_ptr<Models::ModelSample>& sample)
+    {
+        return std::isnan(sample->Z) ? std::numeric_limits<double>::infinity() : sample->Z;
+    }
+
     double GridSearch::getTolerance(std::shared_ptr<SearchParameterSettings> dimension)
     {
         if (dimension->NumberOfValues > 0) 
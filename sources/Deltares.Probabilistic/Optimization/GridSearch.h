@@ -39,6 +39,17 @@ namespace Deltares::Optimization
          */
         int MaxGridMoves = 50;
 
+        /**
+         * \brief Indicates whether the grid refinements are replaced by a Nelder-Mead simplex search, which starts at the minimum of the grid
+         * \remark The simplex search stops when it reaches the resolution which the grid refinements would have reached
+         */
+        bool UseNelderMead = false;
+
+        /**
+         * \brief Maximum number of iterations in the Nelder-Mead simplex search
+         */
+        int MaxNelderMeadIterations = 500;
+
         /**
          * \brief Finds the parameter combination which results in the minimum value
          * \param searchArea Definition of parameter space and settings which will be searched
@@ -47,6 +58,15 @@ namespace Deltares::Optimization
          */
         std::shared_ptr<Models::ModelSample> getOptimizedSample(std::shared_ptr<SearchParameterSettingsSet> searchArea, std::shared_ptr<Models::ZModel> model);
 
+        /**
+         * \brief Refines the minimum found in the grid with a Nelder-Mead simplex search
+         * \param searchArea Definition of parameter space and settings which will be searched
+         * \param model Model to invoke, the minimum z-value will be used
+         * \param sample Minimum sample of the grid, with calculated z-value
+         * \return Sample containing values which lead to the minimum value
+         */
+        std::shared_ptr<Models::ModelSample> refineByNelderMead(std::shared_ptr<SearchParameterSettingsSet> searchArea, std::shared_ptr<Models::ZModel> model, std::shared_ptr<Models::ModelSample> sample);
+
     private:
         /**
          * \brief Finds the parameter combination which results in the minimum value
@@ -88,6 +108,11 @@ namespace Deltares::Optimization
          */
         void refineGrid(std::shared_ptr<SearchParameterSettingsSet> searchArea, int refinements, std::shared_ptr<Models::ModelSample> sample);
 
+        /**
+         * \brief Gets the z-value of a sample to be minimized, invalid values are never minimal
+         */
+        static double getMinimizedValue(const std::shared_ptr<Models::ModelSample>& sample);
+
         /**
          * \brief Gets the tolerance for a parameter when determining whether a value is on the edge of a grid 
          * \param dimension Settings of the parameter
@@ -21,52 +21,98 @@
 //
 #include "KMeansClustering.h"
 
-#include <map>
+#include <algorithm>
+#include <cmath>
 
 #include "../Utils/probLibException.h"
 #include "../Math/NumericSupport.h"
 
 namespace Deltares::Optimization
 {
-    double KMeansClustering::Cluster::getSumSquared() const
+    KMeansClustering::PointMatrix::PointMatrix(const std::vector<std::shared_ptr<Models::Sample>>& samples)
     {
-        double sum = 0.0;
+        this->Count = static_cast<int>(samples.size());
+        this->Dimension = samples.empty() ? 0 : static_cast<int>(samples[0]->Values.size());
 
-        for (const std::shared_ptr<Models::Sample>& sample : this->Samples)
+        this->Values.resize(static_cast<size_t>(this->Count) * this->Dimension);
+        this->Weights.resize(this->Count);
+
+        for (int i = 0; i < this->Count; i++)
         {
-            sum += this->Center->getDistance2(sample);
+            std::copy(samples[i]->Values.begin(), samples[i]->Values.end(), this->Values.begin() + static_cast<size_t>(i) * this->Dimension);
+            this->Weights[i] = samples[i]->Weight;
         }
+    }
 
-        return sum;
+    std::vector<int> KMeansClustering::Clustering::getSizes() const
+    {
+        std::vector<int> sizes(this->NumberClusters, 0);
+
+        for (int assignment : this->Assignments)
+        {
+            sizes[assignment]++;
+        }
+
+        return sizes;
     }
 
-    void KMeansClustering::Cluster::updateMean()
+    void KMeansClustering::Clustering::updateMeans(const PointMatrix& points, std::vector<double>& movements)
     {
-        if (this->Samples.empty())
+        std::vector<double> sums(this->Centers.size(), 0.0);
+        const std::vector<int> sizes = this->getSizes();
+
+        for (int i = 0; i < points.Count; i++)
         {
-            throw Reliability::probLibException("Cluster must have at least one sample");
+            double* sum = sums.data() + static_cast<size_t>(this->Assignments[i]) * this->Dimension;
+            const double* point = points.getPoint(i);
+
+            for (int j = 0; j < this->Dimension; j++)
+            {
+                sum[j] += point[j];
+            }
         }
 
-        this->Center = std::make_shared<Models::Sample>(this->Samples[0]->Values.size());
+        movements.assign(this->NumberClusters, 0.0);
 
-        for (int i = 0; i < this->Center->Values.size(); i++)
+        for (int k = 0; k < this->NumberClusters; k++)
         {
-            double sumValues = 0;
-            for (std::shared_ptr<Models::Sample> sample : this->Samples)
+            if (sizes[k] == 0)
+            {
+                continue; // empty clusters keep their center
+            }
+
+            double* center = this->getCenter(k);
+            const double* sum = sums.data() + static_cast<size_t>(k) * this->Dimension;
+
+            double movement2 = 0.0;
+            for (int j = 0; j < this->Dimension; j++)
             {
-                sumValues += sample->Values[i];
+                const double mean = sum[j] / sizes[k];
+                movement2 += (mean - center[j]) * (mean - center[j]);
+                center[j] = mean;
             }
 
-            this->Center->Values[i] = sumValues / this->Samples.size();
+            movements[k] = std::sqrt(movement2);
+        }
+    }
+
+    void KMeansClustering::Clustering::updateSumSquared(const PointMatrix& points)
+    {
+        this->SumSquared = 0.0;
+
+        for (int i = 0; i < points.Count; i++)
+        {
+            this->SumSquared += getDistance2(points.getPoint(i), this->getCenter(this->Assignments[i]), this->Dimension);
         }
     }
 
-    std::vector<std::shared_ptr<Models::Sample>> KMeansClustering::getCentersFromClusters(const std::vector<std::shared_ptr<Cluster>>& clusters)
+    std::vector<std::shared_ptr<Models::Sample>> KMeansClustering::getCentersFromClusters(const Clustering& clustering)
     {
         std::vector<std::shared_ptr<Models::Sample>> centers;
-        for (const auto& cluster : clusters)
+        for (int k = 0; k < clustering.NumberClusters; k++)
         {
-            centers.push_back(cluster->Center);
+            const double* center = clustering.getCenter(k);
+            centers.push_back(std::make_shared<Models::Sample>(std::vector<double>(center, center + clustering.Dimension)));
         }
 
         return centers;
@@ -74,9 +120,19 @@ namespace Deltares::Optimization
 
     std::vector<std::shared_ptr<Models::Sample>> KMeansClustering::getClusterCenters(std::vector<std::shared_ptr<Models::Sample>> samples)
     {
+        if (samples.empty())
+        {
+            return {};
+        }
+
+        const PointMatrix points = PointMatrix(samples);
+
         if (this->Settings->OptimizeNumberOfClusters)
         {
-            std::vector<std::shared_ptr<Cluster>> clusters;
+            Clustering clusters;
+
+            // distances between the points are calculated once and used for the silhouette coefficient of each number of clusters
+            const std::vector<double> distances = points.Count <= maxSilhouettePoints ? getDistanceMatrix(points) : std::vector<double>();
 
             double score0 = std::numeric_limits<double>::lowest();
             double score1 = std::numeric_limits<double>::lowest();
@@ -92,18 +148,18 @@ namespace Deltares::Optimization
                 fixedClusterOptions.Trials = this->Settings->MaxIterations;
                 fixedClusterOptions.SampleHasWeighting = true;
 
-                std::vector<std::shared_ptr<Cluster>> newClusters = FixedCluster(samples, fixedClusterOptions);
+                Clustering newClusters = FixedCluster(points, fixedClusterOptions);
 
-                double score2 = SilhouetteCoefficient(newClusters);
+                double score2 = SilhouetteCoefficient(points, newClusters, distances);
 
-                if (!clusters.empty() && (score0 > score1 + margin && score1 > score2 + margin))
+                if (clusters.NumberClusters > 0 && (score0 > score1 + margin && score1 > score2 + margin))
                 {
                     break;
                 }
 
                 if (score2 > bestScore + margin)
                 {
-                    clusters = newClusters;
+                    clusters = std::move(newClusters);
                     bestScore = score2;
                 }
                 score0 = score1;
@@ -121,7 +177,7 @@ namespace Deltares::Optimization
                 fixedClusterOptions.Trials = this->Settings->MaxIterations;
                 fixedClusterOptions.SampleHasWeighting = true;
 
-                std::vector<std::shared_ptr<Cluster>> newClusters = FixedCluster(samples, fixedClusterOptions);
+                Clustering newClusters = FixedCluster(points, fixedClusterOptions);
 
                 return getCentersFromClusters(newClusters);
             }
@@ -137,15 +193,15 @@ namespace Deltares::Optimization
             fixedClusterOptions.MaxIterations = this->Settings->MaxIterations;
             fixedClusterOptions.SampleHasWeighting = true;
 
-            std::vector<std::shared_ptr<Cluster>> clusters = FixedCluster(samples, fixedClusterOptions);
+            Clustering clusters = FixedCluster(points, fixedClusterOptions);
 
             return getCentersFromClusters(clusters);
         }
     }
 
-    std::vector<std::shared_ptr<KMeansClustering::Cluster>> KMeansClustering::FixedCluster(std::vector<std::shared_ptr<Models::Sample>>& samples, const ClusterSettings& options)
+    KMeansClustering::Clustering KMeansClustering::FixedCluster(const PointMatrix& points, const ClusterSettings& options) const
     {
-        std::vector<std::shared_ptr<Cluster>> clusters;
+        Clustering clusters;
         double sumSquared = std::numeric_limits<double>::max(); // smaller is better
 
         int unchangedClusters = 0;
@@ -154,113 +210,127 @@ namespace Deltares::Optimization
         Numeric::RandomValueGenerator random;
         random.initialize(true, 0, 0);
 
-        for (int trial = 0; trial < options.Trials; trial++)
+        // each trial draws one random value per additional cluster
+        const int randomValuesPerTrial = std::max(0, options.NumberClusters - 1);
+
+        // trials are performed concurrently in rounds, the random values are drawn in advance in the order of the trials,
+        // so that the result is equal to performing the trials one by one
+        for (int start = 0; start < options.Trials && unchangedClusters < maxUnchangedClusters; start += trialsPerRound)
         {
-            std::vector<std::shared_ptr<Cluster>> newClusters = DoClustering(samples, options, random); // find a clustering and update best cluster
+            const int count = std::min(trialsPerRound, options.Trials - start);
 
-            double newSumSquared = 0;
-            for (const auto& cluster : newClusters)
+            std::vector<double> randomValues(static_cast<size_t>(count) * randomValuesPerTrial);
+            for (double& randomValue : randomValues)
             {
-                newSumSquared += cluster->getSumSquared();
+                randomValue = random.next();
             }
 
-            if (clusters.empty() || newSumSquared < sumSquared - margin) // new best clustering found
-            {
-                unchangedClusters = 0;
-                clusters = newClusters;
-                sumSquared = newSumSquared;
-            }
-            else
+            std::vector<Clustering> newClusters(count);
+
+#pragma omp parallel for
+            for (int trial = 0; trial < count; trial++)
             {
-                unchangedClusters++;
+                newClusters[trial] = DoClustering(points, options, randomValues.data() + static_cast<size_t>(trial) * randomValuesPerTrial); // find a clustering
             }
 
-            if (unchangedClusters >= maxUnchangedClusters)
+            for (int trial = 0; trial < count && unchangedClusters < maxUnchangedClusters; trial++)
             {
-                break;
+                if (clusters.NumberClusters == 0 || newClusters[trial].SumSquared < sumSquared - margin) // new best clustering found
+                {
+                    unchangedClusters = 0;
+                    sumSquared = newClusters[trial].SumSquared;
+                    clusters = std::move(newClusters[trial]);
+                }
+                else
+                {
+                    unchangedClusters++;
+                }
             }
         }
 
         return clusters;
     }
 
-    std::vector<std::shared_ptr<KMeansClustering::Cluster>> KMeansClustering::DoClustering(std::vector<std::shared_ptr<Models::Sample>>& samples, const ClusterSettings& options, Numeric::RandomValueGenerator & randomGenerator)
+    KMeansClustering::Clustering KMeansClustering::DoClustering(const PointMatrix& points, const ClusterSettings& options, const double* randomValues) const
     {
-        std::vector<std::shared_ptr<Cluster>> newClusters = InitializeClusters(samples, options, randomGenerator);
+        Clustering newClusters = InitializeClusters(points, options, randomValues);
 
         bool modified = true; //  result from UpdateClustering (to exit loop)
         int iteration = 0;
 
         while (modified && iteration < options.MaxIterations)
         {
-            modified = updateClustering(newClusters);
+            modified = updateClustering(points, newClusters);
             iteration++;
         }
 
+        newClusters.updateSumSquared(points);
+
         return newClusters;
     }
 
-    std::vector<std::shared_ptr<KMeansClustering::Cluster>> KMeansClustering::InitializeClusters(std::vector<std::shared_ptr<Models::Sample>>& samples, const ClusterSettings& options, Numeric::RandomValueGenerator& randomGenerator)
+    KMeansClustering::Clustering KMeansClustering::InitializeClusters(const PointMatrix& points, const ClusterSettings& options, const double* randomValues)
     {
         switch (options.clusterInitializationMethod)
         {
         case ClusterInitializationMethod::PlusPlus:
-            return InitPlusPlus(options.NumberClusters, samples, randomGenerator, options.SampleHasWeighting);
+            return InitPlusPlus(options.NumberClusters, points, randomValues, options.SampleHasWeighting);
         default:
             throw Reliability::probLibException("Cluster initialization method");
         }
     }
 
-    std::vector<std::shared_ptr<KMeansClustering::Cluster>> KMeansClustering::InitPlusPlus(int numberClusters, std::vector<std::shared_ptr<Models::Sample>>& samples, Numeric::RandomValueGenerator& randomGenerator, bool sampleHasWeighting)
+    KMeansClustering::Clustering KMeansClustering::InitPlusPlus(int numberClusters, const PointMatrix& points, const double* randomValues, bool sampleHasWeighting)
     {
-        std::vector<std::shared_ptr<Cluster>> clusters;
-
-        auto firstCluster = std::make_shared<Cluster>();
-
-        firstCluster->Samples.reserve(samples.size());
-        for (const auto& sample : samples)
+        Clustering clusters;
+        clusters.NumberClusters = numberClusters;
+        clusters.Dimension = points.Dimension;
+        clusters.Centers.assign(static_cast<size_t>(numberClusters) * points.Dimension, 0.0);
+
+        // all points start in the first cluster, with unknown distances
+        clusters.Assignments.assign(points.Count, 0);
+        clusters.UpperBounds.assign(points.Count, std::numeric_limits<double>::max());
+        clusters.LowerBounds.assign(points.Count, 0.0);
+
+        // the first center is the mean of all points
+        std::vector<double> movements;
+        clusters.updateMeans(points, movements);
+
+        // distance from each point to its nearest center, updated each time a center is added
+        std::vector<double> minDistances2(points.Count);
+        for (int i = 0; i < points.Count; i++)
         {
-            firstCluster->Samples.push_back(sample);
+            minDistances2[i] = getDistance2(points.getPoint(i), clusters.getCenter(0), points.Dimension);
         }
 
-        firstCluster->updateMean();
-
-        clusters.push_back(firstCluster);
+        std::vector<double> squaredDistances(points.Count);
 
         for (int k = 1; k < numberClusters; k++) // find each remaining mean
         {
-            std::vector<double> squaredDistances(samples.size()); // from each item to its closest mean
-            int n = 0;
-
-            for (const auto& sample : samples)
+            for (int i = 0; i < points.Count; i++)
             {
-                const auto nearestCluster = getNearestCluster(sample, clusters);
-
-                double distance2 = nearestCluster->Center->getDistance2(sample);
-
-                if (sampleHasWeighting)
-                {
-                    distance2 *= sample->Weight * sample->Weight;
-                }
-
-                squaredDistances[n++] = distance2;
+                squaredDistances[i] = sampleHasWeighting ? minDistances2[i] * points.Weights[i] * points.Weights[i] : minDistances2[i];
             }
 
             // select an item far from its mean using roulette wheel
             // if a sample has been used as a mean its distance will become 0 so it will not be selected
-            int newMeanIndex = ProporSelect(squaredDistances, randomGenerator);
+            int newMeanIndex = ProporSelect(squaredDistances, randomValues[k - 1]);
 
-            auto nextCluster = std::make_shared<Cluster>(samples[newMeanIndex]->clone());
+            double* center = clusters.getCenter(k);
+            std::copy_n(points.getPoint(newMeanIndex), points.Dimension, center);
 
-            clusters.push_back(nextCluster);
+            for (int i = 0; i < points.Count; i++)
+            {
+                minDistances2[i] = std::min(minDistances2[i], getDistance2(points.getPoint(i), center, points.Dimension));
+            }
         }
 
-        updateClustering(clusters);
+        updateClustering(points, clusters);
 
         return clusters;
     }
 
-    int KMeansClustering::ProporSelect(std::vector<double>& values, Numeric::RandomValueGenerator& randomGenerator)
+    int KMeansClustering::ProporSelect(std::vector<double>& values, double p)
     {
         // on the fly technique
         // values[] can't be all 0.0s
@@ -270,8 +340,6 @@ namespace Deltares::Optimization
 
         double cumP = 0.0; // cumulative prob
 
-        double p = randomGenerator.next();
-
         for (int i = 0; i < n; ++i)
         {
             cumP += values[i] / sum;
@@ -284,43 +352,73 @@ namespace Deltares::Optimization
         return n - 1; // last index
     }
 
-    bool KMeansClustering::updateClustering(const std::vector<std::shared_ptr<Cluster>>& clusters)
+    bool KMeansClustering::updateClustering(const PointMatrix& points, Clustering& clustering)
     {
         // proposed clustering would have an empty cluster: return false - no change to clustering
         // proposed clustering would be no change: return false, no change to clustering
         // proposed clustering is different and has no empty clusters: return true, clustering is changed
 
-        // clear the current clustering
-        for (const std::shared_ptr<Cluster>& cluster : clusters)
-        {
-            cluster->PreviousSamples.clear();
+        const int numberClusters = clustering.NumberClusters;
 
-            cluster->PreviousSamples.reserve(cluster->Samples.size());
-            for (const std::shared_ptr<Models::Sample>& sample : cluster->Samples)
+        // half of the distance of each center to its nearest other center: points closer to their center than this value do not change cluster
+        std::vector<double> halfDistances(numberClusters, std::numeric_limits<double>::max());
+        for (int k1 = 0; k1 < numberClusters; k1++)
+        {
+            for (int k2 = k1 + 1; k2 < numberClusters; k2++)
             {
-                cluster->PreviousSamples.push_back(sample);
+                const double halfDistance = 0.5 * std::sqrt(getDistance2(clustering.getCenter(k1), clustering.getCenter(k2), clustering.Dimension));
+                halfDistances[k1] = std::min(halfDistances[k1], halfDistance);
+                halfDistances[k2] = std::min(halfDistances[k2], halfDistance);
             }
-
-            cluster->Samples.clear();
         }
 
         bool modified = false; // is there a change to the existing clustering?
 
-        for (const std::shared_ptr<Cluster>& cluster : clusters)
+#pragma omp parallel for reduction(||:modified)
+        for (int i = 0; i < points.Count; i++)
         {
-            for (const std::shared_ptr<Models::Sample>& sample : cluster->PreviousSamples)
+            const double* point = points.getPoint(i);
+            const int assignment = clustering.Assignments[i];
+            const double bound = std::max(halfDistances[assignment], clustering.LowerBounds[i]);
+
+            if (clustering.UpperBounds[i] > bound)
             {
-                std::shared_ptr<Cluster> nearestCluster = getNearestCluster(sample, clusters);
-                nearestCluster->Samples.push_back(sample);
+                clustering.UpperBounds[i] = std::sqrt(getDistance2(point, clustering.getCenter(assignment), points.Dimension));
 
-                modified |= nearestCluster != cluster;
+                if (clustering.UpperBounds[i] > bound)
+                {
+                    int nearest = -1;
+                    double minDistance2 = std::numeric_limits<double>::max();
+                    double secondDistance2 = std::numeric_limits<double>::max();
+
+                    for (int k = 0; k < numberClusters; k++)
+                    {
+                        const double distance2 = getDistance2(point, clustering.getCenter(k), points.Dimension);
+                        if (nearest < 0 || distance2 < minDistance2)
+                        {
+                            secondDistance2 = minDistance2;
+                            minDistance2 = distance2;
+                            nearest = k;
+                        }
+                        else if (distance2 < secondDistance2)
+                        {
+                            secondDistance2 = distance2;
+                        }
+                    }
+
+                    clustering.Assignments[i] = nearest;
+                    clustering.UpperBounds[i] = std::sqrt(minDistance2);
+                    clustering.LowerBounds[i] = std::sqrt(secondDistance2);
+
+                    modified = modified || nearest != assignment;
+                }
             }
         }
 
         // no change to clustering because would have an empty cluster
-        for (const std::shared_ptr<Cluster>& cluster : clusters)
+        for (int size : clustering.getSizes())
         {
-            if (cluster->Samples.empty())
+            if (size == 0)
             {
                 return false;
             }
@@ -328,92 +426,98 @@ namespace Deltares::Optimization
 
         if (modified)
         {
-            for (const std::shared_ptr<Cluster>& cluster : clusters)
+            std::vector<double> movements;
+            clustering.updateMeans(points, movements);
+
+            // the bounds remain valid when they are corrected for the movement of the centers
+            const double maxMovement = *std::max_element(movements.begin(), movements.end());
+
+            for (int i = 0; i < points.Count; i++)
             {
-                cluster->updateMean();
+                clustering.UpperBounds[i] += movements[clustering.Assignments[i]];
+                clustering.LowerBounds[i] -= maxMovement;
             }
         }
 
         return modified;
     }
 
-    std::shared_ptr<KMeansClustering::Cluster> KMeansClustering::getNearestCluster(const std::shared_ptr<Models::Sample>& sample, const std::vector<std::shared_ptr<Cluster>>& clusters)
+    double KMeansClustering::getDistance2(const double* values1, const double* values2, int dimension)
     {
-        std::shared_ptr<Cluster> nearestCluster = nullptr;
-        double minDistance = std::numeric_limits<double>::max();
+        double sum = 0;
 
-        for (const auto& cluster : clusters)
+        for (int i = 0; i < dimension; i++)
         {
-            double distance = cluster->Center->getDistance2(sample);
-            if (nearestCluster == nullptr || distance < minDistance)
-            {
-                nearestCluster = cluster;
-                minDistance = distance;
-            }
+            const double diff = values1[i] - values2[i];
+            sum += diff * diff;
         }
 
-        return nearestCluster;
-    }
-
-    double KMeansClustering::SilhouetteCoefficient(const std::vector<std::shared_ptr<Cluster>>& clusters)
-    {
-        double score = 0.0;
-        double nSamples = 0;
-        for (const auto& cluster : clusters)
-        {
-            for (const auto& sample : cluster->Samples)
-            {
-                ++nSamples;
-                double a_i = IntraClusterDistance(cluster, sample);
-                double b_i = InterClusterDistance(cluster, sample, clusters);
-                score += ((b_i - a_i) / std::max(b_i, a_i));
-            }
-        }
-        return score / nSamples;
+        return sum;
     }
 
-    double KMeansClustering::IntraClusterDistance(const std::shared_ptr<Cluster>& cluster, const std::shared_ptr<Models::Sample>& sample)
+    std::vector<double> KMeansClustering::getDistanceMatrix(const PointMatrix& points)
     {
-        double intraClusterDistance = 0.0;
+        std::vector<double> distances(static_cast<size_t>(points.Count) * points.Count, 0.0);
 
-        for (const auto& otherSample : cluster->Samples)
+#pragma omp parallel for schedule(dynamic)
+        for (int i = 0; i < points.Count; i++)
         {
-            if (sample != otherSample)
+            for (int j = i + 1; j < points.Count; j++)
             {
-                intraClusterDistance += sample->getDistance(otherSample);
+                const double distance = std::sqrt(getDistance2(points.getPoint(i), points.getPoint(j), points.Dimension));
+                distances[static_cast<size_t>(i) * points.Count + j] = distance;
+                distances[static_cast<size_t>(j) * points.Count + i] = distance;
             }
         }
 
-        return intraClusterDistance / static_cast<double>(cluster->Samples.size() - 1);
+        return distances;
     }
 
-    double KMeansClustering::InterClusterDistance(const std::shared_ptr<Cluster>& cluster,
-        const std::shared_ptr<Models::Sample>& sample, const std::vector<std::shared_ptr<Cluster>>& clusters)
+    double KMeansClustering::SilhouetteCoefficient(const PointMatrix& points, const Clustering& clustering, const std::vector<double>& distances)
     {
-        double interClusterDistance = std::numeric_limits<double>::max();
+        const std::vector<int> sizes = clustering.getSizes();
+
+        // when no distances are cached, the coefficient is estimated from an evenly spread subset of the points
+        const int step = distances.empty() ? std::max(1, points.Count / maxSilhouettePoints) : 1;
+        const int nSamples = (points.Count + step - 1) / step;
+
+        double score = 0.0;
 
-        for (const std::shared_ptr<Cluster>& otherCluster : clusters)
+#pragma omp parallel for reduction(+:score)
+        for (int n = 0; n < nSamples; n++)
         {
-            if (cluster != otherCluster)
+            const int i = n * step;
+            const int cluster = clustering.Assignments[i];
+
+            // sum of the distances to the points in each cluster
+            std::vector<double> sumDistances(clustering.NumberClusters, 0.0);
+            for (int j = 0; j < points.Count; j++)
             {
-                double clusterDissimilarity = 0.0;
+                const double distance = distances.empty() ?
+                    std::sqrt(getDistance2(points.getPoint(i), points.getPoint(j), points.Dimension)) :
+                    distances[static_cast<size_t>(i) * points.Count + j];
 
-                for (const std::shared_ptr<Models::Sample>& otherSample : otherCluster->Samples)
-                {
-                    clusterDissimilarity += sample->getDistance(otherSample);
-                }
+                sumDistances[clustering.Assignments[j]] += distance;
+            }
 
-                clusterDissimilarity /= static_cast<double>(otherCluster->Samples.size());
+            // a point which is the only point in its cluster has a coefficient zero
+            if (sizes[cluster] > 1)
+            {
+                const double a_i = sumDistances[cluster] / static_cast<double>(sizes[cluster] - 1);
 
-                if (clusterDissimilarity < interClusterDistance)
+                double b_i = std::numeric_limits<double>::max();
+                for (int k = 0; k < clustering.NumberClusters; k++)
                 {
-                    interClusterDistance = clusterDissimilarity;
+                    if (k != cluster && sizes[k] > 0)
+                    {
+                        b_i = std::min(b_i, sumDistances[k] / static_cast<double>(sizes[k]));
+                    }
                 }
+
+                score += (b_i - a_i) / std::max(b_i, a_i);
             }
         }
 
-        return interClusterDistance;
+        return score / nSamples;
     }
-
 }
-
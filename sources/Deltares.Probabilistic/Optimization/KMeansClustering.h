@@ -47,32 +47,66 @@ namespace Deltares::Optimization
          */
         std::vector<std::shared_ptr<Models::Sample>> getClusterCenters(std::vector<std::shared_ptr<Models::Sample>> samples);
     private:
+        /**
+         * \brief Values of the samples, stored row wise in a contiguous matrix
+         */
+        class PointMatrix
+        {
+        public:
+            explicit PointMatrix(const std::vector<std::shared_ptr<Models::Sample>>& samples);
+
+            int Count = 0;
+            int Dimension = 0;
+            std::vector<double> Values;
+            std::vector<double> Weights;
+
+            const double* getPoint(int index) const { return Values.data() + static_cast<size_t>(index) * Dimension; }
+        };
+
         /**
          * \brief Internal class for cluster administration
+         * \remark Besides the centers and assignments, the Hamerly bounds on the distance to the assigned
+         *         and second nearest center are stored, which are used to skip distance calculations
          */
-        class Cluster
+        class Clustering
         {
         public:
-            std::shared_ptr<Models::Sample> Center = nullptr;
-            std::vector<std::shared_ptr<Models::Sample>> Samples;
-            std::vector<std::shared_ptr<Models::Sample>> PreviousSamples;
+            int NumberClusters = 0;
+            int Dimension = 0;
+            std::vector<double> Centers;
+            std::vector<int> Assignments;
+            std::vector<double> UpperBounds;
+            std::vector<double> LowerBounds;
+            double SumSquared = 0.0;
 
-            double getSumSquared() const;
-            void updateMean();
+            double* getCenter(int cluster) { return Centers.data() + static_cast<size_t>(cluster) * Dimension; }
+            const double* getCenter(int cluster) const { return Centers.data() + static_cast<size_t>(cluster) * Dimension; }
+            std::vector<int> getSizes() const;
+            void updateMeans(const PointMatrix& points, std::vector<double>& movements);
+            void updateSumSquared(const PointMatrix& points);
         };
 
-        std::vector<std::shared_ptr<Cluster>> FixedCluster(std::vector<std::shared_ptr<Models::Sample>>& samples, const ClusterSettings& options);
-        std::vector<std::shared_ptr<Cluster>> DoClustering(std::vector<std::shared_ptr<Models::Sample>>& samples, const ClusterSettings& options, Numeric::RandomValueGenerator& randomGenerator);
-        std::vector<std::shared_ptr<Cluster>> InitializeClusters(std::vector<std::shared_ptr<Models::Sample>>& samples, const ClusterSettings& options, Numeric::RandomValueGenerator& randomGenerator);
-        std::vector<std::shared_ptr<Cluster>> InitPlusPlus(int numberClusters, std::vector<std::shared_ptr<Models::Sample>>& samples, Numeric::RandomValueGenerator& randomGenerator, bool sampleHasWeighting);
-        int ProporSelect(std::vector<double>& values, Numeric::RandomValueGenerator& randomGenerator);
-        bool updateClustering(const std::vector<std::shared_ptr<Cluster>>& clusters);
-        static std::shared_ptr<Cluster> getNearestCluster(const std::shared_ptr<Models::Sample>& sample, const std::vector<std::shared_ptr<Cluster>>& clusters);
-        static double SilhouetteCoefficient(const std::vector<std::shared_ptr<Cluster>>& clusters);
-        static double IntraClusterDistance(const std::shared_ptr<Cluster>& cluster, const std::shared_ptr<Models::Sample>& sample);
-        static double InterClusterDistance(const std::shared_ptr<Cluster>& cluster,
-            const std::shared_ptr<Models::Sample>& sample, const std::vector<std::shared_ptr<Cluster>>& clusters);
-        static std::vector<std::shared_ptr<Models::Sample>> getCentersFromClusters(const std::vector<std::shared_ptr<Cluster>>& clusters);
+        /**
+         * \brief Maximum number of points for which the silhouette coefficient is calculated exactly with cached distances,
+         *        for more points the silhouette coefficient is estimated from an evenly spread subset of this size
+         */
+        static constexpr int maxSilhouettePoints = 1000;
+
+        /**
+         * \brief Number of trials which are performed concurrently
+         */
+        static constexpr int trialsPerRound = 10;
+
+        Clustering FixedCluster(const PointMatrix& points, const ClusterSettings& options) const;
+        Clustering DoClustering(const PointMatrix& points, const ClusterSettings& options, const double* randomValues) const;
+        static Clustering InitializeClusters(const PointMatrix& points, const ClusterSettings& options, const double* randomValues);
+        static Clustering InitPlusPlus(int numberClusters, const PointMatrix& points, const double* randomValues, bool sampleHasWeighting);
+        static int ProporSelect(std::vector<double>& values, double p);
+        static bool updateClustering(const PointMatrix& points, Clustering& clustering);
+        static double getDistance2(const double* values1, const double* values2, int dimension);
+        static std::vector<double> getDistanceMatrix(const PointMatrix& points);
+        static double SilhouetteCoefficient(const PointMatrix& points, const Clustering& clustering, const std::vector<double>& distances);
+        static std::vector<std::shared_ptr<Models::Sample>> getCentersFromClusters(const Clustering& clustering);
 
         const double margin = 1E-8;
     };
@@ -101,6 +101,7 @@ namespace Deltares::Reliability
                 loopCounter++;
 
                 const std::shared_ptr<ImportanceSamplingSettings> importanceSamplingSettings = importanceSampling->Settings;
+                const std::vector<std::shared_ptr<ImportanceSamplingCluster>> previousClusters = importanceSampling->getClusterResults();
 
                 importanceSampling = std::make_shared<ImportanceSampling>();
                 importanceSampling->Settings = importanceSamplingSettings;
@@ -109,7 +110,7 @@ namespace Deltares::Reliability
 
                 if (this->Settings->Clustering)
                 {
-                    hasChanged = this->updateClusters(loopCounter);
+                    hasChanged = this->updateClusters(loopCounter, previousClusters);
                 }
                 else
                 {
@@ -240,7 +241,7 @@ namespace Deltares::Reliability
         }
     }
 
-    bool AdaptiveImportanceSampling::updateClusters(int loopCounter) const
+    bool AdaptiveImportanceSampling::updateClusters(int loopCounter, const std::vector<std::shared_ptr<ImportanceSamplingCluster>>& previousClusters) const
     {
         if (loopCounter < Settings->MaxVarianceLoops && this->clusterSamples.size() < Settings->MinimumFailedSamples && Settings->LoopVarianceIncrement > 0)
         {
@@ -268,11 +269,18 @@ namespace Deltares::Reliability
             {
                 this->importanceSampling->Settings->Clusters.clear();
 
-                for (std::shared_ptr<Sample> center : this->getClusterCenters(this->clusterSamples))
+                for (std::shared_ptr<Sample> center : newClusterCenters)
                 {
                     this->importanceSampling->Settings->Clusters.push_back(center);
                 }
 
+                // the allocation of samples to the new clusters starts with the results of the previous clusters
+                if (this->importanceSampling->Settings->ClusterAllocation == ClusterAllocationType::Proportional)
+                {
+                    this->importanceSampling->Settings->ClusterFractions = ImportanceSampling::getClusterFractions(
+                        newClusterCenters, previousClusters, this->importanceSampling->Settings->DefensiveFraction);
+                }
+
                 this->setFactor(*importanceSampling->Settings->StochastSet, Settings->VarianceFactor);
             }
 
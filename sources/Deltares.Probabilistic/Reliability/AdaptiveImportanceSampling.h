@@ -63,7 +63,7 @@ namespace Deltares::Reliability
 
         static void addFactor(const StochastSettingsSet& stochastSet, double addValue);
         static void setFactor(const StochastSettingsSet& stochastSet, double setValue);
-        bool updateClusters(int loopCounter) const;
+        bool updateClusters(int loopCounter, const std::vector<std::shared_ptr<ImportanceSamplingCluster>>& previousClusters) const;
         bool updateStartPoint(const std::shared_ptr<DesignPoint>& designPoint,
             const std::shared_ptr<Models::ModelRunner>& modelRunner, int loopCounter);
         std::shared_ptr<Models::Sample> getStartPoint(const std::shared_ptr<Models::ModelRunner>& modelRunner,
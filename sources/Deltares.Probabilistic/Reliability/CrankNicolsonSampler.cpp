@@ -0,0 +1,81 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "CrankNicolsonSampler.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Deltares::Reliability
+{
+    using namespace Deltares::Models;
+
+    void CrankNicolsonSampler::initializeLevel(ModelRunner& modelRunner, const std::vector<std::shared_ptr<Sample>>& seeds)
+    {
+        deviations = getStandardDeviations(seeds);
+        scale = InitialScale;
+    }
+
+    std::vector<std::shared_ptr<Sample>> CrankNicolsonSampler::step(ModelRunner& modelRunner, const std::vector<int>& chains,
+        const std::vector<std::shared_ptr<Sample>>& states, std::vector<Numeric::RandomValueGenerator>& generators)
+    {
+        const size_t nStochasts = deviations.size();
+
+        std::vector<double> sigma(nStochasts);
+        std::vector<double> rho(nStochasts);
+        for (size_t j = 0; j < nStochasts; j++)
+        {
+            sigma[j] = std::min(1.0, scale * deviations[j]);
+            rho[j] = std::sqrt(1.0 - sigma[j] * sigma[j]);
+        }
+
+        std::vector<std::shared_ptr<Sample>> proposals;
+        for (size_t i = 0; i < states.size(); i++)
+        {
+            std::vector<double> values(nStochasts);
+            for (size_t j = 0; j < nStochasts; j++)
+            {
+                values[j] = rho[j] * states[i]->Values[j] + sigma[j] * getStandardNormalValue(generators[chains[i]]);
+            }
+
+            proposals.push_back(std::make_shared<Sample>(values));
+        }
+
+        calculateSamples(modelRunner, proposals);
+
+        std::vector<std::shared_ptr<Sample>> newStates = states;
+        for (size_t i = 0; i < states.size(); i++)
+        {
+            if (isInFailureDomain(*proposals[i]))
+            {
+                newStates[i] = proposals[i];
+            }
+        }
+
+        return newStates;
+    }
+
+    void CrankNicolsonSampler::adapt(double acceptanceRate, int stepIndex)
+    {
+        scale = getAdaptedScale(scale, acceptanceRate, TargetAcceptanceRate, stepIndex);
+    }
+}
+
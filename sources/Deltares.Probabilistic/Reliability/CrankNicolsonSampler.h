@@ -0,0 +1,59 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include "SubsetSimulationSampler.h"
+
+namespace Deltares::Reliability
+{
+    /**
+     * \brief Preconditioned Crank-Nicolson kernel for subset simulation
+     * \remark The proposal preserves the standard normal distribution, so a proposal is accepted if it is in the failure domain.
+     *         The proposal deviation per stochast is derived from the seeds and adapted to the target acceptance rate.
+     */
+    class CrankNicolsonSampler : public SubsetSimulationSampler
+    {
+    public:
+        /**
+         * \brief Initial scaling of the proposal deviation
+         */
+        double InitialScale = 0.6;
+
+        /**
+         * \brief Acceptance rate to which the proposal deviation is adapted
+         */
+        double TargetAcceptanceRate = 0.44;
+
+        std::string getName() const override { return "crank_nicolson"; }
+
+    protected:
+        void initializeLevel(Models::ModelRunner& modelRunner, const std::vector<std::shared_ptr<Models::Sample>>& seeds) override;
+        std::vector<std::shared_ptr<Models::Sample>> step(Models::ModelRunner& modelRunner, const std::vector<int>& chains,
+            const std::vector<std::shared_ptr<Models::Sample>>& states, std::vector<Numeric::RandomValueGenerator>& generators) override;
+        void adapt(double acceptanceRate, int stepIndex) override;
+
+    private:
+        std::vector<double> deviations;
+        double scale = 0.6;
+    };
+}
+
@@ -104,112 +104,191 @@ namespace Deltares::Reliability
         int nSamples = 0;
         const std::shared_ptr<ConvergenceReport> convergenceReport = std::make_shared<ConvergenceReport>();
         std::vector<std::shared_ptr<Sample>> samples;
+        std::vector<std::shared_ptr<Sample>> designPointSamples;
         size_t zIndex = 0;
 
         double qFail = 0;
 
-        for (int sampleIndex = 0; sampleIndex < Settings->MaximumSamples + 1 && !isStopped(); sampleIndex++)
+        // processes a calculated random sample, returns whether the calculation has converged
+        auto processSample = [&](const std::shared_ptr<Sample>& u, double z, int sampleIndex)
         {
-            zIndex++;
+            if (std::isnan(z))
+            {
+                return false;
+            }
 
-            if (initial || zIndex >= samples.size())
+            nSamples++;
+            if (z < 0)
             {
-                samples.clear();
+                nFailed = nFailed + 1;
+            }
 
-                int chunkSize = modelRunner->Settings->MaxChunkSize;
-                int runs = std::min(chunkSize, Settings->MaximumSamples + 1 - sampleIndex);
+            convergenceReport->FailedSamples = nFailed;
+            convergenceReport->FailFraction = Numeric::NumericSupport::Divide(nFailed, nSamples);
 
-                if (initial)
+            if (z * z0Fac < 0)
+            {
+                // added to the design point builder per chunk
+                designPointSamples.push_back(u);
+
+                double rbeta = u->getBeta();
+                if (rbeta < rmin)
                 {
-                    samples.push_back(sampleProvider->getSample());
-                    runs = runs - 1;
+                    rmin = rbeta;
+                    uMin = u;
                 }
+            }
+            pf = Numeric::NumericSupport::Divide(nFailed, nSamples);
+            pf = qFail + qRange * pf;
+
+            convergenceReport->IsConverged = checkConvergence(modelRunner, pf, nSamples, sampleIndex);
+
+            return convergenceReport->IsConverged;
+        };
+
+        if (modelRunner->canStreamZValues())
+        {
+            std::shared_ptr<Sample> initialSample = sampleProvider->getSample();
+            double z0 = modelRunner->getZValue(initialSample);
+
+            z0Fac = getZFactor(z0);
+            uMin->setInitialValues(z0Fac * Statistics::StandardNormal::BetaMax);
+            designPointBuilder.initialize(z0Fac * Statistics::StandardNormal::BetaMax);
+            qFail = z0Fac != getZFactor(zRemainder) ? 1 - qRange : 0;
 
-                for (int i = 0; i < runs; i++)
+            if (modelRunner->shouldExitPrematurely({ initialSample }))
+            {
+                // return the result so far
+                return modelRunner->getDesignPoint(uMin, Statistics::StandardNormal::getUFromQ(pf), convergenceReport);
+            }
+
+            const size_t chunkSize = static_cast<size_t>(modelRunner->Settings->MaxChunkSize);
+            int providedSamples = 1;
+            int sampleIndex = 1;
+            bool exitPrematurely = false;
+
+            modelRunner->getZValuesStreamed(
+                [&]() -> std::shared_ptr<Sample>
                 {
+                    if (providedSamples > Settings->MaximumSamples || isStopped())
+                    {
+                        return nullptr;
+                    }
+
+                    providedSamples++;
+
                     std::shared_ptr<Sample> sample = randomSampleGenerator.getRandomSample();
                     if (qRange < 1)
                     {
                         applyLimits(sample);
                     }
 
+                    return sample;
+                },
+                [&](const std::shared_ptr<Sample>& sample)
+                {
                     samples.push_back(sample);
-                }
 
-                zValues = modelRunner->getZValues(samples);
+                    bool converged = processSample(sample, sample->Z, sampleIndex++);
 
-                if (initial)
-                {
-                    z0Fac = getZFactor(zValues[0]);
-                    uMin->setInitialValues(z0Fac * Statistics::StandardNormal::BetaMax);
-                    designPointBuilder.initialize(z0Fac * Statistics::StandardNormal::BetaMax);
-                }
+                    if (samples.size() >= chunkSize)
+                    {
+                        designPointBuilder.addSamples(designPointSamples);
+                        designPointSamples.clear();
 
-                if (modelRunner->shouldExitPrematurely(samples))
-                {
-                    // return the result so far
-                    return modelRunner->getDesignPoint(uMin, Statistics::StandardNormal::getUFromQ(pf), convergenceReport);
-                }
+                        exitPrematurely = modelRunner->shouldExitPrematurely(samples);
+                        samples.clear();
+                    }
 
-                zIndex = 0;
-            }
+                    return !converged && !exitPrematurely && !isStopped();
+                });
 
-            if (initial)
+            if (exitPrematurely)
+            {
+                // return the result so far
+                return modelRunner->getDesignPoint(uMin, Statistics::StandardNormal::getUFromQ(pf), convergenceReport);
+            }
+        }
+        else
+        {
+            for (int sampleIndex = 0; sampleIndex < Settings->MaximumSamples + 1 && !isStopped(); sampleIndex++)
             {
-                z0Fac = getZFactor(zValues[zIndex]);
-                double zRemainderFactor = getZFactor(zRemainder);
+                zIndex++;
 
-                if (z0Fac != zRemainderFactor)
+                if (initial || zIndex >= samples.size())
                 {
-                    qFail = 1 - qRange;
-                }
-                else
-                {
-                    qFail = 0;
-                }
+                    designPointBuilder.addSamples(designPointSamples);
+                    designPointSamples.clear();
 
-                initial = false;
-                continue;
-            }
+                    samples.clear();
 
-            double z = zValues[zIndex];
-            std::shared_ptr<Sample> u = samples[zIndex];
+                    int chunkSize = modelRunner->Settings->MaxChunkSize;
+                    int runs = std::min(chunkSize, Settings->MaximumSamples + 1 - sampleIndex);
 
-            if (std::isnan(z))
-            {
-                continue;
-            }
+                    if (initial)
+                    {
+                        samples.push_back(sampleProvider->getSample());
+                        runs = runs - 1;
+                    }
 
-            nSamples++;
-            if (z < 0)
-            {
-                nFailed = nFailed + 1;
-            }
+                    std::vector<std::shared_ptr<Sample>> randomSamples = randomSampleGenerator.getRandomSamples(runs);
 
-            convergenceReport->FailedSamples = nFailed;
-            convergenceReport->FailFraction = Numeric::NumericSupport::Divide(nFailed, nSamples);
+                    if (qRange < 1)
+                    {
+#pragma omp parallel for
+                        for (int i = 0; i < runs; i++)
+                        {
+                            applyLimits(randomSamples[i]);
+                        }
+                    }
 
-            if (z * z0Fac < 0)
-            {
-                designPointBuilder.addSample(u);
-                double rbeta = u->getBeta();
-                if (rbeta < rmin)
-                {
-                    rmin = rbeta;
-                    uMin = u;
+                    samples.insert(samples.end(), randomSamples.begin(), randomSamples.end());
+
+                    zValues = modelRunner->getZValues(samples);
+
+                    if (initial)
+                    {
+                        z0Fac = getZFactor(zValues[0]);
+                        uMin->setInitialValues(z0Fac * Statistics::StandardNormal::BetaMax);
+                        designPointBuilder.initialize(z0Fac * Statistics::StandardNormal::BetaMax);
+                    }
+
+                    if (modelRunner->shouldExitPrematurely(samples))
+                    {
+                        // return the result so far
+                        return modelRunner->getDesignPoint(uMin, Statistics::StandardNormal::getUFromQ(pf), convergenceReport);
+                    }
+
+                    zIndex = 0;
                 }
-            }
-            pf = Numeric::NumericSupport::Divide(nFailed, nSamples);
-            pf = qFail + qRange * pf;
 
-            convergenceReport->IsConverged = checkConvergence(modelRunner, pf, nSamples, sampleIndex);
+                if (initial)
+                {
+                    z0Fac = getZFactor(zValues[zIndex]);
+                    double zRemainderFactor = getZFactor(zRemainder);
 
-            if (convergenceReport->IsConverged)
-            {
-                break;
+                    if (z0Fac != zRemainderFactor)
+                    {
+                        qFail = 1 - qRange;
+                    }
+                    else
+                    {
+                        qFail = 0;
+                    }
+
+                    initial = false;
+                    continue;
+                }
+
+                if (processSample(samples[zIndex], zValues[zIndex], sampleIndex))
+                {
+                    break;
+                }
             }
         }
 
+        designPointBuilder.addSamples(designPointSamples);
+
         double beta = Statistics::StandardNormal::getUFromQ(pf);
         uMin = designPointBuilder.getSample();
 
@@ -0,0 +1,142 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "DelayedRejectionSampler.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Deltares::Reliability
+{
+    using namespace Deltares::Models;
+
+    void DelayedRejectionSampler::initializeLevel(ModelRunner& modelRunner, const std::vector<std::shared_ptr<Sample>>& seeds)
+    {
+        deviations = getStandardDeviations(seeds);
+
+        // optimal scaling of a random walk, see Gelman, Roberts and Gilks
+        const double optimalFactor = 2.38 / std::sqrt(static_cast<double>(std::max(static_cast<size_t>(1), deviations.size())));
+        for (double& deviation : deviations)
+        {
+            deviation *= optimalFactor;
+        }
+
+        scale = 1;
+    }
+
+    std::vector<std::shared_ptr<Sample>> DelayedRejectionSampler::step(ModelRunner& modelRunner, const std::vector<int>& chains,
+        const std::vector<std::shared_ptr<Sample>>& states, std::vector<Numeric::RandomValueGenerator>& generators)
+    {
+        std::vector<std::shared_ptr<Sample>> newStates = states;
+
+        // first stage, all proposals are calculated, because the second stage depends on whether the first proposal is in the failure domain
+        std::vector<std::shared_ptr<Sample>> firstProposals(states.size());
+        std::vector<double> firstRandoms(states.size());
+
+        for (size_t i = 0; i < states.size(); i++)
+        {
+            Numeric::RandomValueGenerator& generator = generators[chains[i]];
+
+            firstProposals[i] = getProposal(*states[i], generator, 1.0);
+            firstRandoms[i] = generator.next();
+        }
+
+        calculateSamples(modelRunner, firstProposals);
+
+        // second stage, only after a first proposal which was rejected by the failure domain
+        std::vector<std::shared_ptr<Sample>> secondProposals(states.size(), nullptr);
+        std::vector<std::shared_ptr<Sample>> calculatedSamples;
+
+        for (size_t i = 0; i < states.size(); i++)
+        {
+            if (isInFailureDomain(*firstProposals[i]))
+            {
+                const double logRatio = getLogDensity(firstProposals[i]->Values) - getLogDensity(states[i]->Values);
+                if (std::log(firstRandoms[i]) < logRatio)
+                {
+                    newStates[i] = firstProposals[i];
+                }
+            }
+            else
+            {
+                Numeric::RandomValueGenerator& generator = generators[chains[i]];
+
+                std::shared_ptr<Sample> proposal = getProposal(*states[i], generator, SecondStageFactor);
+
+                // the first proposal is outside the failure domain, so it is rejected in forward and reverse direction and
+                // only the first stage proposal densities remain, the second stage proposal is symmetric
+                const double logRatio = getLogDensity(proposal->Values) - getLogDensity(states[i]->Values) +
+                    getLogProposalDensity(proposal->Values, firstProposals[i]->Values) -
+                    getLogProposalDensity(states[i]->Values, firstProposals[i]->Values);
+
+                if (std::log(generator.next()) < logRatio)
+                {
+                    secondProposals[i] = proposal;
+                    calculatedSamples.push_back(proposal);
+                }
+            }
+        }
+
+        calculateSamples(modelRunner, calculatedSamples);
+
+        for (size_t i = 0; i < states.size(); i++)
+        {
+            if (secondProposals[i] != nullptr && isInFailureDomain(*secondProposals[i]))
+            {
+                newStates[i] = secondProposals[i];
+            }
+        }
+
+        return newStates;
+    }
+
+    void DelayedRejectionSampler::adapt(double acceptanceRate, int stepIndex)
+    {
+        scale = getAdaptedScale(scale, acceptanceRate, TargetAcceptanceRate, stepIndex);
+    }
+
+    std::shared_ptr<Sample> DelayedRejectionSampler::getProposal(const Sample& sample, Numeric::RandomValueGenerator& generator, double factor) const
+    {
+        std::vector<double> values(sample.Values.size());
+
+        for (size_t j = 0; j < values.size(); j++)
+        {
+            values[j] = sample.Values[j] + factor * scale * deviations[j] * getStandardNormalValue(generator);
+        }
+
+        return std::make_shared<Sample>(values);
+    }
+
+    double DelayedRejectionSampler::getLogProposalDensity(const std::vector<double>& from, const std::vector<double>& to) const
+    {
+        double logDensity = 0;
+
+        for (size_t j = 0; j < from.size(); j++)
+        {
+            const double deviation = scale * deviations[j];
+            const double difference = to[j] - from[j];
+            logDensity -= difference * difference / (2 * deviation * deviation);
+        }
+
+        return logDensity;
+    }
+}
+
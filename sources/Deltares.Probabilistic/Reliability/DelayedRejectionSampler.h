@@ -0,0 +1,66 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include "SubsetSimulationSampler.h"
+
+namespace Deltares::Reliability
+{
+    /**
+     * \brief Delayed rejection adaptive Metropolis kernel for subset simulation
+     * \remark A normal random walk with a proposal deviation per stochast, derived from the seeds and adapted to the target acceptance rate.
+     *         When a proposal is rejected because it is outside the failure domain, a second proposal with a smaller deviation is tried.
+     */
+    class DelayedRejectionSampler : public SubsetSimulationSampler
+    {
+    public:
+        /**
+         * \brief Acceptance rate to which the proposal deviation is adapted
+         */
+        double TargetAcceptanceRate = 0.234;
+
+        /**
+         * \brief Deviation of the second proposal, relative to the deviation of the first proposal
+         */
+        double SecondStageFactor = 0.2;
+
+        std::string getName() const override { return "delayed_rejection"; }
+
+    protected:
+        void initializeLevel(Models::ModelRunner& modelRunner, const std::vector<std::shared_ptr<Models::Sample>>& seeds) override;
+        std::vector<std::shared_ptr<Models::Sample>> step(Models::ModelRunner& modelRunner, const std::vector<int>& chains,
+            const std::vector<std::shared_ptr<Models::Sample>>& states, std::vector<Numeric::RandomValueGenerator>& generators) override;
+        void adapt(double acceptanceRate, int stepIndex) override;
+
+    private:
+        std::vector<double> deviations;
+        double scale = 1;
+
+        std::shared_ptr<Models::Sample> getProposal(const Models::Sample& sample, Numeric::RandomValueGenerator& generator, double factor) const;
+
+        /**
+         * \brief Gets the logarithm of the density of the first stage proposal, without normalizing constant
+         */
+        double getLogProposalDensity(const std::vector<double>& from, const std::vector<double>& to) const;
+    };
+}
+
@@ -24,7 +24,7 @@
 #include <string>
 #include <vector>
 
-#include "../Model/Evaluation.h"
+#include "../Model/EvaluationList.h"
 #include "../Logging/Message.h"
 #include "../Model/StochastPoint.h"
 #include "../Statistics/StandardNormal.h"
@@ -62,7 +62,7 @@ namespace Deltares::Reliability
 
         std::vector<std::shared_ptr<DesignPoint>> ContributingDesignPoints;
         std::vector<std::shared_ptr<ReliabilityResult>> ReliabilityResults;
-        std::vector<std::shared_ptr<Models::Evaluation>> Evaluations;
+        Models::EvaluationList Evaluations;
         std::vector<std::shared_ptr<Logging::Message>> Messages;
 
         std::shared_ptr<ConvergenceReport> convergenceReport = std::make_shared<ConvergenceReport>();
@@ -24,6 +24,7 @@
 #include "../Model/ModelRunner.h"
 #include "DesignPointBuilder.h"
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 #include <stdexcept>
@@ -58,6 +59,19 @@ namespace Deltares::Reliability
             values.clear();
         }
 
+        std::shared_ptr<ModeFinder> getEmptyModeFinder() const
+        {
+            return std::make_shared<ModeFinder>(stochast);
+        }
+
+        void merge(const ModeFinder& other)
+        {
+            for (const auto& [u, weight] : other.values)
+            {
+                values[u] += weight;
+            }
+        }
+
         double getMode() const
         {
             double mode = 0;
@@ -163,6 +177,121 @@ namespace Deltares::Reliability
         handleSample(sample, weight);
     }
 
+    void DesignPointBuilder::addSamples(const std::vector<std::shared_ptr<Models::Sample>>& samples)
+    {
+        constexpr int blockSize = 256;
+
+        const int size = static_cast<int>(samples.size());
+
+        if (size <= blockSize)
+        {
+            for (const std::shared_ptr<Models::Sample>& sample : samples)
+            {
+                addSample(sample);
+            }
+        }
+        else
+        {
+            // blocks have a fixed size and are merged in order, so that the result does not depend on the number of threads
+            const int blocks = (size + blockSize - 1) / blockSize;
+
+            std::vector<DesignPointBuilder> partials;
+            for (int block = 0; block < blocks; block++)
+            {
+                partials.push_back(getPartialBuilder());
+            }
+
+#pragma omp parallel for
+            for (int block = 0; block < blocks; block++)
+            {
+                const int end = std::min(size, (block + 1) * blockSize);
+                for (int i = block * blockSize; i < end; i++)
+                {
+                    partials[block].addSample(samples[i]);
+                }
+            }
+
+            for (const DesignPointBuilder& partial : partials)
+            {
+                merge(partial);
+            }
+        }
+    }
+
+    /**
+     * \brief Gets an empty design point builder with the same settings, which can be merged into this builder
+     */
+    DesignPointBuilder DesignPointBuilder::getPartialBuilder() const
+    {
+        DesignPointBuilder partial;
+
+        partial.count = count;
+        partial.method = method;
+        partial.qualitativeIndices = qualitativeIndices;
+        partial.qualitativeCount = qualitativeCount;
+        partial.weightedSampleAdded = weightedSampleAdded;
+
+        for (const auto& modeFinder : modeFinders)
+        {
+            partial.modeFinders.push_back(modeFinder->getEmptyModeFinder());
+        }
+
+        partial.initializeTotals();
+
+        return partial;
+    }
+
+    /**
+     * \brief Adds the samples of a partial builder, as if they were added to this builder
+     */
+    void DesignPointBuilder::merge(const DesignPointBuilder& partial)
+    {
+        if (!partial.sampleAdded)
+        {
+            return;
+        }
+
+        sampleAdded = true;
+
+        if (method == DesignPointMethod::NearestToMean)
+        {
+            // the nearest samples are in order of decreasing beta
+            for (const std::shared_ptr<Models::Sample>& sample : partial.nearestSamples)
+            {
+                handleSample(sample, 1);
+            }
+        }
+        else
+        {
+            if (partial.weightedSampleAdded && !weightedSampleAdded)
+            {
+                // restart counting, same as in addSample
+                initializeTotals();
+                weightedSampleAdded = true;
+            }
+            else if (!partial.weightedSampleAdded && weightedSampleAdded)
+            {
+                // the partial only contains samples without weight, which were counted with a preliminary weight,
+                // but would not have contributed when added after a weighted sample
+                return;
+            }
+
+            for (int j = 0; j < qualitativeCount; j++)
+            {
+                modeFinders[j]->merge(*partial.modeFinders[j]);
+            }
+
+            for (int i = 0; i < count; i++)
+            {
+                meanSample->Values[i] += partial.meanSample->Values[i];
+                sinSample->Values[i] += partial.sinSample->Values[i];
+                cosSample->Values[i] += partial.cosSample->Values[i];
+            }
+
+            sumWeights += partial.sumWeights;
+        }
+    }
+
     void DesignPointBuilder::removeSample(const std::shared_ptr<Models::Sample>& sample)
     {
         double weight = std::isnan(sample->Weight) ? -1 : -sample->Weight;
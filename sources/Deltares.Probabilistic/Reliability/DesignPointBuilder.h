@@ -58,6 +58,8 @@ namespace Deltares::Reliability
 
         void handleSample(const std::shared_ptr<Models::Sample>& sample, double weight);
         void initializeTotals();
+        DesignPointBuilder getPartialBuilder() const;
+        void merge(const DesignPointBuilder& partial);
 
     public:
         DesignPointBuilder() = default;
@@ -66,6 +68,13 @@ namespace Deltares::Reliability
 
         void initialize(double beta) const;
         void addSample(const std::shared_ptr<Models::Sample>& sample);
+
+        /**
+         * \brief Adds a number of samples, equivalent to adding the samples one by one
+         * \param samples Samples to be added
+         * \remark Large numbers of samples are added in parallel in blocks, the result does not depend on the number of threads
+         */
+        void addSamples(const std::vector<std::shared_ptr<Models::Sample>>& samples);
         void removeSample(const std::shared_ptr<Models::Sample>& sample);
         std::shared_ptr<Models::Sample> getSample();
 
@@ -224,24 +224,33 @@ namespace Deltares::Reliability
 
         if ( ! modelRunner.canCalculateBeta())
         {
-            auto shouldCompute = std::vector(nSamples, true);
-            if (modelRunner.ProxySettings->IsProxyModel)
+            auto preComputeDirs = PrecomputeDirections(*Settings->DirectionSettings, z0);
+
+            if (Settings->DirectionsPerThread)
+            {
+                // the steps are calculated per direction in the loop below, so that no thread waits for the others
+                preComputeDirs.provideOrigin(directions);
+            }
+            else
             {
-                for (size_t i = 0; i < nSamples; i++)
+                auto shouldCompute = std::vector(nSamples, true);
+                if (modelRunner.ProxySettings->IsProxyModel)
                 {
-                    // retain previous results from model if running in a proxy model environment
-                    shouldCompute[i] = !previousResults.contains(samples[i]->IterationIndex);
+                    for (size_t i = 0; i < nSamples; i++)
+                    {
+                        // retain previous results from model if running in a proxy model environment
+                        shouldCompute[i] = !previousResults.contains(samples[i]->IterationIndex);
+                    }
                 }
-            }
 
-            auto preComputeDirs = PrecomputeDirections(*Settings->DirectionSettings, z0);
-            preComputeDirs.precompute(modelRunner, directions, shouldCompute);
-            preComputedCounter += preComputeDirs.GetCounter();
+                preComputeDirs.precompute(modelRunner, directions, shouldCompute);
+                preComputedCounter += preComputeDirs.GetCounter();
+            }
         }
 
         const double z0Fac = getZFactor(z0);
 
-        #pragma omp parallel for
+        #pragma omp parallel for schedule(dynamic)
         for (int i = 0; i < static_cast<int>(nSamples); i++)
         {
             // retain previous results from model if running in a proxy model environment
@@ -55,6 +55,12 @@ namespace Deltares::Reliability
          */
         DesignPointMethod designPointMethod = DesignPointMethod::CenterOfGravity;
 
+        /**
+         * \brief Indicates whether each thread calculates whole directions, instead of calculating the steps of all directions together
+         * \remark Keeps all threads busy when the number of model runs differs per direction
+         */
+        bool DirectionsPerThread = false;
+
         /**
          * \brief Settings for calculating one direction
          */
@@ -61,10 +61,7 @@ namespace Deltares::Reliability
 
         for (const auto& contributingDesignPoint : dsfiDesignPoint->ContributingDesignPoints)
         {
-            for (const auto& evaluation : contributingDesignPoint->Evaluations)
-            {
-                dsfiDesignPoint->Evaluations.push_back(evaluation);
-            }
+            dsfiDesignPoint->Evaluations.append(contributingDesignPoint->Evaluations);
         }
 
         return dsfiDesignPoint;
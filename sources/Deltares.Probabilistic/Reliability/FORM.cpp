@@ -124,7 +124,7 @@ namespace Deltares::Reliability
         while (!convergenceReport->IsConverged && iteration < this->Settings->MaximumIterations && !this->isStopped())
         {
             sample->IterationIndex = iteration;
-            zGradient = gradientCalculator.getGradient(*modelRunner, sample);
+            zGradient = gradientCalculator.getIterativeGradient(*modelRunner, sample);
 
             // check whether there are valid results
 
@@ -209,6 +209,15 @@ namespace Deltares::Reliability
             convergenceReport->ZMargin = zGradientLength * this->Settings->EpsilonBeta;
             convergenceReport->TotalIterations = iteration + 1;
 
+            if (convergenceReport->IsConverged && !gradientCalculator.isFullGradient())
+            {
+                // confirm the convergence with a finite difference gradient at the same location
+                gradientCalculator.requireFullGradient();
+                convergenceReport->IsConverged = false;
+                iteration++;
+                continue;
+            }
+
             // no convergence, next iteration
             if (!convergenceReport->IsConverged)
             {
@@ -0,0 +1,188 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "HamiltonianSampler.h"
+#include "../Statistics/StandardNormal.h"
+
+#include <cmath>
+#include <numbers>
+
+namespace Deltares::Reliability
+{
+    using namespace Deltares::Models;
+
+    void HamiltonianSampler::initializeLevel(ModelRunner& modelRunner, const std::vector<std::shared_ptr<Sample>>& seeds)
+    {
+        double sum = 0;
+        double sumSquared = 0;
+        for (const std::shared_ptr<Sample>& seed : seeds)
+        {
+            sum += getScaledZ(*seed);
+            sumSquared += getScaledZ(*seed) * getScaledZ(*seed);
+        }
+
+        const double n = static_cast<double>(seeds.size());
+        const double variance = n > 1 ? (sumSquared - sum * sum / n) / (n - 1) : 0;
+        smoothing = variance > 0 ? std::sqrt(variance) : 1;
+
+        stepSize = StepSize;
+
+        drifts = getDrifts(modelRunner, seeds);
+    }
+
+    std::vector<std::shared_ptr<Sample>> HamiltonianSampler::step(ModelRunner& modelRunner, const std::vector<int>& chains,
+        const std::vector<std::shared_ptr<Sample>>& states, std::vector<Numeric::RandomValueGenerator>& generators)
+    {
+        std::vector<std::shared_ptr<Sample>> proposals;
+
+        for (size_t i = 0; i < states.size(); i++)
+        {
+            const std::vector<double>& drift = drifts[chains[i]];
+
+            std::vector<double> values(states[i]->Values.size());
+            for (size_t j = 0; j < values.size(); j++)
+            {
+                values[j] = states[i]->Values[j] + 0.5 * stepSize * stepSize * drift[j] + stepSize * getStandardNormalValue(generators[chains[i]]);
+            }
+
+            proposals.push_back(std::make_shared<Sample>(values));
+        }
+
+        calculateSamples(modelRunner, proposals);
+
+        // the drifts of all proposals in the failure domain are calculated in one batch
+        std::vector<size_t> candidates;
+        std::vector<std::shared_ptr<Sample>> candidateSamples;
+        for (size_t i = 0; i < states.size(); i++)
+        {
+            if (isInFailureDomain(*proposals[i]))
+            {
+                candidates.push_back(i);
+                candidateSamples.push_back(proposals[i]);
+            }
+        }
+
+        std::vector<std::vector<double>> proposalDrifts = getDrifts(modelRunner, candidateSamples);
+
+        std::vector<std::shared_ptr<Sample>> newStates = states;
+
+        for (size_t c = 0; c < candidates.size(); c++)
+        {
+            const size_t i = candidates[c];
+
+            const double logRatio = getLogDensity(proposals[i]->Values) - getLogDensity(states[i]->Values) +
+                getLogProposalDensity(*proposals[i], proposalDrifts[c], *states[i]) - getLogProposalDensity(*states[i], drifts[chains[i]], *proposals[i]);
+
+            if (std::log(generators[chains[i]].next()) < logRatio)
+            {
+                newStates[i] = proposals[i];
+                drifts[chains[i]] = proposalDrifts[c];
+            }
+        }
+
+        return newStates;
+    }
+
+    void HamiltonianSampler::adapt(double acceptanceRate, int stepIndex)
+    {
+        stepSize = getAdaptedScale(stepSize, acceptanceRate, TargetAcceptanceRate, stepIndex);
+    }
+
+    std::vector<std::vector<double>> HamiltonianSampler::getDrifts(ModelRunner& modelRunner, const std::vector<std::shared_ptr<Sample>>& samples)
+    {
+        // finite differences around samples with a known z-value, the perturbed samples of all samples form one batch
+        const bool twoDirections = GradientSettings->gradientType == GradientType::TwoDirections;
+        const double stepSize = GradientSettings->StepSize;
+        const double du = 0.5 * stepSize;
+        const size_t perSample = twoDirections ? 2 : 1;
+
+        std::vector<std::shared_ptr<Sample>> perturbed;
+        for (const std::shared_ptr<Sample>& sample : samples)
+        {
+            for (size_t j = 0; j < sample->Values.size(); j++)
+            {
+                if (twoDirections)
+                {
+                    std::shared_ptr<Sample> low = sample->clone();
+                    low->Values[j] -= du;
+                    perturbed.push_back(low);
+                }
+
+                std::shared_ptr<Sample> high = sample->clone();
+                high->Values[j] += du;
+                perturbed.push_back(high);
+            }
+        }
+
+        calculateSamples(modelRunner, perturbed);
+
+        std::vector<std::vector<double>> result;
+        size_t index = 0;
+        for (const std::shared_ptr<Sample>& sample : samples)
+        {
+            std::vector<double> gradient(sample->Values.size());
+            for (size_t j = 0; j < gradient.size(); j++)
+            {
+                if (twoDirections)
+                {
+                    gradient[j] = (perturbed[index + 1]->Z - perturbed[index]->Z) / stepSize;
+                }
+                else
+                {
+                    gradient[j] = (perturbed[index]->Z - sample->Z) / du;
+                }
+                index += perSample;
+            }
+
+            result.push_back(getDrift(*sample, gradient));
+        }
+
+        return result;
+    }
+
+    std::vector<double> HamiltonianSampler::getDrift(const Sample& sample, const std::vector<double>& gradient) const
+    {
+        // gradient of the logarithm of the standard normal density times the smoothed indicator of the failure domain
+        const double w = (getThreshold() - getScaledZ(sample)) / smoothing;
+        const double millsRatio = std::exp(-0.5 * w * w) / std::sqrt(2 * std::numbers::pi) / Statistics::StandardNormal::getPFromU(w);
+        std::vector<double> drift(sample.Values.size());
+        for (size_t j = 0; j < drift.size(); j++)
+        {
+            const double barrier = std::isfinite(millsRatio * gradient[j]) ? millsRatio * getZMultiplier() * gradient[j] / smoothing : 0;
+            drift[j] = -sample.Values[j] - barrier;
+        }
+
+        return drift;
+    }
+
+    double HamiltonianSampler::getLogProposalDensity(const Sample& from, const std::vector<double>& drift, const Sample& to) const
+    {
+        double sumSquared = 0;
+        for (size_t j = 0; j < to.Values.size(); j++)
+        {
+            const double difference = to.Values[j] - from.Values[j] - 0.5 * stepSize * stepSize * drift[j];
+            sumSquared += difference * difference;
+        }
+
+        return -sumSquared / (2 * stepSize * stepSize);
+    }
+}
+
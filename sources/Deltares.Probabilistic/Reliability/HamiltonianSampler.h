@@ -0,0 +1,83 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include "SubsetSimulationSampler.h"
+#include "../Model/GradientSettings.h"
+
+namespace Deltares::Reliability
+{
+    /**
+     * \brief Hamiltonian kernel for subset simulation
+     * \remark Performs one leapfrog step (Langevin proposal) on a smoothed failure domain, using the gradient of the model.
+     *         The proposal is accepted or rejected with respect to the exact failure domain, so the samples follow the exact distribution.
+     *         The gradient is calculated once per accepted sample and reused while its chain does not move.
+     */
+    class HamiltonianSampler : public SubsetSimulationSampler
+    {
+    public:
+        /**
+         * \brief Initial step size of the leapfrog step
+         */
+        double StepSize = 0.5;
+
+        /**
+         * \brief Acceptance rate to which the step size is adapted
+         */
+        double TargetAcceptanceRate = 0.574;
+
+        /**
+         * \brief Settings for the calculation of gradients
+         */
+        std::shared_ptr<Models::GradientSettings> GradientSettings = std::make_shared<Models::GradientSettings>();
+
+        std::string getName() const override { return "hamiltonian"; }
+
+    protected:
+        void initializeLevel(Models::ModelRunner& modelRunner, const std::vector<std::shared_ptr<Models::Sample>>& seeds) override;
+        std::vector<std::shared_ptr<Models::Sample>> step(Models::ModelRunner& modelRunner, const std::vector<int>& chains,
+            const std::vector<std::shared_ptr<Models::Sample>>& states, std::vector<Numeric::RandomValueGenerator>& generators) override;
+        void adapt(double acceptanceRate, int stepIndex) override;
+
+    private:
+        /**
+         * \brief Gradient of the logarithm of the smoothed density, per chain at its current sample
+         */
+        std::vector<std::vector<double>> drifts;
+
+        /**
+         * \brief Width of the transition zone of the smoothed failure domain, in z-value
+         */
+        double smoothing = 1;
+
+        double stepSize = 0.5;
+
+        /**
+         * \brief Gets the drifts of samples with a known z-value, all gradients are calculated in one batch
+         */
+        std::vector<std::vector<double>> getDrifts(Models::ModelRunner& modelRunner, const std::vector<std::shared_ptr<Models::Sample>>& samples);
+
+        std::vector<double> getDrift(const Models::Sample& sample, const std::vector<double>& gradient) const;
+        double getLogProposalDensity(const Models::Sample& from, const std::vector<double>& drift, const Models::Sample& to) const;
+    };
+}
+
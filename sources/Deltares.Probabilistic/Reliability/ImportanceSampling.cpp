@@ -24,6 +24,7 @@
 #include <vector>
 #include <cmath>
 #include <format>
+#include <map>
 #include <memory>
 
 #include "../Math/NumericSupport.h"
@@ -79,10 +80,17 @@ namespace Deltares::Reliability
         // list of all clusters
         std::shared_ptr<DesignPoint> startDesignPoint = nullptr;
         std::vector<std::shared_ptr<ImportanceSamplingCluster>> clusterResults = getClusters(*modelRunner, startDesignPoint);
+        this->lastClusterResults = clusterResults;
+
+        // fractions of the samples per cluster and the credits of the clusters to get the next sample
+        const bool proportional = Settings->ClusterAllocation == ClusterAllocationType::Proportional && clusterResults.size() > 1;
+        std::vector<double> fractions = getInitialClusterFractions(clusterResults.size());
+        std::vector<double> credits(clusterResults.size(), 0.0);
 
         // holds the clusters corresponding to the samples
         int clusterIndex = -1;
         std::vector<std::shared_ptr<ImportanceSamplingCluster>> clusters;
+        std::vector<std::shared_ptr<ImportanceSamplingCluster>> nearestClusters;
 
         std::shared_ptr<ImportanceSamplingCluster> combinedCluster = std::make_shared<ImportanceSamplingCluster>();
         combinedCluster->Center = Settings->StochastSet->getStartPoint();
@@ -122,19 +130,52 @@ namespace Deltares::Reliability
                     runs = runs - 1;
                 }
 
-                // prepare realizations
+                // prepare realizations, the random samples are drawn at once and shifted and weighted in parallel
+                std::vector<std::shared_ptr<Sample>> randomSamples = sampleCreator.getRandomSamples(runs);
+
+                const size_t offset = samples.size();
+
+                if (proportional)
+                {
+                    std::vector<std::shared_ptr<Sample>> centers;
+                    for (const std::shared_ptr<ImportanceSamplingCluster>& cluster : clusterResults)
+                    {
+                        centers.push_back(cluster->Center);
+                    }
+
+                    // update the allocation with the results so far
+                    std::vector<double> newFractions = getClusterFractions(centers, clusterResults, Settings->DefensiveFraction);
+                    if (!newFractions.empty())
+                    {
+                        fractions = newFractions;
+                    }
+                }
+
                 for (int i = 0; i < runs; i++)
                 {
-                    // get values for stochastic parameters
-                    clusterIndex++;
-                    if (clusterIndex >= clusterResults.size())
+                    if (proportional)
                     {
-                        clusterIndex = 0;
+                        clusterIndex = selectCluster(fractions, credits);
                     }
+                    else
+                    {
+                        clusterIndex++;
+                        if (clusterIndex >= clusterResults.size())
+                        {
+                            clusterIndex = 0;
+                        }
+                    }
+
+                    clusters.push_back(clusterResults[clusterIndex]);
+                }
 
-                    std::shared_ptr<ImportanceSamplingCluster> cluster = clusterResults[clusterIndex];
+                samples.resize(offset + runs);
 
-                    const std::shared_ptr<Sample> sample = sampleCreator.getRandomSample();
+#pragma omp parallel for
+                for (int i = 0; i < runs; i++)
+                {
+                    const std::shared_ptr<Sample>& sample = randomSamples[i];
+                    const std::shared_ptr<ImportanceSamplingCluster>& cluster = clusters[offset + i];
 
                     std::shared_ptr<Sample> modifiedSample = sample->clone();
 
@@ -145,13 +186,15 @@ namespace Deltares::Reliability
 
                     modifiedSample->Weight = ImportanceSamplingSupport::getWeight(*modifiedSample, *sample, dimensionality);
 
-                    samples.push_back(modifiedSample);
-                    clusters.push_back(cluster);
+                    samples[offset + i] = modifiedSample;
                 }
 
                 // calculate realizations
                 zValues = modelRunner->getZValues(samples);
 
+                // samples which are nearer to another cluster do not contribute to their own cluster
+                nearestClusters = getNearestClusters(samples, clusterResults);
+
                 if (initial)
                 {
                     z0Fac = getZFactor(zValues[0]);
@@ -168,7 +211,7 @@ namespace Deltares::Reliability
                 if (modelRunner->shouldExitPrematurely(samples))
                 {
                     // return the result so far
-                    auto designPoint = modelRunner->getDesignPoint(combinedCluster->designPointBuilder.getSample(),
+                    auto designPoint = modelRunner->getDesignPoint(combinedCluster->getDesignPoint(),
                         Statistics::StandardNormal::getUFromQ(combinedCluster->ProbFailure), convergenceReport);
                     if (startDesignPoint != nullptr)
                     {
@@ -220,7 +263,10 @@ namespace Deltares::Reliability
 
             std::shared_ptr<Sample> sample = samples[zIndex];
             sample->Z = z;
-            sample->Z = getCorrectionForOverlappingClusters(*sample, sampleCluster, clusterResults);
+            if (nearestClusters[zIndex] != sampleCluster)
+            {
+                sample->Z = 0.0;
+            }
 
             combinedCluster->addSample(sample);
             sampleCluster->addSample(sample);
@@ -239,9 +285,17 @@ namespace Deltares::Reliability
             double probFailure = getProbabilityOfFailure(clusterResults);
 
             // if there is at least one failure and at least one non-failure observed
-            if (probFailure > 0)
+            if (probFailure > 0 && !enoughSamples && zIndex < static_cast<int>(zValues.size()) - 1)
+            {
+                // convergence can not be reached yet, the design point to report the convergence is only calculated at the end of the chunk
+                reportProbability(*modelRunner, probFailure, sampleIndex);
+
+                convergenceReport->FailWeight = combinedCluster->FailWeight;
+                convergenceReport->MaxWeight = combinedCluster->MaxFailWeight;
+            }
+            else if (probFailure > 0)
             {
-                std::shared_ptr<Sample> designPoint = combinedCluster->designPointBuilder.getSample();
+                std::shared_ptr<Sample> designPoint = combinedCluster->getDesignPoint();
 
                 std::shared_ptr<ImportanceSamplingCluster> mostContributingCluster = findMostContributingCluster(clusterResults);
                 double designPointWeight = ImportanceSamplingSupport::getSampleWeight(*designPoint, *mostContributingCluster->Center, dimensionality, factors);
@@ -264,7 +318,7 @@ namespace Deltares::Reliability
         double probFailure = getProbabilityOfFailure(clusterResults);
         double beta = Statistics::StandardNormal::getUFromQ(probFailure);
 
-        std::shared_ptr<Sample> minSample = combinedCluster->designPointBuilder.getSample();
+        std::shared_ptr<Sample> minSample = combinedCluster->getDesignPoint();
 
         std::shared_ptr<ImportanceSamplingCluster> mostContributingCluster = findMostContributingCluster(clusterResults);
         double designPointWeight = ImportanceSamplingSupport::getSampleWeight(*minSample, *mostContributingCluster->Center, dimensionality, factors);
@@ -284,7 +338,7 @@ namespace Deltares::Reliability
             {
                 std::string clusterIdentifier = std::format("Cluster {0:}", i + 1);
                 double clusterBeta = Statistics::StandardNormal::getUFromQ(clusterResults[i]->ProbFailure);
-                std::shared_ptr<Sample> clusterSample = clusterResults[i]->designPointBuilder.getSample();
+                std::shared_ptr<Sample> clusterSample = clusterResults[i]->getDesignPoint();
                 std::shared_ptr<DesignPoint> clusterDesignPoint = modelRunner->getDesignPoint(clusterSample, clusterBeta, convergenceReport, clusterIdentifier);
 
                 designPoint->ContributingDesignPoints.push_back(clusterDesignPoint);
@@ -330,23 +384,114 @@ namespace Deltares::Reliability
         }
     }
 
+    void ImportanceSampling::reportProbability(ModelRunner& modelRunner, double pf, int nmaal) const
+    {
+        std::shared_ptr<ReliabilityReport> report = std::make_shared<ReliabilityReport>();
+        report->Step = nmaal;
+        report->MaxSteps = Settings->MaximumSamples;
+
+        if (pf > 0 && pf < 1)
+        {
+            report->Reliability = Statistics::StandardNormal::getUFromQ(pf);
+        }
+
+        modelRunner.reportResult(report);
+    }
+
     bool ImportanceSampling::prematureExit(const ImportanceSamplingSettings& settings, int samples, int runs)
     {
         return samples == 0 && runs > settings.MaximumSamplesNoResult;
     }
 
-    double ImportanceSampling::getCorrectionForOverlappingClusters(const Sample& sample, const std::shared_ptr<ImportanceSamplingCluster>& clusterResult, std::vector<std::shared_ptr<ImportanceSamplingCluster>>& clusterResults)
+    std::vector<double> ImportanceSampling::getInitialClusterFractions(size_t clusterCount) const
     {
-        std::shared_ptr<ImportanceSamplingCluster> nearestCluster = getNearestCluster(sample, clusterResults);
-
-        if (nearestCluster != clusterResult)
+        if (Settings->ClusterFractions.size() == clusterCount)
         {
-            return 0.0;
+            return Settings->ClusterFractions;
         }
         else
         {
-            return sample.Z;
+            return std::vector<double>(clusterCount, 1.0 / static_cast<double>(clusterCount));
+        }
+    }
+
+    std::vector<double> ImportanceSampling::getClusterFractions(const std::vector<std::shared_ptr<Sample>>& centers,
+        const std::vector<std::shared_ptr<ImportanceSamplingCluster>>& clusterResults, double defensiveFraction)
+    {
+        if (centers.empty() || clusterResults.empty())
+        {
+            return {};
+        }
+
+        // number of centers which use the results of a cluster, the results are divided over these centers
+        std::vector<std::shared_ptr<ImportanceSamplingCluster>> nearestClusters;
+        std::map<std::shared_ptr<ImportanceSamplingCluster>, int> counts;
+
+        std::vector<std::shared_ptr<ImportanceSamplingCluster>> clusters = clusterResults;
+        for (const std::shared_ptr<Sample>& center : centers)
+        {
+            std::shared_ptr<ImportanceSamplingCluster> nearestCluster = getNearestCluster(*center, clusters);
+            nearestClusters.push_back(nearestCluster);
+            counts[nearestCluster]++;
         }
+
+        std::vector<double> deviations;
+        double sumDeviations = 0;
+
+        for (const std::shared_ptr<ImportanceSamplingCluster>& nearestCluster : nearestClusters)
+        {
+            const double deviation = nearestCluster->getStandardDeviation() / counts[nearestCluster];
+            deviations.push_back(deviation);
+            sumDeviations += deviation;
+        }
+
+        if (sumDeviations <= 0 || std::isnan(sumDeviations))
+        {
+            return {};
+        }
+
+        // mix with an equal allocation, so that clusters without failing samples so far are still sampled
+        const double equalFraction = defensiveFraction / static_cast<double>(centers.size());
+
+        std::vector<double> fractions;
+        for (double deviation : deviations)
+        {
+            fractions.push_back(equalFraction + (1 - defensiveFraction) * deviation / sumDeviations);
+        }
+
+        return fractions;
+    }
+
+    int ImportanceSampling::selectCluster(const std::vector<double>& fractions, std::vector<double>& credits)
+    {
+        // smooth weighted round robin: each cluster gains its fraction, the cluster with most credit gets the sample
+        int selected = 0;
+
+        for (size_t i = 0; i < fractions.size(); i++)
+        {
+            credits[i] += fractions[i];
+            if (credits[i] > credits[selected])
+            {
+                selected = static_cast<int>(i);
+            }
+        }
+
+        credits[selected] -= 1.0;
+
+        return selected;
+    }
+
+    std::vector<std::shared_ptr<ImportanceSamplingCluster>> ImportanceSampling::getNearestClusters(const std::vector<std::shared_ptr<Sample>>& samples, std::vector<std::shared_ptr<ImportanceSamplingCluster>>& clusterResults)
+    {
+        std::vector<std::shared_ptr<ImportanceSamplingCluster>> nearestClusters(samples.size());
+
+#pragma omp parallel for
+        for (int i = 0; i < static_cast<int>(samples.size()); i++)
+        {
+            nearestClusters[i] = getNearestCluster(*samples[i], clusterResults);
+        }
+
+        return nearestClusters;
     }
 
     std::shared_ptr<ImportanceSamplingCluster> ImportanceSampling::getNearestCluster(const Sample& sample, std::vector<std::shared_ptr<ImportanceSamplingCluster>>& clusters)
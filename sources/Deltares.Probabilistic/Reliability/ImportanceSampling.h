@@ -41,18 +41,40 @@ namespace Deltares::Reliability
             return this->Settings->isValid();
         }
 
+        /**
+         * \brief Gets the results per cluster of the last calculation
+         */
+        const std::vector<std::shared_ptr<ImportanceSamplingCluster>>& getClusterResults() const { return lastClusterResults; }
+
+        /**
+         * \brief Gets the fraction of the samples per cluster, which minimizes the variance of the probability of failure
+         * \param centers Centers of the clusters for which the fractions are calculated
+         * \param clusterResults Results per cluster, each center uses the results of the nearest cluster
+         * \param defensiveFraction Fraction of the samples which is divided equally over the centers
+         * \return Fraction per center, empty when the results do not contain any failing samples
+         * \remark The fractions are proportional to the estimated standard deviation per cluster (Neyman allocation).
+         *         Since each cluster estimates the probability of failure in its own part of the u-space by the mean of its
+         *         own samples, the estimator remains unbiased for any allocation which gives every cluster samples.
+         */
+        static std::vector<double> getClusterFractions(const std::vector<std::shared_ptr<Models::Sample>>& centers,
+            const std::vector<std::shared_ptr<ImportanceSamplingCluster>>& clusterResults, double defensiveFraction);
+
     private:
         RegisterSampleLambda sampleFunction = nullptr;
         BreakLoopLambda breakFunction = nullptr;
+        std::vector<std::shared_ptr<ImportanceSamplingCluster>> lastClusterResults;
         std::vector<std::shared_ptr<ImportanceSamplingCluster>> getClusters(Models::ModelRunner& modelRunner, std::shared_ptr<DesignPoint>& startDesignPoint) const;
         bool checkConvergence(Models::ModelRunner& modelRunner, double pf, double minWeight, int samples, int nmaal) const;
+        void reportProbability(Models::ModelRunner& modelRunner, double pf, int nmaal) const;
         static std::vector<double> getFactors(const StochastSettingsSet& stochastSettings);
         static double getProbabilityOfFailure(const std::vector<std::shared_ptr<ImportanceSamplingCluster>>& clusters);
 
         static bool prematureExit(const ImportanceSamplingSettings& settings, int samples, int runs);
-        static double getCorrectionForOverlappingClusters(const Models::Sample& sample, const std::shared_ptr<ImportanceSamplingCluster>& clusterResult,
+        static std::vector<std::shared_ptr<ImportanceSamplingCluster>> getNearestClusters(const std::vector<std::shared_ptr<Models::Sample>>& samples,
             std::vector<std::shared_ptr<ImportanceSamplingCluster>>& clusterResults);
         static std::shared_ptr<ImportanceSamplingCluster> getNearestCluster(const Models::Sample& sample, std::vector<std::shared_ptr<ImportanceSamplingCluster>>& clusters);
+        std::vector<double> getInitialClusterFractions(size_t clusterCount) const;
+        static int selectCluster(const std::vector<double>& fractions, std::vector<double>& credits);
         static std::shared_ptr<ImportanceSamplingCluster> findMostContributingCluster(const std::vector<std::shared_ptr<ImportanceSamplingCluster>>& clusters);
 
         bool breakLoopWithFailureObs(bool enoughSamples, bool smallEnough, const std::shared_ptr<ImportanceSamplingCluster>& results) const;
@@ -20,6 +20,9 @@
 // All rights reserved.
 //
 #include "ImportanceSamplingCluster.h"
+#include <algorithm>
+#include <cmath>
+
 #include "../Statistics/StandardNormal.h"
 #include "../Math/NumericSupport.h"
 
@@ -31,6 +34,7 @@ namespace Deltares::Reliability
         this->z0Ignore = z0Ignore;
 
         designPointBuilder = DesignPointBuilder(nStochasts, method, stochastSet);
+        pendingSamples.clear();
 
         designPointBuilder.initialize(z0Fac * Statistics::StandardNormal::BetaMax);
     }
@@ -45,7 +49,8 @@ namespace Deltares::Reliability
             FailCount++;
             FailWeight += sample->Weight;
             MaxFailWeight = std::max(MaxFailWeight, sample->Weight);
-            designPointBuilder.addSample(sample);
+            FailWeight2 += sample->Weight * sample->Weight;
+            pendingSamples.push_back(sample);
         }
 
         if (this->NearestSample == nullptr || std::abs(sample->Z) < std::abs(this->NearestSample->Z))
@@ -58,6 +63,32 @@ namespace Deltares::Reliability
         this->ProbFailure = getProbabilityOfFailure(!z0Ignore);
     }
 
+    std::shared_ptr<Models::Sample> ImportanceSamplingCluster::getDesignPoint()
+    {
+        if (!pendingSamples.empty())
+        {
+            designPointBuilder.addSamples(pendingSamples);
+            pendingSamples.clear();
+        }
+
+        return designPointBuilder.getSample();
+    }
+
+    double ImportanceSamplingCluster::getStandardDeviation() const
+    {
+        if (this->TotalCount == 0)
+        {
+            return 0;
+        }
+        else
+        {
+            const double mean = this->FailWeight / this->TotalCount;
+            const double mean2 = this->FailWeight2 / this->TotalCount;
+
+            return std::sqrt(std::max(0.0, mean2 - mean * mean));
+        }
+    }
+
     double ImportanceSamplingCluster::getProbabilityOfFailure(bool useCount)
     {
         if (this->FailCount == 0)
@@ -21,6 +21,7 @@
 //
 #pragma once
 #include <memory>
+#include <vector>
 
 #include "DesignPointBuilder.h"
 #include "../Model/Sample.h"
@@ -43,15 +44,33 @@ namespace Deltares::Reliability
         double FailWeight = 0.0;
         double FailFraction = 0.0;
         double MaxFailWeight = 0.0;
+        double FailWeight2 = 0.0; // sum of the squared weights of failing samples
 
         void initialize(int nStochasts, double z0Fac, bool z0Ignore, DesignPointMethod method, std::shared_ptr<StochastSettingsSet> stochastSet);
         void addSample(std::shared_ptr<Deltares::Models::Sample> sample);
 
+        /**
+         * \brief Gets the design point of the samples added so far
+         * \remark Failing samples are added to the design point builder at once when the design point is requested
+         */
+        std::shared_ptr<Models::Sample> getDesignPoint();
+
+        /**
+         * \brief Gets the estimated standard deviation of the weighted failure indicator of a sample in this cluster
+         * \remark The variance of the probability of failure of this cluster is the squared standard deviation divided by the number of samples
+         */
+        double getStandardDeviation() const;
+
         std::shared_ptr<Models::Sample> NearestSample = nullptr; // result sample which is nearest to the limit state
     private:
         double z0Fac = 0;
         bool z0Ignore = false;
 
+        /**
+         * \brief Failing samples which are not added to the design point builder yet
+         */
+        std::vector<std::shared_ptr<Models::Sample>> pendingSamples;
+
         double getProbabilityOfFailure(bool useCount);
         double getProbability(double z0Fac, double failWeight, double totalWeight);
     };
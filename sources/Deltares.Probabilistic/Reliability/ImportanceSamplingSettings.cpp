@@ -20,3 +20,24 @@
 // All rights reserved.
 //
 #include "ImportanceSamplingSettings.h"
+#include "../Utils/probLibException.h"
+
+namespace Deltares::Reliability
+{
+    std::string ImportanceSamplingSettings::getClusterAllocationString(ClusterAllocationType allocation)
+    {
+        switch (allocation)
+        {
+        case ClusterAllocationType::Equal: return "equal";
+        case ClusterAllocationType::Proportional: return "proportional";
+        default: throw probLibException("Cluster allocation");
+        }
+    }
+
+    ClusterAllocationType ImportanceSamplingSettings::getClusterAllocation(std::string allocation)
+    {
+        if (allocation == "equal") return ClusterAllocationType::Equal;
+        else if (allocation == "proportional") return ClusterAllocationType::Proportional;
+        else throw probLibException("Cluster allocation");
+    }
+}
@@ -30,6 +30,22 @@
 
 namespace Deltares::Reliability
 {
+    /**
+     * \brief Way in which samples are allocated to the clusters in importance sampling
+     */
+    enum class ClusterAllocationType
+    {
+        /**
+         * \brief All clusters get the same number of samples
+         */
+        Equal,
+
+        /**
+         * \brief Clusters get samples in proportion to the estimated standard deviation of their contribution to the probability of failure
+         */
+        Proportional
+    };
+
     class ImportanceSamplingSettings : public Models::Validatable
     {
     public:
@@ -80,6 +96,22 @@ namespace Deltares::Reliability
         bool Clustering = false;
         std::vector<std::shared_ptr<Models::Sample>> Clusters;
 
+        /**
+         * \brief Way in which samples are allocated to the clusters
+         */
+        ClusterAllocationType ClusterAllocation = ClusterAllocationType::Equal;
+
+        /**
+         * \brief Fraction of the samples which is divided equally over the clusters when the allocation is proportional, so that all clusters keep being sampled
+         */
+        double DefensiveFraction = 0.1;
+
+        /**
+         * \brief Initial fraction of the samples per cluster when the allocation is proportional
+         * \remark When empty or when the number of fractions differs from the number of clusters, the samples are allocated equally
+         */
+        std::vector<double> ClusterFractions;
+
         void validateStochastSettings(Logging::ValidationReport& report) const
         {
             for (int i = 0; i < this->StochastSet->getVaryingStochastCount(); i++)
@@ -103,6 +135,8 @@ namespace Deltares::Reliability
             Logging::ValidationSupport::checkMinimumInt(report, MinimumSamples, MaximumSamples, "maximum samples");
             Logging::ValidationSupport::checkMinimum(report, 0.01, VarianceFactor, "variance factor");
             Logging::ValidationSupport::checkMinimum(report, 0, VariationCoefficient, "variation coefficient");
+            Logging::ValidationSupport::checkMinimum(report, 0.01, DefensiveFraction, "defensive fraction");
+            Logging::ValidationSupport::checkMaximum(report, 1, DefensiveFraction, "defensive fraction");
 
             validateStochastSettings(report);
 
@@ -123,6 +157,9 @@ namespace Deltares::Reliability
             clone->VarianceFactor = this->VarianceFactor;
             clone->VariationCoefficient = this->VariationCoefficient;
             clone->designPointMethod = this->designPointMethod;
+            clone->ClusterAllocation = this->ClusterAllocation;
+            clone->DefensiveFraction = this->DefensiveFraction;
+            clone->ClusterFractions = this->ClusterFractions;
 
             // move to adaptive importance sampling settings
             clone->Clustering = this->Clustering;
@@ -140,6 +177,9 @@ namespace Deltares::Reliability
 
             return clone;
         }
+
+        static std::string getClusterAllocationString(ClusterAllocationType allocation);
+        static ClusterAllocationType getClusterAllocation(std::string allocation);
     };
 }
 
@@ -19,11 +19,12 @@
 // Stichting Deltares and remain full property of Stichting Deltares at all times.
 // All rights reserved.
 //
+#include <algorithm>
 #include <set>
 #include <cmath>
 #include "IntegrationGrid.h"
 #include "../Math/BinarySupport.h"
-#include "../Utils/probLibString.h"
+#include "../Utils/probLibException.h"
 #include "../Statistics/Stochast.h"
 
 using namespace Deltares::Numeric;
@@ -137,36 +138,28 @@ namespace Deltares::Reliability
         return probability;
     }
 
-    bool IntegrationLine::OnSameSide(IntegrationPoint& previousPoint, IntegrationPoint& nextPoint)
+    bool IntegrationLine::OnSameSide(const IntegrationPoint& previousPoint, const IntegrationPoint& nextPoint) const
     {
-        return pointSides[&previousPoint] == pointSides[&nextPoint] || pointSides[&previousPoint] == 0 || pointSides[&nextPoint] == 0;
+        const int previousSide = GetSide(&previousPoint);
+        const int nextSide = GetSide(&nextPoint);
+        return previousSide == nextSide || previousSide == 0 || nextSide == 0;
     }
 
-    size_t IntegrationLine::get_index(std::shared_ptr<IntegrationPoint> point)
+    size_t IntegrationLine::get_index(const IntegrationPoint* point) const
     {
-        for (size_t i = 0; i < Points.size(); i++)
-        {
-            if (Points[i] == point)
-            {
-                return i;
-            }
-        }
-        throw probLibException("index not found in integrationLine");
-    }
+        const LatticeIndex position = point->Lattice[getDimension()];
+        auto it = std::lower_bound(Points.begin(), Points.end(), position,
+            [](const LinePoint& linePoint, LatticeIndex value) { return linePoint.Position < value; });
 
-    size_t IntegrationLine::get_index(IntegrationPoint* point)
-    {
-        for (size_t i = 0; i < Points.size(); i++)
+        if (it == Points.end() || it->Point != point)
         {
-            if (Points[i].get() == point)
-            {
-                return i;
-            }
+            throw probLibException("index not found in integrationLine");
         }
-        throw probLibException("index not found in integrationLine");
+
+        return static_cast<size_t>(it - Points.begin());
     }
 
-    bool IntegrationLine::HasNextKnownPoint(std::shared_ptr<IntegrationPoint> point, const DoubleType result)
+    bool IntegrationLine::HasNextKnownPoint(const IntegrationPoint* point, const DoubleType result) const
     {
         size_t index = get_index(point);
 
@@ -174,7 +167,8 @@ namespace Deltares::Reliability
         {
             for (size_t i = index + 1; i < this->Points.size(); i++)
             {
-                if (this->Points[i]->isKnown() && (this->Points[i]->getResult() == result || this->Points[i]->getResult() == DoubleType::Zero))
+                const IntegrationPoint* linePoint = this->Points[i].Point;
+                if (linePoint->isKnown() && (linePoint->getResult() == result || linePoint->getResult() == DoubleType::Zero))
                 {
                     return true;
                 }
@@ -184,14 +178,15 @@ namespace Deltares::Reliability
         return false;
     }
 
-    bool IntegrationLine::HasPreviousKnownPoint(std::shared_ptr<IntegrationPoint> point, DoubleType result)
+    bool IntegrationLine::HasPreviousKnownPoint(const IntegrationPoint* point, DoubleType result) const
     {
         size_t index = get_index(point);
         if (index > 0 && index < this->Points.size() - 1)
         {
-            for (int i = index - 1; i >= 0; i--)
+            for (int i = static_cast<int>(index) - 1; i >= 0; i--)
             {
-                if (this->Points[i]->isKnown() && (this->Points[i]->getResult() == result || this->Points[i]->getResult() == DoubleType::Zero))
+                const IntegrationPoint* linePoint = this->Points[i].Point;
+                if (linePoint->isKnown() && (linePoint->getResult() == result || linePoint->getResult() == DoubleType::Zero))
                 {
                     return true;
                 }
@@ -202,7 +197,15 @@ namespace Deltares::Reliability
     }
 
     IntegrationCell::IntegrationCell(IntegrationDomain& d, const std::vector<double>& lower_bounds, const std::vector<double>& upper_bounds)
-    : lowerBoundaries(lower_bounds), upperBoundaries(upper_bounds), domain(d)
+        : IntegrationCell(d, lower_bounds, upper_bounds,
+            std::vector<LatticeIndex>(lower_bounds.size(), IntegrationDomain::lowerIndex),
+            std::vector<LatticeIndex>(upper_bounds.size(), IntegrationDomain::upperIndex))
+    {
+    }
+
+    IntegrationCell::IntegrationCell(IntegrationDomain& d, const std::vector<double>& lower_bounds, const std::vector<double>& upper_bounds,
+        const std::vector<LatticeIndex>& lower_lattice, const std::vector<LatticeIndex>& upper_lattice)
+    : lowerBoundaries(lower_bounds), upperBoundaries(upper_bounds), lowerLattice(lower_lattice), upperLattice(upper_lattice), domain(d)
     {
         for(const auto& bnd: lowerBoundaries)
         {
@@ -217,18 +220,24 @@ namespace Deltares::Reliability
 
     void IntegrationCell::UpdateCornerPoints()
     {
-        CornerPoints = std::vector<std::shared_ptr<IntegrationPoint>>();
-        std::vector<std::vector<double>> allBoundaries = { lowerBoundaries, upperBoundaries };
+        const size_t nDimensions = domain.getDimension();
+        const auto& sides = domain.getSplit();
+
+        CornerPoints.clear();
+        CornerPoints.reserve(sides.size());
 
-        for (auto& side : domain.getSplit())
+        std::vector<double> coordinates(nDimensions);
+        std::vector<LatticeIndex> lattice(nDimensions);
+
+        for (const auto& side : sides)
         {
-            std::vector<double> coordinates(domain.getDimension());
-            for (int i = 0; i < domain.getDimension(); i++)
+            for (size_t i = 0; i < nDimensions; i++)
             {
-                coordinates[i] = allBoundaries[side[i]][i];
+                coordinates[i] = side[i] == 0 ? lowerBoundaries[i] : upperBoundaries[i];
+                lattice[i] = side[i] == 0 ? lowerLattice[i] : upperLattice[i];
             }
 
-            CornerPoints.push_back(domain.GetIntegrationPoint(coordinates));
+            CornerPoints.push_back(domain.GetIntegrationPoint(coordinates, lattice));
         }
     }
 
@@ -243,59 +252,43 @@ namespace Deltares::Reliability
         return probability;
     }
 
-    size_t IntegrationCell::get_index() const
+    void IntegrationCell::split()
     {
-        for (size_t i = 0; i < domain.Cells.size(); i++)
-        {
-            if (domain.Cells[i].get() == this) return i;
-        }
-        throw probLibException("index not found in integration cell");
+        const IntegrationPoint* centerPoint = getCenterPoint();
+        split(centerPoint->Coordinates, centerPoint->Lattice);
     }
 
-    void IntegrationCell::split()
+    void IntegrationCell::splitAtOrigin()
     {
-        auto index = get_index();
-
-        bool isFirst = true;
-        for (auto& cornerPoint : this->CornerPoints)
-        {
-            std::shared_ptr<IntegrationCell> cell = std::make_shared<IntegrationCell>(domain, cornerPoint->Coordinates, getCenterPoint()->Coordinates);
-            if (isFirst)
-            {
-                domain.Cells[index] = cell;
-                isFirst = false;
-            }
-            else
-            {
-                domain.Cells.push_back(cell);
-            }
-        }
+        split(domain.getOrigin(), std::vector<LatticeIndex>(domain.getDimension(), IntegrationDomain::originIndex));
     }
 
-    void IntegrationCell::split(const std::vector<double>& coordinates)
+    void IntegrationCell::split(const std::vector<double>& coordinates, const std::vector<LatticeIndex>& lattice)
     {
-        auto index = get_index();
-
-        bool isFirst = true;
-        for (auto cornerPoint : this->CornerPoints)
+        std::shared_ptr<IntegrationCell> firstCell = nullptr;
+        for (const auto* cornerPoint : this->CornerPoints)
         {
-            std::shared_ptr<IntegrationCell> cell = std::make_shared<IntegrationCell>(domain, cornerPoint->Coordinates, coordinates);
-            if (isFirst)
+            std::shared_ptr<IntegrationCell> cell = std::make_shared<IntegrationCell>(domain, cornerPoint->Coordinates, coordinates, cornerPoint->Lattice, lattice);
+            if (firstCell == nullptr)
             {
-                domain.Cells[index] = cell;
-                isFirst = false;
+                cell->index = index;
+                firstCell = cell;
             }
             else
             {
+                cell->index = domain.Cells.size();
                 domain.Cells.push_back(cell);
             }
         }
+
+        // replaced as last action, because this cell may be released here
+        domain.Cells[firstCell->index] = firstCell;
     }
 
     void IntegrationCell::update()
     {
         bool allKnown = true;
-        for(const auto& p : CornerPoints)
+        for(const auto* p : CornerPoints)
         {
             if ( ! p->isKnown())
             {
@@ -312,7 +305,7 @@ namespace Deltares::Reliability
         {
             Known = true;
             std::set<DoubleType> resultsSet;
-            for(const auto& p : CornerPoints)
+            for(const auto* p : CornerPoints)
             {
                 resultsSet.insert(p->getResult());
             }
@@ -351,113 +344,169 @@ namespace Deltares::Reliability
     {
         auto Dimension = origin.size();
         split = Mathematics::BinarySupport::GetBinaryList(Dimension, 0, 1);
-        for (int i = 0; i < Dimension; i++)
+        Lines.resize(Dimension);
+        linesTables.resize(Dimension);
+    };
+
+    size_t IntegrationDomain::getHash(const std::vector<LatticeIndex>& lattice, size_t skipDimension)
+    {
+        uint64_t hash = 0x9E3779B97F4A7C15ULL;
+        for (size_t i = 0; i < lattice.size(); i++)
         {
-            Lines.push_back(std::vector<std::shared_ptr<IntegrationLine>>());
-            LinesSet.push_back(std::unordered_map<std::string, std::shared_ptr<IntegrationLine>>());
+            if (i == skipDimension) continue;
+
+            // lattice indices are multiples of large powers of two, so the bits are mixed thoroughly (splitmix64)
+            uint64_t x = static_cast<uint64_t>(lattice[i]) ^ (hash + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2));
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+            hash = x ^ (x >> 31);
         }
-    };
+        return static_cast<size_t>(hash);
+    }
 
-    std::shared_ptr<IntegrationPoint> IntegrationDomain::GetIntegrationPoint(std::vector<double>& coordinates)
+    IntegrationPoint* IntegrationDomain::GetIntegrationPoint(const std::vector<double>& coordinates, const std::vector<LatticeIndex>& lattice)
     {
-        auto hash = probLibString::doubles2strTrimmed(coordinates);
-        auto integrationPoint = pointsSet[hash];
+        const size_t hash = getHash(lattice, lattice.size());
+        const int index = pointsTable.find(hash, [&](int i) { return Points[i]->Lattice == lattice; });
 
-        if (integrationPoint == nullptr)
+        if (index != LatticeTable::empty)
         {
-            integrationPoint = std::make_shared<IntegrationPoint>(coordinates);
-            AddPoint(integrationPoint, hash);
+            return Points[index].get();
         }
 
-        return integrationPoint;
+        auto integrationPoint = std::make_shared<IntegrationPoint>(coordinates, lattice);
+        AddPoint(integrationPoint, hash);
+
+        return integrationPoint.get();
     }
 
-    void IntegrationDomain::AddPoint(std::shared_ptr<IntegrationPoint> point, const std::string& coordHash)
+    void IntegrationDomain::AddPoint(std::shared_ptr<IntegrationPoint> point, size_t hash)
     {
+        pointsTable.insert(hash, static_cast<int>(Points.size()));
         Points.push_back(point);
-        pointsSet[coordHash] = point;
 
-        for (int i = 0; i < getDimension(); i++)
+        const auto& lattice = point->Lattice;
+        point->Lines.reserve(getDimension());
+
+        for (size_t i = 0; i < getDimension(); i++)
         {
-            auto lineCoordinates = std::vector<double>();
-            for (int j = 0; j < point->Coordinates.size(); j++)
+            const size_t lineHash = getHash(lattice, i);
+            const int lineIndex = linesTables[i].find(lineHash, [&](int j)
             {
-                if (j != i)
+                const auto& lineLattice = Lines[i][j]->getFirstPoint()->Lattice;
+                for (size_t k = 0; k < lattice.size(); k++)
                 {
-                    lineCoordinates.push_back(point->Coordinates[j]);
+                    if (k != i && lineLattice[k] != lattice[k]) return false;
                 }
-            }
+                return true;
+            });
 
-            auto hash = probLibString::doubles2strTrimmed(lineCoordinates);
-            auto line = LinesSet[i][hash];
-            if (line == nullptr)
+            IntegrationLine* line;
+            if (lineIndex == LatticeTable::empty)
             {
-                line = std::make_shared<IntegrationLine>(i, origin[i]);
-                Lines[i].push_back(line);
-                LinesSet[i][hash] = line;
+                linesTables[i].insert(lineHash, static_cast<int>(Lines[i].size()));
+                Lines[i].push_back(std::make_shared<IntegrationLine>(static_cast<int>(i)));
+                line = Lines[i].back().get();
+            }
+            else
+            {
+                line = Lines[i][lineIndex].get();
             }
 
-            line->Add(point);
+            line->Add(point.get());
             point->Lines.push_back(line);
         }
     }
 
-    void IntegrationLine::Add(std::shared_ptr<IntegrationPoint> point)
+    void LatticeTable::insert(size_t hash, int index)
     {
-        pointSides[point.get()] = GetSide(point);
+        // keep the load factor below one half, so that probe sequences remain short
+        if (2 * (count + 1) > slots.size())
+        {
+            rehash(std::max(size_t(16), 2 * slots.size()));
+        }
 
-        for (int i = 0; i < Points.size(); i++)
+        const size_t mask = slots.size() - 1;
+        size_t i = hash & mask;
+        while (slots[i] != empty)
         {
-            if (Points[i]->Coordinates[getDimension()] > point->Coordinates[getDimension()])
-            {
-                Points.insert(Points.begin()+ i, point);
-                return;
-            }
+            i = (i + 1) & mask;
         }
 
-        Points.push_back(point);
+        slots[i] = index;
+        hashes[i] = hash;
+        count++;
     }
 
-    int IntegrationLine::GetSide(std::shared_ptr<IntegrationPoint> point) const
+    void LatticeTable::rehash(size_t capacity)
     {
-        constexpr double tolerance = 1E-10;
+        std::vector<int> oldSlots = std::move(slots);
+        std::vector<size_t> oldHashes = std::move(hashes);
 
-        if (NumericSupport::areEqual(point->Coordinates[getDimension()], Origin, tolerance))
-        {
-            return 0;
-        }
-        else
+        slots.assign(capacity, empty);
+        hashes.assign(capacity, 0);
+
+        const size_t mask = capacity - 1;
+        for (size_t j = 0; j < oldSlots.size(); j++)
         {
-            auto diffCoordinates = (point->Coordinates[getDimension()] - Origin);
-            if (diffCoordinates > 0) return 1;
-            if (diffCoordinates < 0) return -1;
-            return 0;
+            if (oldSlots[j] != empty)
+            {
+                size_t i = oldHashes[j] & mask;
+                while (slots[i] != empty)
+                {
+                    i = (i + 1) & mask;
+                }
+                slots[i] = oldSlots[j];
+                hashes[i] = oldHashes[j];
+            }
         }
     }
 
-    std::shared_ptr<IntegrationPoint> IntegrationCell::getCenterPoint() const
+    void IntegrationLine::Add(IntegrationPoint* point)
+    {
+        const LatticeIndex position = point->Lattice[getDimension()];
+        auto it = std::upper_bound(Points.begin(), Points.end(), position,
+            [](LatticeIndex value, const LinePoint& linePoint) { return value < linePoint.Position; });
+
+        Points.insert(it, { position, point });
+    }
+
+    int IntegrationLine::GetSide(const IntegrationPoint* point) const
+    {
+        const LatticeIndex position = point->Lattice[getDimension()];
+        if (position > IntegrationDomain::originIndex) return 1;
+        if (position < IntegrationDomain::originIndex) return -1;
+        return 0;
+    }
+
+    IntegrationPoint* IntegrationCell::getCenterPoint() const
     {
         std::vector<double> coordinates(domain.getDimension());
-        for (int i = 0; i < domain.getDimension(); i++)
+        std::vector<LatticeIndex> lattice(domain.getDimension());
+        for (size_t i = 0; i < domain.getDimension(); i++)
         {
+            if (std::abs(upperLattice[i] - lowerLattice[i]) < 2)
+            {
+                throw probLibException("maximum bisection level of the integration lattice exceeded");
+            }
+
             coordinates[i] = (lowerBoundaries[i] + upperBoundaries[i]) / 2;
+            lattice[i] = (lowerLattice[i] + upperLattice[i]) / 2;
         }
 
-        auto centerPoint = domain.GetIntegrationPoint(coordinates);
-
-        return centerPoint;
+        return domain.GetIntegrationPoint(coordinates, lattice);
     }
 
-    std::shared_ptr<IntegrationPoint> IntegrationLine::GetPreviousKnownPoint(IntegrationPoint* point)
+    IntegrationPoint* IntegrationLine::GetPreviousKnownPoint(const IntegrationPoint* point) const
     {
         auto index = get_index(point);
         if (index > 0 && index < Points.size() - 1)
         {
-            for (int i = index - 1; i >= 0; i--)
+            for (int i = static_cast<int>(index) - 1; i >= 0; i--)
             {
-                if (Points[i]->isKnown())
+                if (Points[i].Point->isKnown())
                 {
-                    return Points[i];
+                    return Points[i].Point;
                 }
             }
         }
@@ -465,16 +514,16 @@ namespace Deltares::Reliability
         return nullptr;
     }
 
-    std::shared_ptr<IntegrationPoint> IntegrationLine::GetNextKnownPoint(IntegrationPoint* point)
+    IntegrationPoint* IntegrationLine::GetNextKnownPoint(const IntegrationPoint* point) const
     {
         auto index = get_index(point);
         if (index > 0 && index < Points.size() - 1)
         {
-            for (int i = index + 1; i < Points.size(); i++)
+            for (size_t i = index + 1; i < Points.size(); i++)
             {
-                if (Points[i]->isKnown())
+                if (Points[i].Point->isKnown())
                 {
-                    return Points[i];
+                    return Points[i].Point;
                 }
             }
         }
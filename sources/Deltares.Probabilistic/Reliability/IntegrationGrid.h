@@ -21,9 +21,9 @@
 //
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <vector>
-#include <string>
-#include <unordered_map>
 #include "ReliabilityMethod.h"
 #include "NumericalBisectionSettings.h"
 #include "../Math/NumericSupport.h"
@@ -35,35 +35,102 @@ namespace Deltares::Reliability
     class IntegrationCell;
     class IntegrationLine;
 
+    /**
+     * \brief Position of a coordinate on the integration lattice in one dimension
+     * \remark A coordinate with index k at bisection level l is stored as k * 2^(maxLevel - l), so that
+     *         coordinates of all levels can be compared and hashed as plain integers
+     */
+    using LatticeIndex = int64_t;
+
+    /**
+     * \brief Open addressing hash table, which maps a hash to an index in an external list of items
+     * \remark The keys themselves are not stored, the caller compares the items of which the hashes match
+     */
+    class LatticeTable
+    {
+    public:
+        static constexpr int empty = -1;
+
+        /**
+         * \brief Finds the index of the item with a given hash which matches a comparison function
+         * \param hash Hash of the key
+         * \param equals Function which indicates whether the item with a given index has the key
+         * \return Index of the item, or empty if not found
+         */
+        template <class Equals>
+        int find(size_t hash, Equals equals) const
+        {
+            if (slots.empty()) return empty;
+
+            const size_t mask = slots.size() - 1;
+            for (size_t i = hash & mask; slots[i] != empty; i = (i + 1) & mask)
+            {
+                if (hashes[i] == hash && equals(slots[i]))
+                {
+                    return slots[i];
+                }
+            }
+
+            return empty;
+        }
+
+        /**
+         * \brief Adds an item, which should not be present yet
+         * \param hash Hash of the key of the item
+         * \param index Index of the item
+         */
+        void insert(size_t hash, int index);
+    private:
+        std::vector<int> slots;
+        std::vector<size_t> hashes;
+        size_t count = 0;
+        void rehash(size_t capacity);
+    };
+
     class IntegrationDomain
     {
     public:
         IntegrationDomain(const std::vector<double>& origin);
         std::vector<std::shared_ptr<IntegrationPoint>> Points;
-        std::unordered_map<std::string,std::shared_ptr<IntegrationPoint>> pointsSet;
         std::vector<std::shared_ptr<IntegrationCell>> Cells;
-        std::vector <std::vector<std::shared_ptr<IntegrationLine>>> Lines;
-        std::vector<std::unordered_map<std::string,std::shared_ptr<IntegrationLine>>> LinesSet;
-        std::shared_ptr<IntegrationPoint> GetIntegrationPoint(std::vector<double>& coordinates);
-        void AddPoint(std::shared_ptr<IntegrationPoint> point, const std::string& coordHash);
+        std::vector<std::vector<std::shared_ptr<IntegrationLine>>> Lines;
+        IntegrationPoint* GetIntegrationPoint(const std::vector<double>& coordinates, const std::vector<LatticeIndex>& lattice);
         inline size_t getDimension() const { return origin.size(); }
-        inline std::vector<std::vector<int>> getSplit() const { return split; }
+        inline const std::vector<std::vector<int>>& getSplit() const { return split; }
+        inline const std::vector<double>& getOrigin() const { return origin; }
+
+        /**
+         * \brief Finest bisection level, the lattice index of the boundaries is 0 and 2^maxLevel
+         */
+        static constexpr int maxLevel = 53;
+        static constexpr LatticeIndex lowerIndex = 0;
+        static constexpr LatticeIndex upperIndex = LatticeIndex(1) << maxLevel;
+
+        /**
+         * \brief Lattice index of the origin, which is the first split point in each dimension
+         */
+        static constexpr LatticeIndex originIndex = upperIndex / 2;
     private:
         std::vector<std::vector<int>> split;
         const std::vector<double> origin;
+        LatticeTable pointsTable;
+        std::vector<LatticeTable> linesTables;
+        void AddPoint(std::shared_ptr<IntegrationPoint> point, size_t hash);
+        static size_t getHash(const std::vector<LatticeIndex>& lattice, size_t skipDimension);
     };
 
     class IntegrationPoint
     {
     public:
-        IntegrationPoint(std::vector<double> coord) : Coordinates (coord) {}
+        IntegrationPoint(const std::vector<double>& coord, const std::vector<LatticeIndex>& lattice) : Coordinates(coord), Lattice(lattice) {}
         double ZValue = std::nan("");
         double ProbabilityDensity() const;
         void deriveByExtrapolation();
         void derive();
         std::vector<double> Coordinates;
+        std::vector<LatticeIndex> Lattice;
         inline Numeric::DoubleType getResult() const { return Numeric::NumericSupport::getDoubleType(ZValue); };
-        std::vector<std::shared_ptr<IntegrationLine>> Lines;
+        std::vector<IntegrationLine*> Lines;
         inline void setKnown(const bool b) { Known = b; }
         inline bool isKnown() const { return Known; }
         inline void setZValue(const double z) { ZValue = z; }
@@ -74,46 +141,59 @@ namespace Deltares::Reliability
     class IntegrationCell
     {
     public:
+        /**
+         * \brief Creates a cell which covers the whole domain
+         */
         IntegrationCell(IntegrationDomain& domain, const std::vector<double>& lower_bounds, const std::vector<double>& upper_bounds);
+        IntegrationCell(IntegrationDomain& domain, const std::vector<double>& lower_bounds, const std::vector<double>& upper_bounds,
+            const std::vector<LatticeIndex>& lower_lattice, const std::vector<LatticeIndex>& upper_lattice);
         bool Determined = false;
         bool Known = false;
         double getProbability() const;
         void split();
-        void split(const std::vector<double>& origin);
+        void splitAtOrigin();
         void update();
         Numeric::DoubleType Result = Numeric::DoubleType::NaN;
-        std::vector<std::shared_ptr<IntegrationPoint>> CornerPoints;
-        std::shared_ptr<IntegrationPoint> getCenterPoint() const;
+        std::vector<IntegrationPoint*> CornerPoints;
+        IntegrationPoint* getCenterPoint() const;
     private:
-        size_t get_index() const;
+        void split(const std::vector<double>& coordinates, const std::vector<LatticeIndex>& lattice);
+        size_t index = 0;
         std::vector<double> lowerBoundaries;
         std::vector<double> upperBoundaries;
+        std::vector<LatticeIndex> lowerLattice;
+        std::vector<LatticeIndex> upperLattice;
         std::vector<double> lowerProbabilities;
         std::vector<double> upperProbabilities;
         IntegrationDomain& domain;
         void UpdateCornerPoints();
     };
 
+    /**
+     * \brief Points in the domain which only differ in one dimension, sorted by their lattice index in that dimension
+     */
     class IntegrationLine
     {
     public:
-        IntegrationLine(int dimension, double origin) : Dimension(dimension), Origin(origin) {};
-        std::unordered_map<IntegrationPoint*, int> pointSides = std::unordered_map<IntegrationPoint*, int>();
-        std::vector<std::shared_ptr<IntegrationPoint>> Points;
-        void Add(std::shared_ptr<IntegrationPoint> point);
-        int GetSide(std::shared_ptr<IntegrationPoint> point) const;
-        std::shared_ptr<IntegrationPoint> GetPreviousKnownPoint(IntegrationPoint* p);
-        std::shared_ptr<IntegrationPoint> GetNextKnownPoint(IntegrationPoint* p);
-        bool OnSameSide(IntegrationPoint& p1, IntegrationPoint& p2);
-        bool HasNextKnownPoint(std::shared_ptr<IntegrationPoint> point, const Numeric::DoubleType r);
-        bool HasPreviousKnownPoint(std::shared_ptr<IntegrationPoint> point, const Numeric::DoubleType r);
-        size_t get_index(std::shared_ptr<IntegrationPoint> point);
-        size_t get_index(IntegrationPoint* point);
+        IntegrationLine(int dimension) : Dimension(dimension) {};
+        void Add(IntegrationPoint* point);
+        int GetSide(const IntegrationPoint* point) const;
+        IntegrationPoint* GetPreviousKnownPoint(const IntegrationPoint* p) const;
+        IntegrationPoint* GetNextKnownPoint(const IntegrationPoint* p) const;
+        bool OnSameSide(const IntegrationPoint& p1, const IntegrationPoint& p2) const;
+        bool HasNextKnownPoint(const IntegrationPoint* point, const Numeric::DoubleType r) const;
+        bool HasPreviousKnownPoint(const IntegrationPoint* point, const Numeric::DoubleType r) const;
+        size_t get_index(const IntegrationPoint* point) const;
         inline int getDimension() const { return Dimension; }
+        inline const IntegrationPoint* getFirstPoint() const { return Points.front().Point; }
     private:
+        struct LinePoint
+        {
+            LatticeIndex Position;
+            IntegrationPoint* Point;
+        };
+        std::vector<LinePoint> Points;
         int Dimension;
-        double Origin;
     };
 
 }
-
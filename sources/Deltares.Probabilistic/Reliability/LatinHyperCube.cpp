@@ -78,7 +78,7 @@ namespace Deltares::Reliability
 
         RandomValueGenerator random;
         random.initialize(Settings->randomSettings->IsRepeatableRandom, Settings->randomSettings->Seed,
-                          Settings->randomSettings->getTimeStamp());
+                          Settings->randomSettings->getTimeStamp(), Settings->randomSettings->GeneratorType);
 
         std::vector<std::pair<int, std::vector<double>>> list;
         for (int i = 0; i < Settings->MinimumSamples; i++)
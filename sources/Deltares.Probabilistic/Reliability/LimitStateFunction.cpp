@@ -116,6 +116,28 @@ namespace Deltares::Reliability
         }
     }
 
+    void LimitStateFunction::updateZValues(Models::SampleBatch& batch)
+    {
+        if (!this->useSampleZValue)
+        {
+            for (int i = 0; i < batch.getSize(); i++)
+            {
+                const double* values = this->criticalParameterIndexFromInput ? batch.getXValues(i) : batch.getOutputValues(i);
+                double criticalResultValue = values[this->criticalParameterIndex];
+                double criticalCompareValue = this->criticalValue;
+                if (this->useCompareParameter)
+                {
+                    const double* compareValues = this->compareParameterIndexFromInput ? batch.getXValues(i) : batch.getOutputValues(i);
+                    criticalCompareValue = compareValues[this->compareParameterIndex];
+                }
+
+                batch.Z[i] = this->compareType == CompareType::LessThan
+                    ? criticalResultValue - criticalCompareValue
+                    : criticalCompareValue - criticalResultValue;
+            }
+        }
+    }
+
     CompareType LimitStateFunction::GetCompareType(std::string compare)
     {
         if (compare == "less_than") return CompareType::LessThan;
@@ -42,6 +42,7 @@ namespace Deltares::Reliability
 
         void initialize(std::vector<std::shared_ptr<Models::ModelInputParameter>>& inputParameters, std::vector<std::shared_ptr<Models::ModelInputParameter>>& outputParameters) override;
         void updateZValue(std::shared_ptr<Models::ModelSample> sample) override;
+        void updateZValues(Models::SampleBatch& batch) override;
 
         static CompareType GetCompareType(std::string compare);
         static std::string GetCompareTypeString(CompareType compareType);
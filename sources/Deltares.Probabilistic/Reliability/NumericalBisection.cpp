@@ -174,13 +174,12 @@ namespace Deltares::Reliability
 
     void NumericalBisection::splitUnknownCells(std::shared_ptr<ModelRunner> model, int step, std::vector<std::shared_ptr<IntegrationCell>>& unknownCells) const
     {
-        int nStochasts = model->getVaryingStochastCount();
         if (step == 1)
         {
             // split according to initial values
             for (auto& cell : unknownCells)
             {
-                cell->split(getStartPoint(nStochasts));
+                cell->splitAtOrigin();
             }
         }
         else
@@ -55,6 +55,8 @@ namespace Deltares::Reliability
         void validate(Logging::ValidationReport& report) const override
         {
             Logging::ValidationSupport::checkMinimumInt(report, 1, MaximumIterations, "maximum iterations");
+            // the integration lattice supports 53 bisection levels, of which the origin uses the first one
+            Logging::ValidationSupport::checkMaximumInt(report, 52, MaximumIterations, "maximum iterations");
             runSettings->validate(report);
         }
 
@@ -21,6 +21,7 @@
 //
 #include "NumericalIntegration.h"
 #include "NumericalIntegrationShared.h"
+#include "NumericalIntegrationAdaptiveGrid.h"
 #include "DesignPoint.h"
 #include "DesignPointBuilder.h"
 #include "../Statistics/StandardNormal.h"
@@ -51,6 +52,11 @@ namespace Deltares::Reliability
         // parameter for the position of the origin; necessary to determine the design point
         z0Fac = NumericSupport::GetSign(z);
 
+        if (Settings.GridType == NumericalIntegrationGridType::AdaptiveGrid)
+        {
+            return getAdaptiveGridDesignPoint(z);
+        }
+
         // Numerical integration isn't possible with a large set of stochastic parameters
         // warnings and errors are presented.
         if (nStochasts > 11)
@@ -95,6 +101,24 @@ namespace Deltares::Reliability
         return modelRunner->getDesignPoint(designPoint, beta, convergenceReport);
     }
 
+    std::shared_ptr<DesignPoint> NumericalIntegration::getAdaptiveGridDesignPoint(double z0)
+    {
+        const int nStochasts = modelRunner->getVaryingStochastCount();
+
+        designPointBuilder = DesignPointBuilder(nStochasts, Settings.designPointMethod, Settings.StochastSet);
+
+        auto adaptiveGrid = NumericalIntegrationAdaptiveGrid(Settings, modelRunner);
+        const double probFailure = adaptiveGrid.getProbability(z0, designPointBuilder);
+
+        auto convergenceReport = std::make_shared<ConvergenceReport>();
+
+        const double beta = Statistics::StandardNormal::getUFromQ(probFailure);
+
+        const auto designPoint = designPointBuilder.getSample();
+
+        return modelRunner->getDesignPoint(designPoint, beta, convergenceReport);
+    }
+
     double NumericalIntegration::getStochastProbability(int stochastIndex, Models::Sample& parentSample, double density, double& totalDensity, int nSamples)
     {
         const int nStochasts = Settings.StochastSet->getVaryingStochastCount();
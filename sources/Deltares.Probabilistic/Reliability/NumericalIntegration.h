@@ -36,6 +36,7 @@ namespace Deltares::Reliability
         }
 
     private:
+        std::shared_ptr<DesignPoint> getAdaptiveGridDesignPoint(double z0);
         double getStochastProbability(int stochastIndex, Models::Sample& parentSample, double density, double& totalDensity, int nSamples);
         DesignPointBuilder designPointBuilder = DesignPointBuilder();
         std::shared_ptr<Models::ModelRunner> modelRunner;
@@ -0,0 +1,438 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+#include "NumericalIntegrationAdaptiveGrid.h"
+#include "NumericalIntegrationShared.h"
+#include "ReliabilityReport.h"
+#include "../Statistics/StandardNormal.h"
+#include "../Statistics/ProbabilityIterator.h"
+#include "../Math/NumericSupport.h"
+
+namespace Deltares::Reliability
+{
+    using namespace Deltares::Numeric;
+
+    NumericalIntegrationAdaptiveGrid::NumericalIntegrationAdaptiveGrid(const NumericalIntegrationSettings& settings, std::shared_ptr<Models::ModelRunner> modelRunner)
+        : settings(settings), modelRunner(modelRunner)
+    {
+        nStochasts = settings.StochastSet->getVaryingStochastCount();
+
+        nodeValues.resize(nStochasts);
+        rules.resize(nStochasts);
+        levels.assign(nStochasts, 0);
+
+        for (size_t i = 0; i < nStochasts; i++)
+        {
+            const StochastSettings& stochastSettings = *settings.StochastSet->VaryingStochastSettings[i];
+            const int maxLevel = NumericalIntegrationShared::getMaximumLevel(stochastSettings);
+
+            // midpoints at different levels may coincide, they refer to the same node
+            std::map<double, int> nodeIds;
+
+            for (int level = 0; level <= maxLevel; level++)
+            {
+                const auto uValues = NumericalIntegrationShared::buildUpList(stochastSettings, level);
+
+                // levels which do not add intervals are skipped
+                if (!rules[i].empty() && rules[i].back().Nodes.size() == uValues.size() - 1)
+                {
+                    continue;
+                }
+
+                auto pq = Statistics::ProbabilityIterator(uValues[0]);
+
+                Rule rule;
+                for (size_t j = 0; j < uValues.size() - 1; j++)
+                {
+                    const double u = (uValues[j] + uValues[j + 1]) / 2;
+                    auto [it, inserted] = nodeIds.try_emplace(u, static_cast<int>(nodeValues[i].size()));
+                    if (inserted)
+                    {
+                        nodeValues[i].push_back(u);
+                    }
+
+                    rule.Nodes.push_back(it->second);
+                    rule.Weights.push_back(pq.getDifference(uValues[j + 1]));
+                }
+
+                rules[i].push_back(rule);
+            }
+        }
+    }
+
+    double NumericalIntegrationAdaptiveGrid::getProbability(double z0, DesignPointBuilder& designPointBuilder)
+    {
+        const double z0Fac = NumericSupport::GetSign(z0);
+
+        // the coarsest grid consists of the origin only
+        std::vector<int> originNodes(nStochasts);
+        for (size_t i = 0; i < nStochasts; i++)
+        {
+            originNodes[i] = rules[i][0].Nodes[0];
+        }
+        zValues[originNodes] = z0;
+
+        double probFailure = getGridProbability(levels);
+
+        // change in reliability index of the last trial refinement per stochast
+        std::vector<double> changes(nStochasts, std::numeric_limits<double>::infinity());
+
+        int step = 0;
+        while (getEvaluations() < settings.MaximumSamples && !modelRunner->shouldExitPrematurely(std::vector<std::shared_ptr<Models::Sample>>()))
+        {
+            step++;
+
+            // stochasts which had a small influence in previous steps are only tried again to confirm convergence
+            std::vector<size_t> trialStochasts;
+            for (size_t i = 0; i < nStochasts; i++)
+            {
+                if (levels[i] < static_cast<int>(rules[i].size()) - 1 && changes[i] >= settings.EpsilonBeta)
+                {
+                    trialStochasts.push_back(i);
+                }
+            }
+
+            const bool allStochasts = trialStochasts.empty();
+            if (allStochasts)
+            {
+                for (size_t i = 0; i < nStochasts; i++)
+                {
+                    if (levels[i] < static_cast<int>(rules[i].size()) - 1)
+                    {
+                        trialStochasts.push_back(i);
+                    }
+                }
+            }
+
+            if (trialStochasts.empty())
+            {
+                // all stochasts are at the finest level, which is the full grid
+                break;
+            }
+
+            // trial refinements are only made when their points fit within the maximum number of samples
+            std::vector<std::vector<int>> trialGrids;
+            std::vector<size_t> affordableStochasts;
+            std::set<std::vector<int>> newNodes;
+            for (size_t i : trialStochasts)
+            {
+                std::vector<int> trialLevels = levels;
+                trialLevels[i]++;
+
+                std::vector<std::vector<int>> gridNodes;
+                forEachPoint(trialLevels, [this, &newNodes, &gridNodes](const std::vector<int>& nodes, double)
+                {
+                    if (!zValues.contains(nodes) && !newNodes.contains(nodes))
+                    {
+                        gridNodes.push_back(nodes);
+                    }
+                });
+
+                if (getEvaluations() + newNodes.size() + gridNodes.size() <= static_cast<size_t>(settings.MaximumSamples))
+                {
+                    newNodes.insert(gridNodes.begin(), gridNodes.end());
+                    trialGrids.push_back(trialLevels);
+                    affordableStochasts.push_back(i);
+                }
+            }
+
+            if (trialGrids.empty())
+            {
+                // no refinement fits within the maximum number of samples
+                break;
+            }
+
+            trialStochasts = affordableStochasts;
+
+            evaluate(trialGrids);
+
+            const double beta = Statistics::StandardNormal::getUFromQ(probFailure);
+
+            double maxChange = 0;
+            size_t best = 0;
+            std::vector<double> trialProbabilities(trialGrids.size());
+            for (size_t k = 0; k < trialGrids.size(); k++)
+            {
+                trialProbabilities[k] = getGridProbability(trialGrids[k]);
+
+                const double change = std::abs(Statistics::StandardNormal::getUFromQ(trialProbabilities[k]) - beta);
+                changes[trialStochasts[k]] = change;
+
+                if (change > maxChange)
+                {
+                    maxChange = change;
+                    best = k;
+                }
+            }
+
+            if (maxChange == 0)
+            {
+                // no failure found yet, refine the coarsest stochast
+                for (size_t k = 0; k < trialGrids.size(); k++)
+                {
+                    if (levels[trialStochasts[k]] < levels[trialStochasts[best]]) best = k;
+                }
+            }
+
+            const bool converged = probFailure > 0 && maxChange < settings.EpsilonBeta && getEvaluations() >= settings.MinimumSamples;
+
+            if (!converged)
+            {
+                levels = trialGrids[best];
+                probFailure = trialProbabilities[best];
+
+                // the first refined stochast, which has most influence, is the line direction from now on
+                if (!hasLineIndex)
+                {
+                    lineIndex = trialStochasts[best];
+                    hasLineIndex = true;
+                }
+            }
+
+            auto report = std::make_shared<ReliabilityReport>();
+            report->Step = step;
+            report->MaxSteps = settings.MaximumSamples;
+            report->Reliability = Statistics::StandardNormal::getUFromQ(probFailure);
+            report->ConvBeta = maxChange;
+            modelRunner->reportResult(report);
+
+            if (converged && allStochasts)
+            {
+                break;
+            }
+        }
+
+        // the parts of the lines where the sign of the z-value differs from the origin contribute to the design point
+        forEachLine(levels, [this, z0Fac, &designPointBuilder](const std::vector<int>& nodes, size_t index, double weight, const Rule& rule, const std::vector<double>& lineZValues)
+        {
+            double density = 0;
+            std::vector<std::pair<double, double>> points;
+            getLineProbability(index, rule, lineZValues, z0Fac, density, &points);
+
+            for (const auto& [u, probability] : points)
+            {
+                auto sample = getSample(nodes);
+                sample->Values[index] = u;
+                sample->Weight = weight * probability;
+                designPointBuilder.addSample(sample);
+            }
+        });
+
+        return probFailure;
+    }
+
+    void NumericalIntegrationAdaptiveGrid::evaluate(const std::vector<std::vector<int>>& grids)
+    {
+        // collect the points of all grids, so that they are calculated in one batch
+        std::vector<std::vector<int>> newNodes;
+        std::vector<std::shared_ptr<Models::Sample>> samples;
+
+        for (const auto& gridLevels : grids)
+        {
+            forEachPoint(gridLevels, [this, &newNodes, &samples](const std::vector<int>& nodes, double)
+            {
+                if (!zValues.contains(nodes))
+                {
+                    zValues[nodes] = std::nan("");
+                    newNodes.push_back(nodes);
+                    samples.push_back(getSample(nodes));
+                }
+            });
+        }
+
+        const std::vector<double> z = modelRunner->getZValues(samples);
+        for (size_t j = 0; j < newNodes.size(); j++)
+        {
+            zValues[newNodes[j]] = z[j];
+        }
+    }
+
+    double NumericalIntegrationAdaptiveGrid::getGridProbability(const std::vector<int>& gridLevels) const
+    {
+        double probFailure = 0;
+        double totalDensity = 0;
+
+        forEachLine(gridLevels, [this, &probFailure, &totalDensity](const std::vector<int>&, size_t index, double weight, const Rule& rule, const std::vector<double>& lineZValues)
+        {
+            double lineDensity = 0;
+            const double lineProbability = getLineProbability(index, rule, lineZValues, 1.0, lineDensity, nullptr);
+
+            probFailure += weight * lineProbability;
+            totalDensity += weight * lineDensity;
+        });
+
+        return totalDensity > 0 ? probFailure / totalDensity : 0;
+    }
+
+    void NumericalIntegrationAdaptiveGrid::forEachLine(const std::vector<int>& gridLevels, const LineAction& action) const
+    {
+        // integration along the lines in the line direction, the other directions are iterated
+        const size_t index = hasLineIndex ? lineIndex : std::max_element(gridLevels.begin(), gridLevels.end()) - gridLevels.begin();
+        const Rule& lineRule = rules[index][gridLevels[index]];
+
+        std::vector<int> baseLevels = gridLevels;
+        baseLevels[index] = 0;
+
+        std::vector<int> lineNodes;
+        std::vector<double> lineZValues(lineRule.Nodes.size());
+
+        forEachPoint(baseLevels, [&](const std::vector<int>& nodes, double weight)
+        {
+            lineNodes = nodes;
+            for (size_t j = 0; j < lineRule.Nodes.size(); j++)
+            {
+                lineNodes[index] = lineRule.Nodes[j];
+                lineZValues[j] = zValues.at(lineNodes);
+            }
+
+            action(nodes, index, weight, lineRule, lineZValues);
+        });
+    }
+
+    double NumericalIntegrationAdaptiveGrid::getLineProbability(size_t index, const Rule& rule, const std::vector<double>& lineZValues, double sign,
+        double& density, std::vector<std::pair<double, double>>* points) const
+    {
+        const size_t n = lineZValues.size();
+
+        const bool hasNaN = std::any_of(lineZValues.begin(), lineZValues.end(), [](double z) { return std::isnan(z); });
+
+        if (n == 1 || hasNaN)
+        {
+            // midpoint rule
+            double probability = 0;
+            density = 0;
+            for (size_t j = 0; j < n; j++)
+            {
+                if (!std::isnan(lineZValues[j]))
+                {
+                    density += rule.Weights[j];
+                    if (lineZValues[j] * sign < 0.0)
+                    {
+                        probability += rule.Weights[j];
+                        if (points != nullptr) points->emplace_back(nodeValues[index][rule.Nodes[j]], rule.Weights[j]);
+                    }
+                }
+            }
+            return probability;
+        }
+
+        // the z-value is interpolated linearly between the nodes and is constant beyond the outer nodes
+        density = 1;
+
+        double probability = 0;
+        auto addPart = [&probability, points](double u1, double u2)
+        {
+            const double partProbability = getProbabilityBetween(u1, u2);
+            probability += partProbability;
+
+            if (points != nullptr)
+            {
+                // center of gravity of the part
+                constexpr double normalFactor = 0.3989422804014327;
+                const double u = partProbability > 0
+                    ? normalFactor * (std::exp(-0.5 * u1 * u1) - std::exp(-0.5 * u2 * u2)) / partProbability
+                    : 0.5 * (u1 + u2);
+                points->emplace_back(std::clamp(u, u1, u2), partProbability);
+            }
+        };
+
+        double u = -Statistics::StandardNormal::UMax;
+        bool inside = lineZValues[0] * sign < 0.0;
+
+        for (size_t j = 0; j < n - 1; j++)
+        {
+            const bool nextInside = lineZValues[j + 1] * sign < 0.0;
+            if (nextInside != inside)
+            {
+                const double u1 = nodeValues[index][rule.Nodes[j]];
+                const double u2 = nodeValues[index][rule.Nodes[j + 1]];
+                const double root = u1 + (u2 - u1) * lineZValues[j] / (lineZValues[j] - lineZValues[j + 1]);
+
+                if (inside) addPart(u, root);
+                u = root;
+                inside = nextInside;
+            }
+        }
+
+        if (inside) addPart(u, Statistics::StandardNormal::UMax);
+
+        return probability;
+    }
+
+    double NumericalIntegrationAdaptiveGrid::getProbabilityBetween(double u1, double u2)
+    {
+        // use exceeding probabilities in the upper half to preserve precision in the tails
+        if (u1 >= 0)
+        {
+            return Statistics::StandardNormal::getQFromU(u1) - Statistics::StandardNormal::getQFromU(u2);
+        }
+        else
+        {
+            return Statistics::StandardNormal::getPFromU(u2) - Statistics::StandardNormal::getPFromU(u1);
+        }
+    }
+
+    void NumericalIntegrationAdaptiveGrid::forEachPoint(const std::vector<int>& gridLevels, const std::function<void(const std::vector<int>& nodes, double weight)>& action) const
+    {
+        std::vector<size_t> counters(nStochasts, 0);
+        std::vector<int> nodes(nStochasts);
+
+        while (true)
+        {
+            double weight = 1;
+            for (size_t i = 0; i < nStochasts; i++)
+            {
+                const Rule& rule = rules[i][gridLevels[i]];
+                nodes[i] = rule.Nodes[counters[i]];
+                weight *= rule.Weights[counters[i]];
+            }
+
+            action(nodes, weight);
+
+            size_t i = 0;
+            while (i < nStochasts && ++counters[i] == rules[i][gridLevels[i]].Nodes.size())
+            {
+                counters[i] = 0;
+                i++;
+            }
+
+            if (i == nStochasts)
+            {
+                break;
+            }
+        }
+    }
+
+    std::shared_ptr<Models::Sample> NumericalIntegrationAdaptiveGrid::getSample(const std::vector<int>& nodes) const
+    {
+        std::vector<double> values(nStochasts);
+        for (size_t i = 0; i < nStochasts; i++)
+        {
+            values[i] = nodeValues[i][nodes[i]];
+        }
+
+        return std::make_shared<Models::Sample>(values);
+    }
+}
@@ -0,0 +1,92 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+#include "NumericalIntegrationSettings.h"
+#include "DesignPointBuilder.h"
+#include "../Model/ModelRunner.h"
+
+namespace Deltares::Reliability
+{
+    /**
+     * \brief Dimension adaptive numerical integration of the probability of failure
+     * \remark The integration takes place over a tensor grid with a refinement level per stochast, where level l uses the
+     *         midpoints of NumericalIntegrationShared::buildUpList(settings, l). Along the first refined stochast the limit state
+     *         is located by linear interpolation of the z-values, the other stochasts use the midpoint rule. Starting with the origin only, in each step
+     *         the stochast is refined which changes the reliability index most. Stochasts with a small influence remain coarse,
+     *         so that the number of model runs depends on the number of influential stochasts rather than on the total number.
+     *         The points of all trial refinements in a step are evaluated in one batch.
+     */
+    class NumericalIntegrationAdaptiveGrid
+    {
+    public:
+        NumericalIntegrationAdaptiveGrid(const NumericalIntegrationSettings& settings, std::shared_ptr<Models::ModelRunner> modelRunner);
+
+        /**
+         * \brief Calculates the probability of failure
+         * \param z0 Z-value in the origin
+         * \param designPointBuilder Builder to which the samples for the design point are added
+         * \return Probability of failure
+         */
+        double getProbability(double z0, DesignPointBuilder& designPointBuilder);
+
+        /**
+         * \brief Gets the number of evaluated grid points
+         */
+        int getEvaluations() const { return static_cast<int>(zValues.size()); }
+
+    private:
+        /**
+         * \brief Midpoint rule in one dimension, refers to the node values per dimension
+         */
+        struct Rule
+        {
+            std::vector<int> Nodes;
+            std::vector<double> Weights;
+        };
+
+        const NumericalIntegrationSettings& settings;
+        std::shared_ptr<Models::ModelRunner> modelRunner;
+        size_t nStochasts = 0;
+
+        std::vector<std::vector<double>> nodeValues;
+        std::vector<std::vector<Rule>> rules;
+        std::vector<int> levels;
+        size_t lineIndex = 0;
+        bool hasLineIndex = false;
+        std::map<std::vector<int>, double> zValues;
+
+        void evaluate(const std::vector<std::vector<int>>& grids);
+        double getGridProbability(const std::vector<int>& gridLevels) const;
+        double getLineProbability(size_t index, const Rule& rule, const std::vector<double>& lineZValues, double sign,
+            double& density, std::vector<std::pair<double, double>>* points) const;
+        static double getProbabilityBetween(double u1, double u2);
+        using LineAction = std::function<void(const std::vector<int>& nodes, size_t index, double weight, const Rule& rule, const std::vector<double>& lineZValues)>;
+        void forEachLine(const std::vector<int>& gridLevels, const LineAction& action) const;
+        void forEachPoint(const std::vector<int>& gridLevels, const std::function<void(const std::vector<int>& nodes, double weight)>& action) const;
+        std::shared_ptr<Models::Sample> getSample(const std::vector<int>& nodes) const;
+    };
+}
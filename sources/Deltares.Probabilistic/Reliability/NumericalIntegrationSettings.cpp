@@ -20,3 +20,24 @@
 // All rights reserved.
 //
 #include "NumericalIntegrationSettings.h"
+#include "../Utils/probLibException.h"
+
+namespace Deltares::Reliability
+{
+    std::string NumericalIntegrationSettings::getGridTypeString(NumericalIntegrationGridType gridType)
+    {
+        switch (gridType)
+        {
+        case NumericalIntegrationGridType::FullGrid: return "full_grid";
+        case NumericalIntegrationGridType::AdaptiveGrid: return "adaptive_grid";
+        default: throw probLibException("Grid type");
+        }
+    }
+
+    NumericalIntegrationGridType NumericalIntegrationSettings::getGridType(std::string gridType)
+    {
+        if (gridType == "full_grid") return NumericalIntegrationGridType::FullGrid;
+        else if (gridType == "adaptive_grid") return NumericalIntegrationGridType::AdaptiveGrid;
+        else throw probLibException("Grid type");
+    }
+}
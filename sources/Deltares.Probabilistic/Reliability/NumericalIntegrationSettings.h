@@ -25,6 +25,22 @@
 
 namespace Deltares::Reliability
 {
+    /**
+     * \brief Grid over which the numerical integration takes place
+     */
+    enum class NumericalIntegrationGridType
+    {
+        /**
+         * \brief Tensor grid of all intervals of all stochastic variables
+         */
+        FullGrid,
+
+        /**
+         * \brief Grid with a refinement level per stochastic variable, refined for the variables which have most influence on the reliability index
+         */
+        AdaptiveGrid
+    };
+
     /**
      * \brief Settings for numerical integration
      */
@@ -36,6 +52,27 @@ namespace Deltares::Reliability
          */
         DesignPointMethod designPointMethod = DesignPointMethod::CenterOfGravity;
 
+        /**
+         * \brief Grid over which the integration takes place
+         */
+        NumericalIntegrationGridType GridType = NumericalIntegrationGridType::FullGrid;
+
+        /**
+         * \brief Minimum number of model evaluations in the adaptive grid
+         */
+        int MinimumSamples = 1000;
+
+        /**
+         * \brief Maximum number of model evaluations in the adaptive grid
+         * \remark Refinements which would exceed this number are not made
+         */
+        int MaximumSamples = 10000;
+
+        /**
+         * \brief The adaptive grid is refined until the change in the reliability index is less than this value
+         */
+        double EpsilonBeta = 0.01;
+
         /**
          * \brief Settings per stochastic variable, contains (among others) the center value and multiplication factor used to shift samples in the importance sampling algorithm
          */
@@ -53,9 +90,20 @@ namespace Deltares::Reliability
         void validate(Logging::ValidationReport& report) const override
         {
             validateStochastSet(report);
+
+            if (GridType == NumericalIntegrationGridType::AdaptiveGrid)
+            {
+                Logging::ValidationSupport::checkMinimumInt(report, 1, MinimumSamples, "minimum samples");
+                Logging::ValidationSupport::checkMinimumInt(report, MinimumSamples, MaximumSamples, "maximum samples");
+                Logging::ValidationSupport::checkMinimumNonInclusive(report, 0, EpsilonBeta, "epsilon beta");
+            }
+
             runSettings->validate(report);
         }
 
+        static std::string getGridTypeString(NumericalIntegrationGridType gridType);
+        static NumericalIntegrationGridType getGridType(std::string gridType);
+
     private:
         /**
          * \brief Indicates whether all stochast settings have valid values
@@ -20,6 +20,7 @@
 // All rights reserved.
 //
 
+#include <algorithm>
 #include "NumericalIntegrationShared.h"
 #include "../Statistics/StandardNormal.h"
 
@@ -27,14 +28,44 @@ using namespace Deltares::Statistics;
 
 namespace Deltares::Reliability
 {
-    std::vector<double> NumericalIntegrationShared:: buildUpList(const StochastSettings& varying_stochast_settings)
+    std::vector<double> NumericalIntegrationShared::buildUpList(const StochastSettings& varying_stochast_settings)
+    {
+        return buildUpList(varying_stochast_settings.MinValue, varying_stochast_settings.MaxValue, varying_stochast_settings.Intervals);
+    }
+
+    std::vector<double> NumericalIntegrationShared::buildUpList(const StochastSettings& varying_stochast_settings, int level)
+    {
+        if (level == 0)
+        {
+            return { -StandardNormal::UMax, StandardNormal::UMax };
+        }
+
+        // the number of intervals doubles with each level, until the number of intervals in the settings is reached
+        int nr_intervals = 1;
+        for (int i = 1; i < level && nr_intervals < varying_stochast_settings.Intervals; i++)
+        {
+            nr_intervals *= 2;
+        }
+        nr_intervals = std::min(nr_intervals, varying_stochast_settings.Intervals);
+
+        return buildUpList(varying_stochast_settings.MinValue, varying_stochast_settings.MaxValue, nr_intervals);
+    }
+
+    int NumericalIntegrationShared::getMaximumLevel(const StochastSettings& varying_stochast_settings)
+    {
+        int level = 1;
+        for (int nr_intervals = 1; nr_intervals < varying_stochast_settings.Intervals; nr_intervals *= 2)
+        {
+            level++;
+        }
+        return level;
+    }
+
+    std::vector<double> NumericalIntegrationShared::buildUpList(const double u_min, const double u_max, const int nr_intervals)
     {
         constexpr double u_delta = 0.01;
 
         // Initialize parameters for stochastic parameter u.
-        const int nr_intervals = varying_stochast_settings.Intervals; // number of intervals in u-space as integer
-        const double u_min = varying_stochast_settings.MinValue; // lower bound for u
-        const double u_max = varying_stochast_settings.MaxValue; // upper bound for u
         const double range_u = u_max - u_min;
 
         // Build up list of u values to be computed
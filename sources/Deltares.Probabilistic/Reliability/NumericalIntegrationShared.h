@@ -38,6 +38,23 @@ namespace Deltares::Reliability
          * \return The u-values
          */
         static std::vector<double> buildUpList(const StochastSettings& varying_stochast_settings);
+
+        /**
+         * \brief Get the list with u-values at a refinement level of the adaptive grid
+         * \param varying_stochast_settings settings with ranges for a certain stochast
+         * \param level refinement level, level 0 consists of one interval and at the maximum level the list equals the full list
+         * \return The u-values
+         */
+        static std::vector<double> buildUpList(const StochastSettings& varying_stochast_settings, int level);
+
+        /**
+         * \brief Get the refinement level at which the list of u-values equals the full list
+         * \param varying_stochast_settings settings with ranges for a certain stochast
+         * \return The maximum level
+         */
+        static int getMaximumLevel(const StochastSettings& varying_stochast_settings);
+    private:
+        static std::vector<double> buildUpList(double u_min, double u_max, int nr_intervals);
     };
 }
 
@@ -30,19 +30,25 @@ namespace Deltares::Reliability
     PrecomputeDirections::PrecomputeDirections(const DirectionReliabilitySettings& settings, const double z0) :
         settings(settings), z0(z0) {}
 
+    // copy z-value zero sample
+    void PrecomputeDirections::provideOrigin(const std::vector<DirectionReliabilityDS>& directions) const
+    {
+        const auto z0pv = PrecomputedDirectionValue(0.0, std::abs(z0), false, true);
+        for (const auto& direction : directions)
+        {
+            direction.ProvidePrecomputeValue(z0pv);
+        }
+    }
+
     // precompute Z-values
     void PrecomputeDirections::precompute(Models::ModelRunner& modelRunner,
         const std::vector<DirectionReliabilityDS>& directions, std::vector<bool>& shouldCompute)
     {
         const size_t nSamples = directions.size();
 
-        // copy z-value zero sample
-        const auto z0pv = PrecomputedDirectionValue(0.0, std::abs(z0), false, true);
+        provideOrigin(directions);
+
         const double z0Fac = ReliabilityMethod::getZFactor(z0);
-        for (const auto& direction : directions)
-        {
-            direction.ProvidePrecomputeValue(z0pv);
-        }
 
         // precompute Z-values multiples of Dsdu
         const int sectionsCount = settings.SectionCount();
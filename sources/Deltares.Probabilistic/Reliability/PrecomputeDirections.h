@@ -32,6 +32,7 @@ namespace Deltares::Reliability
         PrecomputeDirections(const DirectionReliabilitySettings& settings, const double z0);
         void precompute(Models::ModelRunner& modelRunner,
             const std::vector<DirectionReliabilityDS>& directions, std::vector<bool>& shouldCompute);
+        void provideOrigin(const std::vector<DirectionReliabilityDS>& directions) const;
         size_t GetCounter() const {return Counter;}
     private:
         size_t Counter = 0;
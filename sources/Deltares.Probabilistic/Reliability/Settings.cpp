@@ -76,6 +76,10 @@ namespace Deltares::Reliability
         numericalIntegration->Settings.designPointMethod = this->designPointMethod;
         numericalIntegration->Settings.runSettings = this->RunSettings;
         numericalIntegration->Settings.StochastSet = this->StochastSet;
+        numericalIntegration->Settings.GridType = this->IntegrationGridType;
+        numericalIntegration->Settings.MinimumSamples = this->MinimumSamples;
+        numericalIntegration->Settings.MaximumSamples = this->MaximumSamples;
+        numericalIntegration->Settings.EpsilonBeta = this->EpsilonBeta;
 
         return numericalIntegration;
     }
@@ -136,6 +140,7 @@ namespace Deltares::Reliability
         fdir->formSettings->StartPointSettings = this->StartPointSettings;
         fdir->DsSettings->MinimumDirections = this->MinimumDirections;
         fdir->DsSettings->MaximumDirections = this->MaximumDirections;
+        fdir->DsSettings->DirectionsPerThread = this->DirectionsPerThread;
         fdir->DsSettings->designPointMethod = this->designPointMethod;
         fdir->DsSettings->VariationCoefficient = this->VariationCoefficient;
         fdir->DsSettings->runSettings = this->RunSettings;
@@ -163,6 +168,7 @@ namespace Deltares::Reliability
         dsfi->formSettings->StartPointSettings = this->StartPointSettings;
         dsfi->DsSettings->MinimumDirections = this->MinimumDirections;
         dsfi->DsSettings->MaximumDirections = this->MaximumDirections;
+        dsfi->DsSettings->DirectionsPerThread = this->DirectionsPerThread;
         dsfi->DsSettings->designPointMethod = this->designPointMethod;
         dsfi->DsSettings->VariationCoefficient = this->VariationCoefficient;
         dsfi->DsSettings->runSettings = this->RunSettings;
@@ -235,6 +241,8 @@ namespace Deltares::Reliability
         adaptiveImportanceSampling->Settings->Clustering = this->Clustering;
         adaptiveImportanceSampling->Settings->clusterSettings->MaxClusters = this->MaxClusters;
         adaptiveImportanceSampling->Settings->clusterSettings->OptimizeNumberOfClusters = this->OptimizeNumberOfClusters;
+        adaptiveImportanceSampling->Settings->importanceSamplingSettings->ClusterAllocation = this->ClusterAllocation;
+        adaptiveImportanceSampling->Settings->importanceSamplingSettings->DefensiveFraction = this->DefensiveFraction;
 
         return adaptiveImportanceSampling;
     }
@@ -245,6 +253,7 @@ namespace Deltares::Reliability
 
         directionalSampling->Settings->MinimumDirections = this->MinimumDirections;
         directionalSampling->Settings->MaximumDirections = this->MaximumDirections;
+        directionalSampling->Settings->DirectionsPerThread = this->DirectionsPerThread;
         directionalSampling->Settings->designPointMethod = this->designPointMethod;
         directionalSampling->Settings->VariationCoefficient = this->VariationCoefficient;
         directionalSampling->Settings->runSettings = this->RunSettings;
@@ -275,6 +284,7 @@ namespace Deltares::Reliability
         subsetSimulation->Settings->SampleMethod = this->sampleMethod;
         subsetSimulation->Settings->VariationCoefficient = this->VariationCoefficient;
         subsetSimulation->Settings->MarkovChainDeviation = this->MarkovChainDeviation;
+        subsetSimulation->Settings->ParallelChains = this->ParallelChains;
         subsetSimulation->Settings->RunSettings = this->RunSettings;
         subsetSimulation->Settings->randomSettings = this->RandomSettings;
         subsetSimulation->Settings->StochastSet = this->StochastSet;
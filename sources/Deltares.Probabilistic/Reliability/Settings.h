@@ -108,6 +108,11 @@ namespace Deltares::Reliability
          */
         int MaximumDirections = 10000;
 
+        /**
+         * \brief Indicates whether each thread calculates whole directions in directional sampling
+         */
+        bool DirectionsPerThread = false;
+
         /**
          * \brief The minimum directions to be examined
          */
@@ -214,6 +219,11 @@ namespace Deltares::Reliability
          */
         double MarkovChainDeviation = 1;
 
+        /**
+         * \brief Indicates whether all Markov chains in subset simulation advance simultaneously, so that model runs are batched
+         */
+        bool ParallelChains = false;
+
         /**
          * \brief Fraction of the samples which will be used in the next iteration
          */
@@ -234,6 +244,21 @@ namespace Deltares::Reliability
          */
         bool OptimizeNumberOfClusters = false;
 
+        /**
+         * \brief Way in which samples are allocated to the clusters in adaptive importance sampling
+         */
+        ClusterAllocationType ClusterAllocation = ClusterAllocationType::Equal;
+
+        /**
+         * \brief Fraction of the samples which is divided equally over the clusters when the allocation is proportional
+         */
+        double DefensiveFraction = 0.1;
+
+        /**
+         * \brief Grid over which numerical integration takes place
+         */
+        NumericalIntegrationGridType IntegrationGridType = NumericalIntegrationGridType::FullGrid;
+
         /**
          * \brief Step size in fragility curve integration
          */
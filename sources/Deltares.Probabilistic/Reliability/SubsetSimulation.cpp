@@ -27,7 +27,9 @@
 #include "../Model/RandomSampleGenerator.h"
 
 #include <algorithm>
+#include <limits>
 #include <numbers>
+#include <numeric>
 #include <format>
 
 namespace Deltares::Reliability
@@ -44,6 +46,7 @@ namespace Deltares::Reliability
         auto designPointBuilder = DesignPointBuilder(nStochasts, Settings->designPointMethod, Settings->StochastSet);
         randomSampleGenerator = Models::RandomSampleGenerator(this->Settings->randomSettings, this->Settings->StochastSet);
         randomSampleGenerator.initialize();
+        sampler = Settings->getSampler();
 
         // initialize convergence indicator and loops
         double ssFactor = 1;
@@ -194,6 +197,13 @@ namespace Deltares::Reliability
                 auto message = std::format("Rejected {0:} values, accepted {1:} values ({2:} % rejected) in iteration {3:}",
                     rejectedSamples, acceptedSamples, ratio, iteration);
                 modelRunner->reportMessage(Logging::MessageType::Debug, message);
+
+                if (sampler != nullptr)
+                {
+                    auto samplerMessage = std::format("Sampler {0:} accepted {1:} % of the proposals with {2:} model runs in iteration {3:}",
+                        sampler->getName(), 100 * sampler->getAcceptanceRate(), sampler->getModelRuns(), iteration);
+                    modelRunner->reportMessage(Logging::MessageType::Debug, samplerMessage);
+                }
             }
 
             // select samples for the next round
@@ -231,6 +241,14 @@ namespace Deltares::Reliability
         {
             return getInitialSamples(modelRunner, initial);
         }
+        else if (sampler != nullptr)
+        {
+            return getSamplerSamples(modelRunner, selectedSamples, z0Fac);
+        }
+        else if (Settings->SampleMethod == SampleMethodType::MarkovChain && Settings->ParallelChains)
+        {
+            return getParallelMarkovChainSamples(modelRunner, selectedSamples, z0Fac);
+        }
         else if (Settings->SampleMethod == SampleMethodType::MarkovChain)
         {
             return getMarkovChainSamples(modelRunner, selectedSamples, z0Fac);
@@ -280,42 +298,88 @@ namespace Deltares::Reliability
         return samples;
     }
 
-    std::shared_ptr<Sample> SubsetSimulation::getMarkovChainSample(std::shared_ptr<Sample> oldSample, std::shared_ptr<ModelRunner> modelRunner, double maxZ, double z0Fac)
+    std::vector<std::shared_ptr<Sample>> SubsetSimulation::getParallelMarkovChainSamples(std::shared_ptr<ModelRunner> modelRunner, std::vector<std::shared_ptr<Sample>>& selectedSamples, double z0Fac)
     {
-        constexpr int maxTries = 10;
+        const double maxZ = selectedSamples.back()->Z;
+        const size_t nSeeds = selectedSamples.size();
 
-        int tries = 0;
+        std::vector<Numeric::RandomValueGenerator> generators = getChainGenerators(nSeeds);
 
-        while (tries++ < maxTries)
-        {
-            bool allRejected = true;
+        std::vector<std::shared_ptr<Sample>> samples(this->Settings->MaximumSamples);
 
-            std::vector<double> newValues(oldSample->Values.size());
+        std::vector<int> pendingIndices(this->Settings->MaximumSamples);
+        std::iota(pendingIndices.begin(), pendingIndices.end(), 0);
 
-            for (int i = 0; i < oldSample->Values.size(); i++)
+        // all samples try a new proposal in the same round, so that the proposals can be calculated in one batch
+        for (int tries = 0; tries < maxMarkovChainTries && !pendingIndices.empty(); tries++)
+        {
+            std::vector<std::shared_ptr<Sample>> proposals;
+            std::vector<int> proposalIndices;
+            std::vector<int> rejectedIndices;
+
+            for (int index : pendingIndices)
             {
-                const double random = randomSampleGenerator.random.next();
+                bool allRejected = true;
+                std::shared_ptr<Sample> proposal = getMarkovChainProposal(*selectedSamples[index % nSeeds], generators[index % nSeeds], allRejected);
 
-                const double newValue = oldSample->Values[i] + (2 * random - 1) * Settings->MarkovChainDeviation;
-                const double oldDensity = getStandardNormalPDF(oldSample->Values[i]);
-                const double newDensity = getStandardNormalPDF(newValue);
+                if (allRejected)
+                {
+                    rejectedIndices.push_back(index);
+                }
+                else
+                {
+                    proposals.push_back(proposal);
+                    proposalIndices.push_back(index);
+                }
+            }
 
-                const double acceptanceRatio = std::min(1.0, newDensity / oldDensity);
+            calculateSamples(modelRunner, proposals);
 
-                if (acceptanceRatio > randomSampleGenerator.random.next())
+            for (size_t i = 0; i < proposals.size(); i++)
+            {
+                if (proposals[i]->Z * z0Fac <= maxZ)
                 {
-                    acceptedSamples++;
-                    newValues[i] = newValue;
-                    allRejected = false;
+                    samples[proposalIndices[i]] = proposals[i];
                 }
                 else
                 {
-                    rejectedSamples++;
-                    newValues[i] = oldSample->Values[i];
+                    rejectedIndices.push_back(proposalIndices[i]);
                 }
             }
 
-            std::shared_ptr<Sample> sample = std::make_shared<Sample>(newValues);
+            std::ranges::sort(rejectedIndices);
+            pendingIndices = rejectedIndices;
+        }
+
+        // samples without accepted proposal keep their seed, calculate the seeds again so that evaluations are logged
+        std::vector<bool> isSeedUsed(nSeeds, false);
+        std::vector<std::shared_ptr<Sample>> usedSeeds;
+
+        for (int index : pendingIndices)
+        {
+            samples[index] = selectedSamples[index % nSeeds];
+
+            if (!isSeedUsed[index % nSeeds])
+            {
+                isSeedUsed[index % nSeeds] = true;
+                usedSeeds.push_back(selectedSamples[index % nSeeds]);
+            }
+        }
+
+        calculateSamples(modelRunner, usedSeeds);
+
+        return samples;
+    }
+
+    std::shared_ptr<Sample> SubsetSimulation::getMarkovChainSample(std::shared_ptr<Sample> oldSample, std::shared_ptr<ModelRunner> modelRunner, double maxZ, double z0Fac)
+    {
+        int tries = 0;
+
+        while (tries++ < maxMarkovChainTries)
+        {
+            bool allRejected = true;
+
+            std::shared_ptr<Sample> sample = getMarkovChainProposal(*oldSample, randomSampleGenerator.random, allRejected);
 
             if (!allRejected)
             {
@@ -334,6 +398,83 @@ namespace Deltares::Reliability
         return oldSample;
     }
 
+    std::shared_ptr<Sample> SubsetSimulation::getMarkovChainProposal(const Sample& oldSample, Numeric::RandomValueGenerator& random, bool& allRejected)
+    {
+        allRejected = true;
+
+        std::vector<double> newValues(oldSample.Values.size());
+
+        for (int i = 0; i < oldSample.Values.size(); i++)
+        {
+            const double randomValue = random.next();
+
+            const double newValue = oldSample.Values[i] + (2 * randomValue - 1) * Settings->MarkovChainDeviation;
+            const double oldDensity = getStandardNormalPDF(oldSample.Values[i]);
+            const double newDensity = getStandardNormalPDF(newValue);
+
+            const double acceptanceRatio = std::min(1.0, newDensity / oldDensity);
+
+            if (acceptanceRatio > random.next())
+            {
+                acceptedSamples++;
+                newValues[i] = newValue;
+                allRejected = false;
+            }
+            else
+            {
+                rejectedSamples++;
+                newValues[i] = oldSample.Values[i];
+            }
+        }
+
+        return std::make_shared<Sample>(newValues);
+    }
+
+    std::vector<Numeric::RandomValueGenerator> SubsetSimulation::getChainGenerators(size_t nChains)
+    {
+        std::vector<Numeric::RandomValueGenerator> generators(nChains);
+
+        for (Numeric::RandomValueGenerator& generator : generators)
+        {
+            const int seed = static_cast<int>(randomSampleGenerator.random.next() * std::numeric_limits<int>::max());
+            generator.initialize(true, seed, 0, randomSampleGenerator.Settings->GeneratorType);
+        }
+
+        return generators;
+    }
+
+    void SubsetSimulation::calculateSamples(std::shared_ptr<ModelRunner> modelRunner, const std::vector<std::shared_ptr<Sample>>& samples) const
+    {
+        if (Settings->ParallelChains)
+        {
+            if (!samples.empty())
+            {
+                modelRunner->getZValues(samples);
+            }
+        }
+        else
+        {
+            for (const std::shared_ptr<Sample>& sample : samples)
+            {
+                sample->Z = modelRunner->getZValue(sample);
+            }
+        }
+    }
+
+    std::vector<std::shared_ptr<Sample>> SubsetSimulation::getSamplerSamples(std::shared_ptr<ModelRunner> modelRunner, std::vector<std::shared_ptr<Sample>>& selectedSamples, double z0Fac)
+    {
+        std::vector<Numeric::RandomValueGenerator> generators = getChainGenerators(selectedSamples.size());
+
+        const double threshold = selectedSamples.back()->Z * z0Fac;
+
+        std::vector<std::shared_ptr<Sample>> samples = sampler->getSamples(modelRunner, selectedSamples, Settings->MaximumSamples, threshold, z0Fac, generators);
+
+        acceptedSamples = sampler->getAcceptedSamples();
+        rejectedSamples = sampler->getRejectedSamples();
+
+        return samples;
+    }
+
     std::vector<std::shared_ptr<Sample>> SubsetSimulation::getAdaptiveConditionalSamples(std::shared_ptr<ModelRunner> modelRunner, std::vector<std::shared_ptr<Sample>>& selectedSamples)
     {
         double b = selectedSamples.back()->Z;
@@ -380,94 +521,133 @@ namespace Deltares::Reliability
 
         // b. apply conditional sampling
 
-        for (size_t k = 1; k < nSelectedSamples + 1; k++)
+        // beginning of each chain index
+        std::vector<int> chainStart(nSelectedSamples, 0);
+        for (size_t k = 1; k < nSelectedSamples; k++)
         {
-            int idx = 0;
-            for (size_t j = 0; j < k - 1; j++)
-            {
-                idx += nChain[j];
-            } // beginning of each chain index
+            chainStart[k] = chainStart[k - 1] + nChain[k - 1];
+        }
 
-            std::shared_ptr<Sample> newSample = selectedSamples[k - 1]->clone();
-            newSample->Z = selectedSamples[k - 1]->Z;
+        // parallel chains advance simultaneously within a block, the proposal is adapted after each block
+        std::vector<Numeric::RandomValueGenerator> generators = Settings->ParallelChains ? getChainGenerators(nSelectedSamples) : std::vector<Numeric::RandomValueGenerator>();
+        const size_t blockSize = Settings->ParallelChains ? static_cast<size_t>(nChains) : 1;
 
-            newSamples.push_back(newSample);
+        std::vector<std::shared_ptr<Sample>> previousSamples(nSelectedSamples);
+
+        for (size_t kStart = 1; kStart < nSelectedSamples + 1; kStart += blockSize)
+        {
+            const size_t kEnd = std::min(kStart + blockSize, nSelectedSamples + 1);
 
-            std::shared_ptr<Sample> previousSample = newSample;
+            std::vector<std::vector<std::shared_ptr<Sample>>> chains(kEnd - kStart);
 
-            for (int t = 1; t < nChain[k - 1]; t++)
+            int maxChain = 0;
+            for (size_t k = kStart; k < kEnd; k++)
             {
-                std::vector<double> values(nStochasts);
+                std::shared_ptr<Sample> newSample = selectedSamples[k - 1]->clone();
+                newSample->Z = selectedSamples[k - 1]->Z;
 
-                for (size_t j = 0; j < nStochasts; j++)
-                {
-                    double random = randomSampleGenerator.random.next();
-                    double u = Statistics::StandardNormal::getUFromQ(random);
-                    values[j] = previousSample->Values[j] * rho[j] + sigma[j] * u;
-                }
+                chains[k - kStart].push_back(newSample);
+                previousSamples[k - 1] = newSample;
 
-                std::shared_ptr<Sample> sample = std::make_shared<Sample>(values);
+                maxChain = std::max(maxChain, nChain[k - 1]);
+            }
 
-                sample->Z = modelRunner->getZValue(sample);
+            for (int t = 1; t < maxChain; t++)
+            {
+                std::vector<std::shared_ptr<Sample>> proposals;
+                std::vector<size_t> proposalChains;
 
-                //  accept or reject sample 
-                if (sample->Z <= b)
+                for (size_t k = kStart; k < kEnd; k++)
                 {
-                    acceptance[idx + t] = 1; //  note the acceptance
+                    if (t < nChain[k - 1])
+                    {
+                        Numeric::RandomValueGenerator& random = Settings->ParallelChains ? generators[k - 1] : randomSampleGenerator.random;
+
+                        std::vector<double> values(nStochasts);
+
+                        for (size_t j = 0; j < nStochasts; j++)
+                        {
+                            double u = Statistics::StandardNormal::getUFromQ(random.next());
+                            values[j] = previousSamples[k - 1]->Values[j] * rho[j] + sigma[j] * u;
+                        }
+
+                        proposals.push_back(std::make_shared<Sample>(values));
+                        proposalChains.push_back(k);
+                    }
                 }
-                else
+
+                calculateSamples(modelRunner, proposals);
+
+                for (size_t p = 0; p < proposals.size(); p++)
                 {
-                    sample = previousSample->clone();
-                    sample->Z = previousSample->Z;
+                    const size_t k = proposalChains[p];
+                    std::shared_ptr<Sample> sample = proposals[p];
 
-                    acceptance[idx + t] = 0; // note the rejection
-                }
+                    //  accept or reject sample 
+                    if (sample->Z <= b)
+                    {
+                        acceptance[chainStart[k - 1] + t] = 1; //  note the acceptance
+                    }
+                    else
+                    {
+                        sample = previousSamples[k - 1]->clone();
+                        sample->Z = previousSamples[k - 1]->Z;
 
-                newSamples.push_back(sample);
+                        acceptance[chainStart[k - 1] + t] = 0; // note the rejection
+                    }
 
-                previousSample = sample;
+                    chains[k - kStart].push_back(sample);
+                    previousSamples[k - 1] = sample;
+                }
             } // end of for-t loop
 
-            // average of the accepted samples for each seed 'mu_acc'
-            // here the warning "Mean of empty slice" is not an issue
-
-            double mean = 0.0;
-            for (int j = idx + 1; j < idx + nChain[k - 1]; j++)
+            for (size_t k = kStart; k < kEnd; k++)
             {
-                mean += acceptance[j];
-            }
+                const int idx = chainStart[k - 1];
 
-            mean /= nChain[k - 1];
+                newSamples.insert(newSamples.end(), chains[k - kStart].begin(), chains[k - kStart].end());
 
-            mu_acc[i] += std::min(1.0, mean);
+                // average of the accepted samples for each seed 'mu_acc'
+                // here the warning "Mean of empty slice" is not an issue
 
-            if (k % nChains == 0)
-            {
-                if (nChain[k - 1] > 1)
+                double mean = 0.0;
+                for (int j = idx + 1; j < idx + nChain[k - 1]; j++)
                 {
-                    constexpr double star_a = 0.44; // optimal acceptance rate
-
-                    // c. evaluate average acceptance rate
+                    mean += acceptance[j];
+                }
 
-                    hat_a[i] = mu_acc[i] / static_cast<double>(nChains); // Ref. 1 Eq. 25
+                mean /= nChain[k - 1];
 
-                    // d. compute new scaling parameter
-                    double zeta = 1.0 / std::sqrt(static_cast<double>(i + 1)); //  ensures that the variation of lambda(i) vanishes
-                    lam[i + 1] = std::exp(std::log(lam[i]) + zeta * (hat_a[i] - star_a)); //  Ref. 1 Eq. 26
+                mu_acc[i] += std::min(1.0, mean);
 
-                    // update parameters
-                    for (size_t j = 0; j < nStochasts; j++)
+                if (k % nChains == 0)
+                {
+                    if (nChain[k - 1] > 1)
                     {
-                        sigma[j] = std::min(1.0, lam[i + 1] * sigma_0[j]); //  Ref. 1 Eq. 23
-                        rho[j] = std::sqrt(1.0 - sigma[j] * sigma[j]); //  Ref. 1 Eq. 24
-                    }
+                        constexpr double star_a = 0.44; // optimal acceptance rate
+
+                        // c. evaluate average acceptance rate
+
+                        hat_a[i] = mu_acc[i] / static_cast<double>(nChains); // Ref. 1 Eq. 25
 
-                    // update counter
-                    i++;
+                        // d. compute new scaling parameter
+                        double zeta = 1.0 / std::sqrt(static_cast<double>(i + 1)); //  ensures that the variation of lambda(i) vanishes
+                        lam[i + 1] = std::exp(std::log(lam[i]) + zeta * (hat_a[i] - star_a)); //  Ref. 1 Eq. 26
 
-                } // end if
+                        // update parameters
+                        for (size_t j = 0; j < nStochasts; j++)
+                        {
+                            sigma[j] = std::min(1.0, lam[i + 1] * sigma_0[j]); //  Ref. 1 Eq. 23
+                            rho[j] = std::sqrt(1.0 - sigma[j] * sigma[j]); //  Ref. 1 Eq. 24
+                        }
 
-            } // end if ( k % nChains == 0 )
+                        // update counter
+                        i++;
+
+                    } // end if
+
+                } // end if ( k % nChains == 0 )
+            }
 
         } // end of for-k loop
 
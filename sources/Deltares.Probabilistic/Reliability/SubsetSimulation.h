@@ -43,9 +43,27 @@ namespace Deltares::Reliability
     private:
         std::vector<std::shared_ptr<Models::Sample>> getInitialSamples(std::shared_ptr<Models::ModelRunner> modelRunner, bool initial);
         std::vector<std::shared_ptr<Models::Sample>> getMarkovChainSamples(std::shared_ptr<Models::ModelRunner> modelRunner, std::vector<std::shared_ptr<Models::Sample>>& selectedSamples, double z0Fac);
+        std::vector<std::shared_ptr<Models::Sample>> getParallelMarkovChainSamples(std::shared_ptr<Models::ModelRunner> modelRunner, std::vector<std::shared_ptr<Models::Sample>>& selectedSamples, double z0Fac);
         std::shared_ptr<Models::Sample> getMarkovChainSample(std::shared_ptr<Models::Sample> oldSample, std::shared_ptr<Models::ModelRunner> modelRunner, double maxZ, double z0Fac);
+        std::shared_ptr<Models::Sample> getMarkovChainProposal(const Models::Sample& oldSample, Numeric::RandomValueGenerator& random, bool& allRejected);
+        std::vector<std::shared_ptr<Models::Sample>> getSamplerSamples(std::shared_ptr<Models::ModelRunner> modelRunner, std::vector<std::shared_ptr<Models::Sample>>& selectedSamples, double z0Fac);
         std::vector<std::shared_ptr<Models::Sample>> getAdaptiveConditionalSamples(std::shared_ptr<Models::ModelRunner> modelRunner, std::vector<std::shared_ptr<Models::Sample>>& selectedSamples);
 
+
+        /**
+         * \brief Creates a random value generator per chain, seeded by the random value generator of the algorithm
+         * \param nChains Number of chains
+         * \return Random value generators
+         */
+        std::vector<Numeric::RandomValueGenerator> getChainGenerators(size_t nChains);
+
+        /**
+         * \brief Calculates the z-values of samples, as one batch if chains advance simultaneously
+         * \param modelRunner Model runner
+         * \param samples Samples to be calculated
+         */
+        void calculateSamples(std::shared_ptr<Models::ModelRunner> modelRunner, const std::vector<std::shared_ptr<Models::Sample>>& samples) const;
+
         std::vector<std::shared_ptr<Models::Sample>> getNewSamples(std::shared_ptr<Models::ModelRunner> modelRunner, bool initial, double z0Fac, std::vector<std::shared_ptr<Models::Sample>> selectedSamples);
         std::vector<std::shared_ptr<Models::Sample>> selectSamples(double z0Fac, std::vector<std::shared_ptr<Models::Sample>> performedSamples);
         static double getConvergence(double pf, int samples);
@@ -53,10 +71,13 @@ namespace Deltares::Reliability
 
         double getStandardNormalPDF(double u);
 
+        static constexpr int maxMarkovChainTries = 10;
+
         int rejectedSamples = 0;
         int acceptedSamples = 0;
         double acceptanceRate = 0.0;
         Models::RandomSampleGenerator randomSampleGenerator = Models::RandomSampleGenerator();
+        std::shared_ptr<SubsetSimulationSampler> sampler = nullptr;
     };
 }
 
@@ -0,0 +1,184 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "SubsetSimulationSampler.h"
+#include "../Math/NumericSupport.h"
+#include "../Statistics/StandardNormal.h"
+
+#include <cmath>
+
+namespace Deltares::Reliability
+{
+    using namespace Deltares::Models;
+
+    std::vector<std::shared_ptr<Sample>> SubsetSimulationSampler::getSamples(std::shared_ptr<ModelRunner> modelRunner, const std::vector<std::shared_ptr<Sample>>& seeds,
+        int nSamples, double threshold, double z0Fac, std::vector<Numeric::RandomValueGenerator>& generators)
+    {
+        this->threshold = threshold;
+        this->z0Fac = z0Fac;
+        this->acceptedSamples = 0;
+        this->rejectedSamples = 0;
+        this->modelRuns = 0;
+
+        const size_t nChains = seeds.size();
+
+        // number of steps per chain, the seed itself is not part of the samples
+        std::vector<int> chainLengths(nChains, nSamples / static_cast<int>(nChains));
+        for (size_t k = 0; k < nSamples % nChains; k++)
+        {
+            chainLengths[k]++;
+        }
+
+        std::vector<std::vector<std::shared_ptr<Sample>>> chains(nChains);
+        std::vector<std::shared_ptr<Sample>> states(nChains);
+
+        for (size_t k = 0; k < nChains; k++)
+        {
+            states[k] = seeds[k]->clone();
+            states[k]->Z = seeds[k]->Z;
+        }
+
+        initializeLevel(*modelRunner, states);
+
+        for (int t = 0; t < chainLengths[0]; t++)
+        {
+            std::vector<int> activeChains;
+            std::vector<std::shared_ptr<Sample>> activeStates;
+
+            for (size_t k = 0; k < nChains; k++)
+            {
+                if (t < chainLengths[k])
+                {
+                    activeChains.push_back(static_cast<int>(k));
+                    activeStates.push_back(states[k]);
+                }
+            }
+
+            std::vector<std::shared_ptr<Sample>> newStates = step(*modelRunner, activeChains, activeStates, generators);
+
+            int accepted = 0;
+            for (size_t i = 0; i < activeChains.size(); i++)
+            {
+                std::shared_ptr<Sample> sample = newStates[i];
+
+                if (sample != activeStates[i])
+                {
+                    accepted++;
+                }
+                else
+                {
+                    sample = activeStates[i]->clone();
+                    sample->Z = activeStates[i]->Z;
+                }
+
+                chains[activeChains[i]].push_back(sample);
+                states[activeChains[i]] = sample;
+            }
+
+            acceptedSamples += accepted;
+            rejectedSamples += static_cast<int>(activeChains.size()) - accepted;
+
+            adapt(Numeric::NumericSupport::Divide(accepted, static_cast<int>(activeChains.size())), t);
+        }
+
+        // samples are ordered by step, so that each part of the samples is spread over all chains
+        std::vector<std::shared_ptr<Sample>> samples;
+        for (int t = 0; t < chainLengths[0]; t++)
+        {
+            for (size_t k = 0; k < nChains; k++)
+            {
+                if (t < chainLengths[k])
+                {
+                    samples.push_back(chains[k][t]);
+                }
+            }
+        }
+
+        return samples;
+    }
+
+    double SubsetSimulationSampler::getAcceptanceRate() const
+    {
+        return Numeric::NumericSupport::Divide(acceptedSamples, acceptedSamples + rejectedSamples);
+    }
+
+    void SubsetSimulationSampler::calculateSamples(ModelRunner& modelRunner, const std::vector<std::shared_ptr<Sample>>& samples)
+    {
+        if (!samples.empty())
+        {
+            modelRunner.getZValues(samples);
+            modelRuns += static_cast<int>(samples.size());
+        }
+    }
+
+    bool SubsetSimulationSampler::isInFailureDomain(const Sample& sample) const
+    {
+        return getScaledZ(sample) <= threshold;
+    }
+
+    double SubsetSimulationSampler::getLogDensity(const std::vector<double>& values)
+    {
+        return -0.5 * Numeric::NumericSupport::GetSquaredSum(values);
+    }
+
+    std::vector<double> SubsetSimulationSampler::getStandardDeviations(const std::vector<std::shared_ptr<Sample>>& samples)
+    {
+        const size_t nStochasts = samples.empty() ? 0 : samples[0]->Values.size();
+
+        std::vector<double> deviations(nStochasts, 1.0);
+
+        if (samples.size() > 1)
+        {
+            for (size_t j = 0; j < nStochasts; j++)
+            {
+                double sum = 0;
+                double sumSquared = 0;
+                for (const std::shared_ptr<Sample>& sample : samples)
+                {
+                    sum += sample->Values[j];
+                    sumSquared += sample->Values[j] * sample->Values[j];
+                }
+
+                const double n = static_cast<double>(samples.size());
+                const double variance = (sumSquared - sum * sum / n) / (n - 1);
+
+                if (variance > 0)
+                {
+                    deviations[j] = std::sqrt(variance);
+                }
+            }
+        }
+
+        return deviations;
+    }
+
+    double SubsetSimulationSampler::getAdaptedScale(double scale, double acceptanceRate, double targetAcceptanceRate, int stepIndex)
+    {
+        const double zeta = 1.0 / std::sqrt(static_cast<double>(stepIndex + 1));
+        return std::exp(std::log(scale) + zeta * (acceptanceRate - targetAcceptanceRate));
+    }
+
+    double SubsetSimulationSampler::getStandardNormalValue(Numeric::RandomValueGenerator& generator)
+    {
+        return Statistics::StandardNormal::getUFromQ(generator.next());
+    }
+}
+
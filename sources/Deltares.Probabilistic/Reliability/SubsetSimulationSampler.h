@@ -0,0 +1,162 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../Math/RandomValueGenerator.h"
+#include "../Model/ModelRunner.h"
+#include "../Model/Sample.h"
+
+namespace Deltares::Reliability
+{
+    /**
+     * \brief Base class for kernels which generate the samples of a subset simulation level from the seeds of the previous level
+     * \remark Each seed starts a Markov chain. All chains advance simultaneously, so that the proposals of all chains are calculated in one batch.
+     */
+    class SubsetSimulationSampler
+    {
+    public:
+        virtual ~SubsetSimulationSampler() = default;
+
+        /**
+         * \brief Generates samples in the failure domain of the current level
+         * \param modelRunner Model runner
+         * \param seeds Samples in the failure domain of the current level, their z-values are known
+         * \param nSamples Number of samples to be generated, the seeds are not included
+         * \param threshold Largest z-value (multiplied by z0Fac) in the failure domain of the current level
+         * \param z0Fac Multiplication factor for z-values
+         * \param generators Random value generator per seed
+         * \return Generated samples ordered by step, their z-values are known
+         */
+        std::vector<std::shared_ptr<Models::Sample>> getSamples(std::shared_ptr<Models::ModelRunner> modelRunner, const std::vector<std::shared_ptr<Models::Sample>>& seeds,
+            int nSamples, double threshold, double z0Fac, std::vector<Numeric::RandomValueGenerator>& generators);
+
+        /**
+         * \brief Gets the name of the kernel, used in reporting
+         */
+        virtual std::string getName() const = 0;
+
+        /**
+         * \brief Gets the number of accepted proposals in the last level
+         */
+        int getAcceptedSamples() const { return acceptedSamples; }
+
+        /**
+         * \brief Gets the number of rejected proposals in the last level
+         */
+        int getRejectedSamples() const { return rejectedSamples; }
+
+        /**
+         * \brief Gets the number of model runs in the last level
+         */
+        int getModelRuns() const { return modelRuns; }
+
+        /**
+         * \brief Gets the fraction of accepted proposals in the last level
+         */
+        double getAcceptanceRate() const;
+
+    protected:
+        /**
+         * \brief Prepares the kernel for a new level
+         * \param modelRunner Model runner
+         * \param seeds Start samples of the chains
+         */
+        virtual void initializeLevel(Models::ModelRunner& modelRunner, const std::vector<std::shared_ptr<Models::Sample>>& seeds) {}
+
+        /**
+         * \brief Performs one step of a number of chains
+         * \param modelRunner Model runner
+         * \param chains Indices of the chains which perform a step
+         * \param states Current samples of these chains
+         * \param generators Random value generator per chain
+         * \return New samples of these chains, the current sample if the proposal is rejected
+         */
+        virtual std::vector<std::shared_ptr<Models::Sample>> step(Models::ModelRunner& modelRunner, const std::vector<int>& chains,
+            const std::vector<std::shared_ptr<Models::Sample>>& states, std::vector<Numeric::RandomValueGenerator>& generators) = 0;
+
+        /**
+         * \brief Adapts the proposal after each step
+         * \param acceptanceRate Fraction of accepted proposals in the last step
+         * \param stepIndex Index of the last step in the current level
+         */
+        virtual void adapt(double acceptanceRate, int stepIndex) {}
+
+        /**
+         * \brief Calculates the z-values of samples in one batch
+         */
+        void calculateSamples(Models::ModelRunner& modelRunner, const std::vector<std::shared_ptr<Models::Sample>>& samples);
+
+        /**
+         * \brief Indicates whether a calculated sample is in the failure domain of the current level
+         */
+        bool isInFailureDomain(const Models::Sample& sample) const;
+
+        /**
+         * \brief Gets the z-value multiplied by z0Fac
+         */
+        double getScaledZ(const Models::Sample& sample) const { return sample.Z * z0Fac; }
+
+        /**
+         * \brief Gets the multiplication factor for z-values
+         */
+        double getZMultiplier() const { return z0Fac; }
+
+        /**
+         * \brief Gets the largest z-value (multiplied by z0Fac) in the failure domain of the current level
+         */
+        double getThreshold() const { return threshold; }
+
+        /**
+         * \brief Gets the logarithm of the standard normal density, without normalizing constant
+         */
+        static double getLogDensity(const std::vector<double>& values);
+
+        /**
+         * \brief Gets the standard deviation per stochast of a number of samples
+         * \remark Returns 1 for stochasts without variation
+         */
+        static std::vector<double> getStandardDeviations(const std::vector<std::shared_ptr<Models::Sample>>& samples);
+
+        /**
+         * \brief Adapts a scale parameter so that the acceptance rate approaches its target, the adaptation vanishes with the step index
+         */
+        static double getAdaptedScale(double scale, double acceptanceRate, double targetAcceptanceRate, int stepIndex);
+
+        /**
+         * \brief Gets a standard normal distributed random value
+         */
+        static double getStandardNormalValue(Numeric::RandomValueGenerator& generator);
+
+        int modelRuns = 0;
+
+    private:
+        double threshold = 0;
+        double z0Fac = 1;
+        int acceptedSamples = 0;
+        int rejectedSamples = 0;
+    };
+}
+
@@ -20,15 +20,37 @@
 // All rights reserved.
 //
 #include "SubsetSimulationSettings.h"
+#include "CrankNicolsonSampler.h"
+#include "DelayedRejectionSampler.h"
+#include "HamiltonianSampler.h"
 
 namespace Deltares::Reliability
 {
+    std::shared_ptr<SubsetSimulationSampler> SubsetSimulationSettings::getSampler() const
+    {
+        if (Sampler != nullptr)
+        {
+            return Sampler;
+        }
+
+        switch (SampleMethod)
+        {
+        case SampleMethodType::DelayedRejection: return std::make_shared<DelayedRejectionSampler>();
+        case SampleMethodType::CrankNicolson: return std::make_shared<CrankNicolsonSampler>();
+        case SampleMethodType::Hamiltonian: return std::make_shared<HamiltonianSampler>();
+        default: return nullptr;
+        }
+    }
+
     std::string SubsetSimulationSettings::getSampleMethodString(SampleMethodType method)
     {
         switch (method)
         {
         case SampleMethodType::MarkovChain: return "markov_chain";
         case SampleMethodType::AdaptiveConditional: return "adaptive_conditional";
+        case SampleMethodType::DelayedRejection: return "delayed_rejection";
+        case SampleMethodType::CrankNicolson: return "crank_nicolson";
+        case SampleMethodType::Hamiltonian: return "hamiltonian";
         default: throw probLibException("Sample method");
         }
     }
@@ -37,6 +59,9 @@ namespace Deltares::Reliability
     {
         if (method == "markov_chain") return SampleMethodType::MarkovChain;
         else if (method == "adaptive_conditional") return SampleMethodType::AdaptiveConditional;
+        else if (method == "delayed_rejection") return SampleMethodType::DelayedRejection;
+        else if (method == "crank_nicolson") return SampleMethodType::CrankNicolson;
+        else if (method == "hamiltonian") return SampleMethodType::Hamiltonian;
         else throw probLibException("Sample method");
     }
 }
@@ -23,13 +23,14 @@
 
 #include "DesignPointBuilder.h"
 #include "StochastSettingsSet.h"
+#include "SubsetSimulationSampler.h"
 #include "../Model/RandomSettings.h"
 #include "../Model/RunSettings.h"
 #include "../Model/Validatable.h"
 
 namespace Deltares::Reliability
 {
-    enum SampleMethodType { MarkovChain, AdaptiveConditional };
+    enum SampleMethodType { MarkovChain, AdaptiveConditional, DelayedRejection, CrankNicolson, Hamiltonian };
 
     /**
      * \brief Settings for the subset simulation algorithm
@@ -62,11 +63,22 @@ namespace Deltares::Reliability
          */
         SampleMethodType SampleMethod = SampleMethodType::MarkovChain;
 
+        /**
+         * \brief Kernel which generates new samples, overrides the sample method if assigned
+         */
+        std::shared_ptr<SubsetSimulationSampler> Sampler = nullptr;
+
         /**
          * \brief Standard deviation in the Markov chain
          */
         double MarkovChainDeviation = 1;
 
+        /**
+         * \brief Indicates whether all Markov chains advance simultaneously, so that the proposals of all chains are calculated in one batch
+         * \remark Each chain uses its own random sequence, so results do not depend on the number of processes
+         */
+        bool ParallelChains = false;
+
         /**
          * \brief Fraction of the samples which will be used in the next iteration
          */
@@ -99,6 +111,12 @@ namespace Deltares::Reliability
             RunSettings->validate(report);
         }
 
+        /**
+         * \brief Gets the kernel which generates new samples
+         * \return The assigned sampler, otherwise a new sampler for the sample method, nullptr for sample methods without sampler
+         */
+        std::shared_ptr<SubsetSimulationSampler> getSampler() const;
+
         static std::string getSampleMethodString(SampleMethodType method);
         static SampleMethodType getSampleMethod(std::string method);
     };
@@ -23,7 +23,7 @@
 #pragma once
 
 #include "SensitivityValue.h"
-#include "../Model/Evaluation.h"
+#include "../Model/EvaluationList.h"
 #include "../Logging/Message.h"
 
 namespace Deltares::Sensitivity
@@ -47,7 +47,7 @@ namespace Deltares::Sensitivity
         /**
          * \brief List of evaluations calculated during sensitivity analysis
          */
-        std::vector<std::shared_ptr<Models::Evaluation>> evaluations;
+        Models::EvaluationList evaluations;
 
         /**
          * \brief List of messages raised during sensitivity analysis
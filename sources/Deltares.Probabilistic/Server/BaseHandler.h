@@ -64,6 +64,7 @@ namespace Deltares::Server
         virtual int GetIndexedIdValue(int id, const std::string& property_, int index) { return GetIndexedIntValue(id, property_, index); }
         virtual void SetCallBack(int id, const std::string& property_, Models::ZValuesCallBack callBack) {}
         virtual void SetMultipleCallBack(int id, const std::string& property_, Models::ZValuesMultipleCallBack callBack) {}
+        virtual void SetBatchCallBack(int id, const std::string& property_, Models::ZValuesBatchCallBack callBack) {}
         virtual void SetEmptyCallBack(int id, const std::string& property_, Models::EmptyCallBack callBack) {}
         virtual void SetProgressCallBacks(int id, Models::ProgressCallBack progress, Models::DetailedProgressCallBack detailed, Models::TextualProgressCallBack textual) {}
         virtual void SetModelSampleCallBack(int id, const std::string& property_, Models::ModelSampleCallback callBack) {}
@@ -240,12 +240,12 @@ namespace Deltares::Server
         case ObjectType::Settings: settingsValuesIds.erase(settingsValues[id]); settingsValues.erase(id); break;
         case ObjectType::StochastSettings: stochastSettingsValues.erase(id); break;
         case ObjectType::StochastPoint: stochastPoints.erase(id); break;
-        case ObjectType::DesignPoint: designPointIds.erase(designPoints[id]); designPoints.erase(id); break;
+        case ObjectType::DesignPoint: ReleaseEvaluationIds(designPoints[id]->Evaluations); designPointIds.erase(designPoints[id]); designPoints.erase(id); break;
         case ObjectType::Alpha: alphaIds.erase(alphas[id]); alphas.erase(id); break;
         case ObjectType::FragilityCurve:  fragilityCurveIds.erase(fragilityCurves[id]); fragilityCurves.erase(id); break;
         case ObjectType::FragilityCurveProject: fragilityCurveProjects.erase(id); break;
         case ObjectType::FragilityCurveSettings: fragilityCurveSettings.erase(id); break;
-        case ObjectType::Evaluation: evaluationIds.erase(evaluations[id]); evaluations.erase(id); break;
+        case ObjectType::Evaluation: std::erase_if(listEvaluationIds, [id](const auto& entry) { return entry.second == id; }); evaluationIds.erase(evaluations[id]); evaluations.erase(id); break;
         case ObjectType::ReliabilityResult: reliabilityResultIds.erase(reliabilityResults[id]); reliabilityResults.erase(id); break;
         case ObjectType::CombineProject: combineProjects.erase(id); break;
         case ObjectType::CombineSettings: combineSettingsValues.erase(id); break;
@@ -256,10 +256,10 @@ namespace Deltares::Server
         case ObjectType::RunProjectSettings: runProjectSettings.erase(id); break;
         case ObjectType::UncertaintyProject: uncertaintyProjects.erase(id); break;
         case ObjectType::UncertaintySettings: uncertaintySettingsValues.erase(id); break;
-        case ObjectType::UncertaintyResult: uncertaintyResultsIds.erase(uncertaintyResults[id]); uncertaintyResults.erase(id); break;
+        case ObjectType::UncertaintyResult: ReleaseEvaluationIds(uncertaintyResults[id]->evaluations); uncertaintyResultsIds.erase(uncertaintyResults[id]); uncertaintyResults.erase(id); break;
         case ObjectType::SensitivityProject: sensitivityProjects.erase(id); break;
         case ObjectType::SensitivitySettings: sensitivitySettingsValues.erase(id); break;
-        case ObjectType::SensitivityResult: sensitivityResultsIds.erase(sensitivityResults[id]); sensitivityResults.erase(id); break;
+        case ObjectType::SensitivityResult: ReleaseEvaluationIds(sensitivityResults[id]->evaluations); sensitivityResultsIds.erase(sensitivityResults[id]); sensitivityResults.erase(id); break;
         case ObjectType::SensitivityValue: sensitivityValuesIds.erase(sensitivityValues[id]); sensitivityValues.erase(id); break;
         case ObjectType::LengthEffectProject: lengthEffectProjects.erase(id); break;
         case ObjectType::ConvergenceReport: convergenceReportIds.erase(convergenceReports[id]); convergenceReports.erase(id); break;
@@ -393,6 +393,7 @@ namespace Deltares::Server
             if (property_ == "relaxation_factor") return settings->RelaxationFactor;
             else if (property_ == "variation_coefficient") return settings->VariationCoefficient;
             else if (property_ == "variance_factor") return settings->VarianceFactor;
+            else if (property_ == "defensive_fraction") return settings->DefensiveFraction;
             else if (property_ == "fraction_failed") return settings->FractionFailed;
             else if (property_ == "epsilon_beta") return settings->EpsilonBeta;
             else if (property_ == "epsilon_weight_sample") return settings->EpsilonWeightSample;
@@ -521,6 +522,14 @@ namespace Deltares::Server
             else if (property_ == "variance_factor") return convergence_report->VarianceFactor;
             else if (property_ == "z_margin") return convergence_report->ZMargin;
         }
+        else if (ProjectEntries::IsModelProjectType(objectType))
+        {
+            std::shared_ptr<Models::ModelProject> project = GetProject(id);
+
+            // the counters can exceed the range of an int
+            if (property_ == "repository_hits") return static_cast<double>(project->model->getRepositoryHits());
+            else if (property_ == "repository_misses") return static_cast<double>(project->model->getRepositoryMisses());
+        }
         return std::nan("");
     }
 
@@ -640,6 +649,7 @@ namespace Deltares::Server
             if (property_ == "relaxation_factor") settings->RelaxationFactor = value;
             else if (property_ == "variation_coefficient") settings->VariationCoefficient = value;
             else if (property_ == "variance_factor") settings->VarianceFactor = value;
+            else if (property_ == "defensive_fraction") settings->DefensiveFraction = value;
             else if (property_ == "fraction_failed") settings->FractionFailed = value;
             else if (property_ == "epsilon_weight_sample") settings->EpsilonWeightSample = value;
             else if (property_ == "epsilon_beta") settings->EpsilonBeta = value;
@@ -780,6 +790,13 @@ namespace Deltares::Server
             else if (property_ == "stochasts_count") return static_cast<int>(project->stochasts.size());
             else if (property_ == "total_model_runs") return project->modelRuns;
         }
+        else if (ProjectEntries::IsModelSettingsType(objectType))
+        {
+            std::shared_ptr<Models::ModelProjectSettings> settings = GetSettings(id);
+
+            if (property_ == "max_repository_size") return settings->RunSettings->MaxRepositorySize;
+            else if (property_ == "max_evaluations_memory") return settings->RunSettings->MaxEvaluationsMemory;
+        }
 
         if (objectType == ObjectType::ValidationReport)
         {
@@ -883,6 +900,7 @@ namespace Deltares::Server
             else if (property_ == "maximum_iterations") return settings->MaximumIterations;
             else if (property_ == "minimum_directions") return settings->MinimumDirections;
             else if (property_ == "maximum_directions") return settings->MaximumDirections;
+            else if (property_ == "full_gradient_interval") return settings->GradientSettings->FullGradientInterval;
             else if (property_ == "minimum_variance_loops") return settings->MinimumVarianceLoops;
             else if (property_ == "maximum_variance_loops") return settings->MaximumVarianceLoops;
             else if (property_ == "minimum_failed_samples") return settings->MinimumFailedSamples;
@@ -1188,6 +1206,13 @@ namespace Deltares::Server
             else if (property_ == "share_project") project->shareStochasts(GetProject(value));
             else if (property_ == "total_model_runs") project->modelRuns = value;
         }
+        else if (ProjectEntries::IsModelSettingsType(objectType))
+        {
+            std::shared_ptr<Models::ModelProjectSettings> settings = GetSettings(id);
+
+            if (property_ == "max_repository_size") settings->RunSettings->MaxRepositorySize = value;
+            else if (property_ == "max_evaluations_memory") settings->RunSettings->MaxEvaluationsMemory = value;
+        }
 
         if (objectType == ObjectType::FragilityCurveProject)
         {
@@ -1278,6 +1303,7 @@ namespace Deltares::Server
             else if (property_ == "maximum_iterations") settings->MaximumIterations = value;
             else if (property_ == "minimum_directions") settings->MinimumDirections = value;
             else if (property_ == "maximum_directions") settings->MaximumDirections = value;
+            else if (property_ == "full_gradient_interval") settings->GradientSettings->FullGradientInterval = value;
             else if (property_ == "minimum_variance_loops") settings->MinimumVarianceLoops = value;
             else if (property_ == "maximum_variance_loops") settings->MaximumVarianceLoops = value;
             else if (property_ == "minimum_failed_samples") settings->MinimumFailedSamples = value;
@@ -1423,6 +1449,7 @@ namespace Deltares::Server
             else if (property_ == "save_messages") return settings->RunSettings->SaveMessages;
             else if (property_ == "reuse_calculations") return settings->RunSettings->ReuseCalculations;
             else if (property_ == "allow_repository") return settings->RunSettings->AllowRepository;
+            else if (property_ == "stream_evaluations") return settings->RunSettings->StreamEvaluations;
             else if (property_ == "use_z_from_sample") return settings->RunSettings->UseZFromSample;
         }
 
@@ -1515,6 +1542,7 @@ namespace Deltares::Server
             if (property_ == "derive_samples_from_variation_coefficient") return settings->DeriveSamplesFromVariationCoefficient;
             else if (property_ == "calculate_correlations") return settings->CalculateCorrelations;
             else if (property_ == "calculate_input_correlations") return settings->CalculateInputCorrelations;
+            else if (property_ == "calculate_rank_correlations") return settings->CalculateRankCorrelations;
             else if (property_ == "is_repeatable_random") return settings->RandomSettings->IsRepeatableRandom;
         }
         else if (objectType == ObjectType::Settings)
@@ -1528,6 +1556,9 @@ namespace Deltares::Server
             else if (property_ == "optimize_number_clusters") return setting->OptimizeNumberOfClusters;
             else if (property_ == "auto_maximum_samples") return setting->AutoMaximumSamples;
             else if (property_ == "start_point_on_limit_state") return setting->StartPointOnLimitState;
+            else if (property_ == "directions_per_thread") return setting->DirectionsPerThread;
+            else if (property_ == "parallel_chains") return setting->ParallelChains;
+            else if (property_ == "adaptive_step_size") return setting->GradientSettings->AdaptiveStepSize;
         }
         else if (objectType == ObjectType::CombineProject)
         {
@@ -1570,6 +1601,7 @@ namespace Deltares::Server
             else if (property_ == "save_messages") settings->RunSettings->SaveMessages = value;
             else if (property_ == "reuse_calculations") settings->RunSettings->ReuseCalculations = value;
             else if (property_ == "allow_repository") settings->RunSettings->AllowRepository = value;
+            else if (property_ == "stream_evaluations") settings->RunSettings->StreamEvaluations = value;
             else if (property_ == "use_z_from_sample") settings->RunSettings->UseZFromSample = value;
             else if (property_ == "use_openmp_in_reliability") settings->RunSettings->UseOpenMPinReliability = value;
         }
@@ -1623,6 +1655,7 @@ namespace Deltares::Server
             if (property_ == "derive_samples_from_variation_coefficient") settings->DeriveSamplesFromVariationCoefficient = value;
             else if (property_ == "calculate_correlations") settings->CalculateCorrelations = value;
             else if (property_ == "calculate_input_correlations") settings->CalculateInputCorrelations = value;
+            else if (property_ == "calculate_rank_correlations") settings->CalculateRankCorrelations = value;
             else if (property_ == "is_repeatable_random") settings->RandomSettings->IsRepeatableRandom = value;
         }
         else if (objectType == ObjectType::Settings)
@@ -1636,6 +1669,9 @@ namespace Deltares::Server
             else if (property_ == "optimize_number_clusters") setting->OptimizeNumberOfClusters = value;
             else if (property_ == "auto_maximum_samples") setting->AutoMaximumSamples = value;
             else if (property_ == "start_point_on_limit_state") setting->StartPointOnLimitState = value;
+            else if (property_ == "directions_per_thread") setting->DirectionsPerThread = value;
+            else if (property_ == "parallel_chains") setting->ParallelChains = value;
+            else if (property_ == "adaptive_step_size") setting->GradientSettings->AdaptiveStepSize = value;
         }
         else if (objectType == ObjectType::DesignPoint)
         {
@@ -1709,9 +1745,12 @@ namespace Deltares::Server
             else if (property_ == "design_point_method") return DesignPointBuilder::getDesignPointMethodString(settings->designPointMethod);
             else if (property_ == "fragility_curve_design_point_method") return DesignPointBuilder::getDesignPointMethodString(settings->fragilityCurveDesignPointMethod);
             else if (property_ == "sample_method") return SubsetSimulationSettings::getSampleMethodString(settings->sampleMethod);
+            else if (property_ == "cluster_allocation") return ImportanceSamplingSettings::getClusterAllocationString(settings->ClusterAllocation);
+            else if (property_ == "integration_grid_type") return NumericalIntegrationSettings::getGridTypeString(settings->IntegrationGridType);
             else if (property_ == "start_method") return StartPointCalculatorSettings::getStartPointMethodString(settings->StartPointSettings->StartMethod);
             else if (property_ == "gradient_type") return Models::GradientSettings::getGradientTypeString(settings->GradientSettings->gradientType);
             else if (property_ == "model_varying_type") return DirectionReliabilitySettings::getModelVaryingTypeString(settings->DirectionSettings->modelVaryingType);
+            else if (property_ == "random_generator_type") return Models::RandomSettings::getRandomGeneratorTypeString(settings->RandomSettings->GeneratorType);
             else if (property_ == "lowest_message_type") return Logging::Message::getMessageTypeString(settings->RunSettings->LowestMessageType);
         }
         else if (objectType == ObjectType::FragilityCurveSettings)
@@ -1733,6 +1772,7 @@ namespace Deltares::Server
 
             if (property_ == "uncertainty_method") return Uncertainty::SettingsS::getUncertaintyMethodTypeString(settings->UncertaintyMethod);
             else if (property_ == "gradient_type") return Models::GradientSettings::getGradientTypeString(settings->GradientSettings->gradientType);
+            else if (property_ == "random_generator_type") return Models::RandomSettings::getRandomGeneratorTypeString(settings->RandomSettings->GeneratorType);
             else if (property_ == "lowest_message_type") return Logging::Message::getMessageTypeString(settings->RunSettings->LowestMessageType);
         }
         else if (objectType == ObjectType::UncertaintyProject)
@@ -1792,6 +1832,15 @@ namespace Deltares::Server
             if (property_ == "identifier") return result->identifier;
         }
 
+        if (ProjectEntries::IsModelSettingsType(objectType))
+        {
+            std::shared_ptr<Models::ModelProjectSettings> settings = GetSettings(id);
+
+            if (property_ == "cache_file") return settings->RunSettings->CacheFile;
+            else if (property_ == "cache_tag") return settings->RunSettings->CacheTag;
+            else if (property_ == "evaluations_directory") return settings->RunSettings->EvaluationsDirectory;
+        }
+
         return "";
     }
 
@@ -1863,9 +1912,12 @@ namespace Deltares::Server
             else if (property_ == "design_point_method") settings->designPointMethod = DesignPointBuilder::getDesignPointMethod(value);
             else if (property_ == "fragility_curve_design_point_method") settings->fragilityCurveDesignPointMethod = DesignPointBuilder::getDesignPointMethod(value);
             else if (property_ == "sample_method") settings->sampleMethod = SubsetSimulationSettings::getSampleMethod(value);
+            else if (property_ == "cluster_allocation") settings->ClusterAllocation = ImportanceSamplingSettings::getClusterAllocation(value);
+            else if (property_ == "integration_grid_type") settings->IntegrationGridType = NumericalIntegrationSettings::getGridType(value);
             else if (property_ == "start_method") settings->StartPointSettings->StartMethod = StartPointCalculatorSettings::getStartPointMethod(value);
             else if (property_ == "gradient_type") settings->GradientSettings->gradientType = Models::GradientSettings::getGradientType(value);
             else if (property_ == "model_varying_type") settings->DirectionSettings->modelVaryingType = DirectionReliabilitySettings::getModelVaryingType(value);
+            else if (property_ == "random_generator_type") settings->RandomSettings->GeneratorType = Models::RandomSettings::getRandomGeneratorType(value);
             else if (property_ == "lowest_message_type") settings->RunSettings->LowestMessageType = Logging::Message::getMessageType(value);
         }
         else if (objectType == ObjectType::FragilityCurveSettings)
@@ -1887,6 +1939,7 @@ namespace Deltares::Server
 
             if (property_ == "uncertainty_method") settings->UncertaintyMethod = Uncertainty::SettingsS::getUncertaintyMethodType(value);
             else if (property_ == "gradient_type") settings->GradientSettings->gradientType = Models::GradientSettings::getGradientType(value);
+            else if (property_ == "random_generator_type") settings->RandomSettings->GeneratorType = Models::RandomSettings::getRandomGeneratorType(value);
             else if (property_ == "lowest_message_type") settings->RunSettings->LowestMessageType = Logging::Message::getMessageType(value);
         }
         else if (objectType == ObjectType::SensitivitySettings)
@@ -1927,6 +1980,15 @@ namespace Deltares::Server
 
             if (property_ == "model_name") project->model->name = value;
         }
+
+        if (ProjectEntries::IsModelSettingsType(objectType))
+        {
+            std::shared_ptr<Models::ModelProjectSettings> settings = GetSettings(id);
+
+            if (property_ == "cache_file") settings->RunSettings->CacheFile = value;
+            else if (property_ == "cache_tag") settings->RunSettings->CacheTag = value;
+            else if (property_ == "evaluations_directory") settings->RunSettings->EvaluationsDirectory = value;
+        }
     }
 
     void ProjectHandler::SetArrayValue(int id, const std::string& property_, double* values, int size)
@@ -2434,7 +2496,7 @@ namespace Deltares::Server
             std::shared_ptr<Sensitivity::SensitivityResult> result = sensitivityResults[id];
 
             if (property_ == "values") return GetSensitivityValueId(result->values[index], newId);
-            else if (property_ == "evaluations") return GetEvaluationId(result->evaluations[index], newId);
+            else if (property_ == "evaluations") return GetEvaluationId(result->evaluations, index, newId);
             else if (property_ == "messages") return GetMessageId(result->messages[index], newId);
         }
         else if (objectType == ObjectType::StochastPoint)
@@ -2449,7 +2511,7 @@ namespace Deltares::Server
 
             if (property_ == "contributing_design_points") return GetDesignPointId(designPoint->ContributingDesignPoints[index], newId);
             else if (property_ == "alphas") return GetAlphaId(designPoint->Alphas[index], newId);
-            else if (property_ == "evaluations") return GetEvaluationId(designPoint->Evaluations[index], newId);
+            else if (property_ == "evaluations") return GetEvaluationId(designPoint->Evaluations, index, newId);
             else if (property_ == "reliability_results") return GetReliabilityResultId(designPoint->ReliabilityResults[index], newId);
             else if (property_ == "messages") return GetMessageId(designPoint->Messages[index], newId);
         }
@@ -2463,7 +2525,7 @@ namespace Deltares::Server
         {
             std::shared_ptr<Uncertainty::UncertaintyResult> result = uncertaintyResults[id];
 
-            if (property_ == "evaluations") return GetEvaluationId(result->evaluations[index], newId);
+            if (property_ == "evaluations") return GetEvaluationId(result->evaluations, index, newId);
             else if (property_ == "quantile_evaluations") return GetEvaluationId(result->quantileEvaluations[index], newId);
             else if (property_ == "messages") return GetMessageId(result->messages[index], newId);
         }
@@ -2503,6 +2565,26 @@ namespace Deltares::Server
         }
     }
 
+    void ProjectHandler::SetBatchCallBack(int id, const std::string& property_, Models::ZValuesBatchCallBack callBack)
+    {
+        ObjectType objectType = types[id];
+
+        if (ProjectEntries::IsModelProjectType(objectType))
+        {
+            std::shared_ptr<Models::ModelProject> project = GetProject(id);
+
+            if (property_ == "model")
+            {
+                if (project->model == nullptr)
+                {
+                    project->model = std::make_shared<Models::ZModel>();
+                }
+
+                project->model->setBatchCallback(callBack);
+            }
+        }
+    }
+
     void ProjectHandler::SetEmptyCallBack(int id, const std::string& property_, Models::EmptyCallBack callBack)
     {
         ObjectType objectType = types[id];
@@ -3011,6 +3093,31 @@ namespace Deltares::Server
         }
     }
 
+    int ProjectHandler::GetEvaluationId(const Models::EvaluationList& list, size_t index, int newId)
+    {
+        // evaluations in a store are created each time they are accessed, so they are identified by their position in the list
+        const auto key = std::make_pair(&list, index);
+
+        if (!listEvaluationIds.contains(key))
+        {
+            const int evaluationId = GetEvaluationId(list[index], newId);
+            if (evaluationId == 0)
+            {
+                return 0;
+            }
+
+            listEvaluationIds[key] = evaluationId;
+        }
+
+        return listEvaluationIds[key];
+    }
+
+    void ProjectHandler::ReleaseEvaluationIds(const Models::EvaluationList& list)
+    {
+        // another list may be created at the same address later
+        std::erase_if(listEvaluationIds, [&list](const auto& entry) { return entry.first.first == &list; });
+    }
+
     int ProjectHandler::GetReliabilityResultId(const std::shared_ptr<ReliabilityResult>& result, int newId)
     {
         if (!reliabilityResultIds.contains(result))
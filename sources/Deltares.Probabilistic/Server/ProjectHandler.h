@@ -30,6 +30,7 @@
 #include "../Reliability/CombinedLimitStateFunction.h"
 #include "../Reliability/Settings.h"
 #include "../Model/Evaluation.h"
+#include "../Model/EvaluationList.h"
 #include "../Model/RunProject.h"
 #include "../Model/RunProjectSettings.h"
 #include "../Uncertainty/UncertaintyProject.h"
@@ -46,6 +47,8 @@
 #include "../Statistics/Stochast.h"
 #include "../Statistics/DiscreteValue.h"
 
+#include <map>
+
 namespace Deltares::Reliability
 {
     class ProbabilityLimitStateFunction;
@@ -86,6 +89,7 @@ namespace Deltares::Server
         int GetIndexedIdValue(int id, const std::string& property_, int index) override;
         void SetCallBack(int id, const std::string& property_, Models::ZValuesCallBack callBack) override;
         void SetMultipleCallBack(int id, const std::string& property_, Models::ZValuesMultipleCallBack callBack) override;
+        void SetBatchCallBack(int id, const std::string& property_, Models::ZValuesBatchCallBack callBack) override;
         void SetEmptyCallBack(int id, const std::string& property_, Models::EmptyCallBack callBack) override;
         void SetProgressCallBacks(int id, Models::ProgressCallBack progress, Models::DetailedProgressCallBack detailed, Models::TextualProgressCallBack textual) override;
         void SetModelSampleCallBack(int id, const std::string& property_, Models::ModelSampleCallback callBack) override;
@@ -111,6 +115,8 @@ namespace Deltares::Server
         int GetContributingStochastId(const std::shared_ptr<Statistics::ContributingStochast>& contributingStochast, int newId);
         int GetConditionalValueId(const std::shared_ptr<Statistics::VariableStochastValue>& conditionalValue, int newId);
         int GetEvaluationId(const std::shared_ptr<Models::Evaluation>& evaluation, int newId);
+        int GetEvaluationId(const Models::EvaluationList& list, size_t index, int newId);
+        void ReleaseEvaluationIds(const Models::EvaluationList& list);
         int GetReliabilityResultId(const std::shared_ptr<Reliability::ReliabilityResult>& result, int newId);
         int GetMessageId(const std::shared_ptr<Logging::Message>& message, int newId);
         int GetSelfCorrelationMatrixId(const std::shared_ptr<Statistics::SelfCorrelationMatrix>& correlationMatrix, int newId);
@@ -192,6 +198,7 @@ namespace Deltares::Server
         std::unordered_map<std::shared_ptr<Statistics::ContributingStochast>, int> contributingStochastIds;
         std::unordered_map<std::shared_ptr<Statistics::VariableStochastValue>, int> conditionalValueIds;
         std::unordered_map<std::shared_ptr<Models::Evaluation>, int> evaluationIds;
+        std::map<std::pair<const Models::EvaluationList*, size_t>, int> listEvaluationIds;
         std::unordered_map<std::shared_ptr<Reliability::ReliabilityResult>, int> reliabilityResultIds;
         std::unordered_map<std::shared_ptr<Logging::Message>, int> messageIds;
         std::unordered_map<std::shared_ptr<Reliability::ConvergenceReport>, int> convergenceReportIds;
@@ -209,6 +209,11 @@ namespace Deltares::Server
         handler->SetMultipleCallBack(id, property_, callBack);
     }
 
+    void ProjectServer::SetBatchCallBack(int id, std::string property_, Models::ZValuesBatchCallBack callBack)
+    {
+        handler->SetBatchCallBack(id, property_, callBack);
+    }
+
     void ProjectServer::SetEmptyCallBack(int id, std::string property_, Models::EmptyCallBack callBack)
     {
         handler->SetEmptyCallBack(id, property_, callBack);
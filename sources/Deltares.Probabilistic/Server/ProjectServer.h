@@ -89,6 +89,7 @@ namespace Deltares::Server
         int GetIndexedIdValue(int id, std::string property_, int index);
         void SetCallBack(int id, std::string property_, Models::ZValuesCallBack callBack);
         void SetMultipleCallBack(int id, std::string property_, Models::ZValuesMultipleCallBack callBack);
+        void SetBatchCallBack(int id, std::string property_, Models::ZValuesBatchCallBack callBack);
         void SetEmptyCallBack(int id, std::string property_, Models::EmptyCallBack callBack);
         void SetModelSampleCallBack(int id, std::string property_, Models::ModelSampleCallback callBack);
         void SetMultipleModelSampleCallBack(int id, std::string property_, Models::MultipleModelSampleCallback callBack);
@@ -22,6 +22,7 @@
 
 #include "BaseCopula.h"
 #include "StandardNormal.h"
+#include <vector>
 
 namespace Deltares::Statistics
 {
@@ -33,6 +34,23 @@ namespace Deltares::Statistics
         b = StandardNormal::getUFromP(t);
     }
 
+    void BaseCopula::update_uspace(const double* a, double* b, size_t n) const
+    {
+        std::vector<double> u(n);
+        StandardNormal::getPFromU(a, u.data(), n);
+        StandardNormal::getPFromU(b, b, n);
+        update(u.data(), b, n);
+        StandardNormal::getUFromP(b, b, n);
+    }
+
+    void BaseCopula::update(const double* u, double* t, size_t n) const
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            update(u[i], t[i]);
+        }
+    }
+
     bool BaseCopula::isValid() const
     {
         auto report = Logging::ValidationReport();
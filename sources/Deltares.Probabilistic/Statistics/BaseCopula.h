@@ -21,6 +21,7 @@
 //
 
 #pragma once
+#include <cstddef>
 
 #include "CorrelationValueAndType.h"
 #include "../Logging/ValidationReport.h"
@@ -40,6 +41,15 @@ namespace Deltares::Statistics
         /// <param name="b"> value of second stochast in u-space </param>
         virtual void update_uspace(const double& a, double& b) const;
 
+        /// <summary>
+        /// update a number of pairs of correlated stochastic variables
+        /// </summary>
+        /// <param name="a"> values of first stochast in u-space </param>
+        /// <param name="b"> values of second stochast in u-space, which will be updated </param>
+        /// <param name="n"> number of pairs </param>
+        virtual void update_uspace(const double* a, double* b, size_t n) const;
+
+
         /// <summary>
         /// update a pair of correlated stochastic variables
         /// </summary>
@@ -47,6 +57,15 @@ namespace Deltares::Statistics
         /// <param name="t"> probability of failure of second stochast </param>
         virtual void update(const double& u, double& t) const = 0;
 
+        /// <summary>
+        /// update a number of pairs of correlated stochastic variables
+        /// </summary>
+        /// <param name="u"> probabilities of failure of first stochast </param>
+        /// <param name="t"> probabilities of failure of second stochast, which will be updated </param>
+        /// <param name="n"> number of pairs </param>
+        virtual void update(const double* u, double* t, size_t n) const;
+
+
         virtual CorrelationValueAndType getCorrelation() const { return { 0.0, CorrelationType::Gaussian }; }
 
         virtual bool isValid() const;
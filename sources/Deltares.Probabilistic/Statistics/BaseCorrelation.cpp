@@ -22,8 +22,27 @@
 
 #include "BaseCorrelation.h"
 
+#include <algorithm>
+
 namespace Deltares::Statistics
 {
+    void BaseCorrelation::ApplyCorrelation(const double* uValues, size_t dimension, size_t stride, size_t count, double* correlatedValues)
+    {
+        std::vector<double> values(dimension);
+
+        for (size_t j = 0; j < count; j++)
+        {
+            std::copy_n(uValues + j * stride, dimension, values.begin());
+
+            const std::vector<double> correlated = ApplyCorrelation(values);
+
+            for (size_t i = 0; i < dimension; i++)
+            {
+                correlatedValues[i * count + j] = correlated[i];
+            }
+        }
+    }
+
     int BaseCorrelation::FindNewIndex(const std::vector<int>& index, const size_t i)
     {
         if (index[i] == -1)
@@ -171,6 +171,16 @@ namespace Deltares::Statistics
         /// <returns> the updated vector of U-values </returns>
         virtual std::vector<double> ApplyCorrelation(const std::vector<double>& uValues) = 0;
 
+        /// <summary>
+        /// apply the correlation on a number of samples at once
+        /// </summary>
+        /// <param name="uValues"> the input U-values, sample by sample </param>
+        /// <param name="dimension"> the number of U-values per sample to be correlated </param>
+        /// <param name="stride"> the distance between the first U-values of successive samples in uValues </param>
+        /// <param name="count"> the number of samples </param>
+        /// <param name="correlatedValues"> the updated U-values, variable by variable: value i of sample j is at i * count + j </param>
+        virtual void ApplyCorrelation(const double* uValues, size_t dimension, size_t stride, size_t count, double* correlatedValues);
+
         /// <summary>
         /// make the object ready-to-run
         /// </summary>
@@ -45,6 +45,32 @@ namespace Deltares::Statistics
         }
     }
 
+    void ClaytonCopula::update(const double* u, double* t, size_t n) const
+    {
+        if (theta == -1.0)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                t[i] = 1.0 - u[i];
+            }
+        }
+        else if (theta < 1.0e8)
+        {
+            const double exponent = -theta / (1.0 + theta);
+            for (size_t i = 0; i < n; i++)
+            {
+                t[i] = u[i] * pow(pow(t[i], exponent) - 1.0 + pow(u[i], theta), -1.0 / theta);
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                t[i] = u[i] * (1.0 - (log1p(-u[i]) + log(u[i])) / theta);
+            }
+        }
+    }
+
     void ClaytonCopula::validate(Logging::ValidationReport& report) const
     {
         if (theta == 0.0 || theta < -1.0)
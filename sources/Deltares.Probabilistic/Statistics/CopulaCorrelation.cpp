@@ -196,6 +196,22 @@ namespace Deltares::Statistics
         return new_u_values;
     }
 
+    void CopulaCorrelation::ApplyCorrelation(const double* uValues, size_t dimension, size_t stride, size_t count, double* correlatedValues)
+    {
+        for (size_t j = 0; j < count; j++)
+        {
+            for (size_t i = 0; i < dimension; i++)
+            {
+                correlatedValues[i * count + j] = uValues[j * stride + i];
+            }
+        }
+
+        for (const auto& copula : copulas)
+        {
+            copula.copula->update_uspace(correlatedValues + static_cast<size_t>(copula.index1) * count, correlatedValues + static_cast<size_t>(copula.index2) * count, count);
+        }
+    }
+
     CorrelationValueAndType CopulaCorrelation::GetCorrelation(const int i, const int j) const
     {
         for(const auto& p : copulas)
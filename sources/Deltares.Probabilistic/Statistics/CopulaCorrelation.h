@@ -64,6 +64,12 @@ namespace Deltares::Statistics
         int GetDimension() override { return max_stochasts; }
         std::shared_ptr<Stochast> GetStochast(int index) override { return nullptr; }
         std::vector<double> ApplyCorrelation(const std::vector<double>& u_values) override;
+
+        /**
+         * \brief Applies the correlation to a number of samples at once
+         * \remark Each copula updates the whole column of its second stochast at once
+         */
+        void ApplyCorrelation(const double* uValues, size_t dimension, size_t stride, size_t count, double* correlatedValues) override;
         void InitializeForRun() override
         {
             // empty; after init and setCorrelation this class is ready to use
@@ -51,27 +51,92 @@ namespace Deltares::Statistics
         }
         else
         {
-            size_t c1; size_t c2;
-            choleskyMatrix.get_dims(c1, c2);
-            if (c1 == 0) CholeskyDecomposition();
+            if (choleskyRowStart.empty()) CholeskyDecomposition();
 
-            auto u = vector1D(count);
-            for (size_t i = 0; i < count; i++)
+            if (count != dim)
             {
-                u(i) = uValues[i];
+                throw probLibException("dimension mismatch in ApplyCorrelation");
             }
 
-            auto uNew = choleskyMatrix.matvec(u);
-
             for (size_t i = 0; i < count; i++)
             {
-                correlatedValues[i] = uNew(i);
+                const size_t first = choleskyRowStart[i];
+                const double* row = packedCholesky.data() + choleskyRowOffset[i];
+
+                double sum = 0.0;
+                for (size_t j = first; j <= i; j++)
+                {
+                    sum += row[j - first] * uValues[j];
+                }
+                correlatedValues[i] = sum;
             }
         }
 
         return correlatedValues;
     }
 
+    void CorrelationMatrix::ApplyCorrelation(const double* uValues, size_t dimension, size_t stride, size_t count, double* correlatedValues)
+    {
+        if (dim == 0)
+        {
+            for (size_t j = 0; j < count; j++)
+            {
+                for (size_t i = 0; i < dimension; i++)
+                {
+                    correlatedValues[i * count + j] = uValues[j * stride + i];
+                }
+            }
+            return;
+        }
+
+        if (choleskyRowStart.empty()) CholeskyDecomposition();
+
+        if (dimension != dim)
+        {
+            throw probLibException("dimension mismatch in ApplyCorrelation");
+        }
+
+        // the block of u-values fits in the cache and is reused by all rows of the Cholesky matrix
+        constexpr size_t blockSize = 64;
+        std::vector<double> block(dim * blockSize);
+
+        for (size_t start = 0; start < count; start += blockSize)
+        {
+            const size_t m = std::min(blockSize, count - start);
+
+            // transposed, so that the values of one stochast in all samples of the block are adjacent
+            for (size_t s = 0; s < m; s++)
+            {
+                const double* sample = uValues + (start + s) * stride;
+                for (size_t j = 0; j < dim; j++)
+                {
+                    block[j * m + s] = sample[j];
+                }
+            }
+
+            for (size_t i = 0; i < dim; i++)
+            {
+                const size_t first = choleskyRowStart[i];
+                const double* row = packedCholesky.data() + choleskyRowOffset[i];
+                double* result = correlatedValues + i * count + start;
+
+                std::fill_n(result, m, 0.0);
+
+                for (size_t j = first; j <= i; j++)
+                {
+                    const double factor = row[j - first];
+                    const double* values = block.data() + j * m;
+
+#pragma omp simd
+                    for (size_t s = 0; s < m; s++)
+                    {
+                        result[s] += factor * values[s];
+                    }
+                }
+            }
+        }
+    }
+
     std::vector<double> CorrelationMatrix::InverseCholesky(const std::vector<double>& uValues)
     {
         auto count = uValues.size();
@@ -249,6 +314,31 @@ namespace Deltares::Statistics
     void CorrelationMatrix::CholeskyDecomposition()
     {
         choleskyMatrix = matrix.CholeskyDecomposition();
+        PackCholesky();
+    }
+
+    void CorrelationMatrix::PackCholesky()
+    {
+        packedCholesky.clear();
+        choleskyRowStart.resize(dim);
+        choleskyRowOffset.resize(dim);
+
+        for (size_t i = 0; i < dim; i++)
+        {
+            size_t first = 0;
+            while (first < i && choleskyMatrix(i, first) == 0.0)
+            {
+                first++;
+            }
+
+            choleskyRowStart[i] = first;
+            choleskyRowOffset[i] = packedCholesky.size();
+
+            for (size_t j = first; j <= i; j++)
+            {
+                packedCholesky.push_back(choleskyMatrix(i, j));
+            }
+        }
     }
 
     void CorrelationMatrix::InverseCholeskyDecomposition()
@@ -49,6 +49,12 @@ namespace Deltares::Statistics
             void Validate(Logging::ValidationReport& report) const override;
 
             std::vector<double> ApplyCorrelation(const std::vector<double>& uValues) override;
+
+            /**
+             * \brief Applies the correlation to a number of samples at once
+             * \remark The samples are processed in blocks, for which the triangular Cholesky matrix is applied row by row to all samples in the block
+             */
+            void ApplyCorrelation(const double* uValues, size_t dimension, size_t stride, size_t count, double* correlatedValues) override;
             std::vector<double> InverseCholesky(const std::vector<double>& uValues);
 
             void SetCorrelation(const int i, const int j, double value, CorrelationType type) override;
@@ -72,6 +78,16 @@ namespace Deltares::Statistics
             Numeric::Matrix matrix = Numeric::Matrix(0, 0);
             Numeric::Matrix choleskyMatrix = Numeric::Matrix(0, 0);
             Numeric::Matrix inverseCholeskyMatrix = Numeric::Matrix(0, 0);
+
+            /**
+             * \brief Non-zero part of the rows of the lower triangular Cholesky matrix, stored one after another
+             * \remark Row i contains the columns choleskyRowStart[i] up to and including i and starts at choleskyRowOffset[i],
+             *         so block diagonal and banded matrices only store and apply their bands
+             */
+            std::vector<double> packedCholesky;
+            std::vector<size_t> choleskyRowStart;
+            std::vector<size_t> choleskyRowOffset;
+            void PackCholesky();
             void CholeskyDecomposition();
             void InverseCholeskyDecomposition();
             bool hasFullyCorrelated() const;
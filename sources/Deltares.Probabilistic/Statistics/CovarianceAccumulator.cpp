@@ -0,0 +1,203 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "CovarianceAccumulator.h"
+#include "../Utils/probLibException.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Deltares::Statistics
+{
+    CovarianceAccumulator::CovarianceAccumulator(size_t dimension)
+    {
+        this->dimension = dimension;
+        this->means = std::vector<double>(dimension, 0.0);
+        this->coMoments = std::vector<double>(dimension * (dimension + 1) / 2, 0.0);
+    }
+
+    void CovarianceAccumulator::add(const double* values, double weight)
+    {
+        if (weight <= 0.0)
+        {
+            return;
+        }
+
+        const double newWeight = this->weight + weight;
+        const double factor = weight * this->weight / newWeight;
+
+        std::vector<double> deltas(dimension);
+        for (size_t i = 0; i < dimension; i++)
+        {
+            deltas[i] = values[i] - means[i];
+            means[i] += deltas[i] * weight / newWeight;
+        }
+
+        for (size_t i = 0; i < dimension; i++)
+        {
+            double* row = coMoments.data() + i * (i + 1) / 2;
+            const double scaledDelta = factor * deltas[i];
+
+#pragma omp simd
+            for (size_t j = 0; j <= i; j++)
+            {
+                row[j] += scaledDelta * deltas[j];
+            }
+        }
+
+        this->weight = newWeight;
+    }
+
+    void CovarianceAccumulator::add(const double* values, const double* weights, size_t count)
+    {
+        const size_t blocks = (count + BlockSize - 1) / BlockSize;
+
+        if (blocks <= 1)
+        {
+            addBlock(values, weights, count);
+            return;
+        }
+
+        std::vector<CovarianceAccumulator> partials(blocks, CovarianceAccumulator(dimension));
+
+#pragma omp parallel for
+        for (int block = 0; block < static_cast<int>(blocks); block++)
+        {
+            const size_t start = static_cast<size_t>(block) * BlockSize;
+            const size_t size = std::min(BlockSize, count - start);
+            partials[block].addBlock(values + start * dimension, weights + start, size);
+        }
+
+        // merge in a fixed order, so that the result does not depend on the number of threads
+        for (const CovarianceAccumulator& partial : partials)
+        {
+            merge(partial);
+        }
+    }
+
+    void CovarianceAccumulator::addBlock(const double* values, const double* weights, size_t count)
+    {
+        // two pass over the block: first the means, then the centered co-moments, merged as a partial accumulator
+        CovarianceAccumulator block(dimension);
+
+        for (size_t k = 0; k < count; k++)
+        {
+            block.weight += weights[k];
+            const double* row = values + k * dimension;
+
+#pragma omp simd
+            for (size_t i = 0; i < dimension; i++)
+            {
+                block.means[i] += weights[k] * row[i];
+            }
+        }
+
+        if (block.weight <= 0.0)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < dimension; i++)
+        {
+            block.means[i] /= block.weight;
+        }
+
+        std::vector<double> deltas(dimension);
+        for (size_t k = 0; k < count; k++)
+        {
+            const double* row = values + k * dimension;
+
+            for (size_t i = 0; i < dimension; i++)
+            {
+                deltas[i] = row[i] - block.means[i];
+            }
+
+            for (size_t i = 0; i < dimension; i++)
+            {
+                double* coMomentRow = block.coMoments.data() + i * (i + 1) / 2;
+                const double scaledDelta = weights[k] * deltas[i];
+
+#pragma omp simd
+                for (size_t j = 0; j <= i; j++)
+                {
+                    coMomentRow[j] += scaledDelta * deltas[j];
+                }
+            }
+        }
+
+        merge(block);
+    }
+
+    void CovarianceAccumulator::merge(const CovarianceAccumulator& other)
+    {
+        if (other.dimension != this->dimension)
+        {
+            throw Reliability::probLibException("dimension mismatch in CovarianceAccumulator");
+        }
+
+        if (other.weight <= 0.0)
+        {
+            return;
+        }
+
+        const double newWeight = this->weight + other.weight;
+        const double factor = this->weight * other.weight / newWeight;
+
+        std::vector<double> deltas(dimension);
+        for (size_t i = 0; i < dimension; i++)
+        {
+            deltas[i] = other.means[i] - means[i];
+            means[i] += deltas[i] * other.weight / newWeight;
+        }
+
+        for (size_t i = 0; i < dimension; i++)
+        {
+            double* row = coMoments.data() + i * (i + 1) / 2;
+            const double* otherRow = other.coMoments.data() + i * (i + 1) / 2;
+            const double scaledDelta = factor * deltas[i];
+
+#pragma omp simd
+            for (size_t j = 0; j <= i; j++)
+            {
+                row[j] += otherRow[j] + scaledDelta * deltas[j];
+            }
+        }
+
+        this->weight = newWeight;
+    }
+
+    double CovarianceAccumulator::getCovariance(size_t i, size_t j) const
+    {
+        return weight > 0.0 ? coMoments[getPackedIndex(i, j)] / weight : std::nan("");
+    }
+
+    double CovarianceAccumulator::getCorrelation(size_t i, size_t j) const
+    {
+        const double variance = coMoments[getPackedIndex(i, i)] * coMoments[getPackedIndex(j, j)];
+
+        if (variance <= 0.0)
+        {
+            return 0.0;
+        }
+
+        return coMoments[getPackedIndex(i, j)] / std::sqrt(variance);
+    }
+}
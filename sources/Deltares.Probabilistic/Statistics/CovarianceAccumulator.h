@@ -0,0 +1,110 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Deltares::Statistics
+{
+    /**
+     * \brief Single pass accumulator of the weighted means and covariances of a number of variables
+     * \remark Rows are added one by one (Welford) or in chunks, partial accumulators can be merged (Chan et al.),
+     *         the co-moments are kept in a packed lower triangular matrix
+     */
+    class CovarianceAccumulator
+    {
+    public:
+        CovarianceAccumulator() = default;
+
+        /**
+         * \brief Constructor
+         * \param dimension Number of variables in a row
+         */
+        explicit CovarianceAccumulator(size_t dimension);
+
+        /**
+         * \brief Adds a row of values
+         * \param values Values, one for each variable
+         * \param weight Weight of the row
+         */
+        void add(const double* values, double weight = 1.0);
+
+        /**
+         * \brief Adds a chunk of rows
+         * \param values Row major values, count times dimension
+         * \param weights Weight of each row
+         * \param count Number of rows
+         * \remark Blocks of the chunk are accumulated in parallel and merged afterwards
+         */
+        void add(const double* values, const double* weights, size_t count);
+
+        /**
+         * \brief Merges a partial accumulator with the same dimension into this accumulator
+         */
+        void merge(const CovarianceAccumulator& other);
+
+        /**
+         * \brief Number of variables
+         */
+        size_t getDimension() const { return dimension; }
+
+        /**
+         * \brief Sum of the weights of all added rows
+         */
+        double getWeight() const { return weight; }
+
+        /**
+         * \brief Weighted mean of a variable
+         */
+        double getMean(size_t i) const { return means[i]; }
+
+        /**
+         * \brief Weighted (population) covariance between two variables
+         */
+        double getCovariance(size_t i, size_t j) const;
+
+        /**
+         * \brief Pearson correlation coefficient between two variables
+         * \return Correlation coefficient, zero if one of the variables has no variance
+         */
+        double getCorrelation(size_t i, size_t j) const;
+
+        /**
+         * \brief Number of rows of a chunk which are accumulated in one block
+         */
+        static constexpr size_t BlockSize = 256;
+
+    private:
+        size_t dimension = 0;
+        double weight = 0.0;
+        std::vector<double> means;
+        std::vector<double> coMoments;
+
+        static size_t getPackedIndex(size_t i, size_t j)
+        {
+            return i >= j ? i * (i + 1) / 2 + j : j * (j + 1) / 2 + i;
+        }
+
+        void addBlock(const double* values, const double* weights, size_t count);
+    };
+}
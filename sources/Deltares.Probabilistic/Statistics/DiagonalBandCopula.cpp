@@ -44,6 +44,27 @@ namespace Deltares::Statistics
         t = Finv;
     }
 
+    void DiagonalBandCopula::update(const double* u, double* t, size_t n) const
+    {
+        const double beta = 1.0 - alpha;
+
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
+        {
+            const double ui = u[i];
+            const double ti = t[i];
+
+            const bool lower = ui < beta && ti < 1.0 - ui / beta;
+            const bool upper = ui > alpha && ti > (1.0 - ui) / beta;
+
+            const double lowerValue = beta * ti;
+            const double upperValue = beta * ti + alpha;
+            const double middleValue = 2.0 * beta * ti + ui - 1.0 + alpha;
+
+            t[i] = lower ? lowerValue : (upper ? upperValue : middleValue);
+        }
+    }
+
     void DiagonalBandCopula::validate(Logging::ValidationReport& report) const
     {
         Logging::ValidationSupport::checkMinimum(report, 0.0, alpha, "Alpha", "Diagonal Band copula", Logging::MessageType::Error);
@@ -64,6 +64,39 @@ namespace Deltares::Statistics
         return log(this->getPDF(stochast, x));
     }
 
+    double Distribution::getSumLogLikelihood(StochastProperties& stochast, const std::vector<double>& values)
+    {
+        double prevLog = std::nan("");
+        double prevX = std::nan("");
+
+        double sum = 0;
+
+        for (double x : values)
+        {
+            if (x == prevX)
+            {
+                sum += prevLog;
+            }
+            else
+            {
+                double log = this->getLogLikelihood(stochast, x);
+                if (std::isnan(log))
+                {
+                    return log;
+                }
+                else
+                {
+                    prevX = x;
+                    prevLog = log;
+
+                    sum += log;
+                }
+            }
+        }
+
+        return sum;
+    }
+
     bool Distribution::isValid(StochastProperties& stochast)
     {
         std::string empty_subject;
@@ -67,6 +67,21 @@ namespace Deltares::Statistics
          */
         virtual double getXFromU(StochastProperties& stochast, double u) { return 0.0; }
 
+        /**
+         * \brief Gets the x-values (physical values) for a number of standard normal values (u-values)
+         * \param stochast Stochast from which the x-values are derived
+         * \param u Array of u-values (Standard normal values)
+         * \param x Array which will be filled with the x-values
+         * \param n Number of values
+         */
+        virtual void getXFromU(StochastProperties& stochast, const double* u, double* x, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                x[i] = this->getXFromU(stochast, u[i]);
+            }
+        }
+
         /**
          * \brief Gets the u-value (standard normal value) for a physical value (x-value)
          * \param stochast Stochast from which the u-value is derived
@@ -183,6 +198,21 @@ namespace Deltares::Statistics
          */
         virtual double getCDF(StochastProperties& stochast, double x) { return 0.0; }
 
+        /**
+         * \brief Gets the Cumulative Density Function (CDF) values of a stochast for a number of x-values
+         * \param stochast Stochast for which the CDF applies
+         * \param x Array of x-values
+         * \param p Array which will be filled with the CDF values, may be the same as x
+         * \param n Number of values
+         */
+        virtual void getCDF(StochastProperties& stochast, const double* x, double* p, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                p[i] = this->getCDF(stochast, x[i]);
+            }
+        }
+
         /**
          * \brief Modifies the stochast properties so that a given x-value is returned for a given u-value
          * \param stochast Stochast to be modified
@@ -257,6 +287,15 @@ namespace Deltares::Statistics
          */
         virtual double getLogLikelihood(StochastProperties& stochast, double x);
 
+        /**
+         * \brief Gets the sum of the log likelihoods of a stochast at a number of x-values
+         * \param stochast Stochast for which the log likelihood is calculated
+         * \param values given x-values, preferably sorted
+         * \return Sum of log likelihoods, nan if one of the log likelihoods is nan
+         * \remark Distributions can override this method with a calculation over all values at once
+         */
+        virtual double getSumLogLikelihood(StochastProperties& stochast, const std::vector<double>& values);
+
         /**
          * \brief Gets a list of x values where the CDF-value is discontinuous
          * \param stochast Stochast in use
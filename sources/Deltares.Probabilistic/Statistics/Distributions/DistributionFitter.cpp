@@ -39,10 +39,12 @@ namespace Deltares::Statistics
     {
         distributionObj = distribution;
 
-        constexpr int numberValues = 13;
+        // with a simplex search, a coarse grid locates the optimum and the simplex search refines it up to the resolution of the grid refinements
+        const int numberValues = UseNelderMead ? 7 : 13;
         constexpr int numberRefinements = 10;
 
         auto gridSearch = Optimization::GridSearch();
+        gridSearch.UseNelderMead = UseNelderMead;
 
         auto searchArea = std::make_shared<Optimization::SearchParameterSettingsSet>();
         for (size_t i = 0; i < properties.size(); i++)
@@ -56,7 +58,8 @@ namespace Deltares::Statistics
             searchArea->Dimensions.push_back(settings);
         }
 
-        const auto model = std::make_shared<Models::ZModel>([this, values, &stochast, properties]
+        // grid points are calculated in parallel, each on its own copy of the stochast
+        const auto model = std::make_shared<Models::ZModel>([this, &values, &stochast, &properties]
             (const std::shared_ptr<Models::ModelSample>& sample)
             { return getLogLikelihood(*sample, values, stochast, properties); });
 
@@ -73,55 +76,22 @@ namespace Deltares::Statistics
     }
 
     void DistributionFitter::getLogLikelihood(Models::ModelSample& sample, const std::vector<double>& values,
-        StochastProperties& stochast, const std::vector<DistributionPropertyType>& properties) const
+        const StochastProperties& stochast, const std::vector<DistributionPropertyType>& properties) const
     {
+        StochastProperties sampleStochast = stochast;
+
         for (size_t i = 0; i < properties.size(); i++)
         {
-            stochast.applyValue(properties[i], sample.Values[i]);
+            sampleStochast.applyValue(properties[i], sample.Values[i]);
         }
 
-        if (distributionObj->isValid(stochast))
+        if (distributionObj->isValid(sampleStochast))
         {
-            sample.Z = - getSumLogLikelihood(values, stochast);
+            sample.Z = - distributionObj->getSumLogLikelihood(sampleStochast, values);
         }
         else
         {
             sample.Z = nan("");
         }
     }
-
-    double DistributionFitter::getSumLogLikelihood(const std::vector<double>& values, StochastProperties& stochast) const
-    {
-        double prevLog = std::nan("");
-        double prevX = std::nan("");
-
-        double sum = 0;
-
-        for (double x : values)
-        {
-            if (x == prevX)
-            {
-                sum += prevLog;
-            }
-            else
-            {
-                double log = distributionObj->getLogLikelihood(stochast, x);
-                if (std::isnan(log))
-                {
-                    return log;
-                }
-                else
-                {
-                    prevX = x;
-                    prevLog = log;
-
-                    sum += log;
-                }
-            }
-        }
-
-        return sum;
-    }
-
 }
-
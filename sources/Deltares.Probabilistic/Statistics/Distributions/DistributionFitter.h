@@ -31,14 +31,18 @@ namespace Deltares::Statistics
     class DistributionFitter
     {
     public:
+        /**
+         * \brief Indicates whether the grid refinements are replaced by a Nelder-Mead simplex search on a coarser grid
+         */
+        bool UseNelderMead = false;
+
         std::vector<double> fitByLogLikelihood(const std::vector<double>& values, Distribution* distribution,
             StochastProperties& stochast, const std::vector<double>& minimum, const std::vector<double>& maximum,
             const std::vector<DistributionPropertyType>& properties);
     private:
         Distribution* distributionObj = nullptr;
         void getLogLikelihood(Models::ModelSample& sample, const std::vector<double>& values,
-            StochastProperties& stochast, const std::vector<DistributionPropertyType>& properties) const;
-        double getSumLogLikelihood(const std::vector<double>& values, StochastProperties& stochast) const;
+            const StochastProperties& stochast, const std::vector<DistributionPropertyType>& properties) const;
     };
 }
 
@@ -84,6 +84,20 @@ namespace Deltares::Statistics
         return stochast.Shift - log(qu) * stochast.Scale;
     }
 
+    void ExponentialDistribution::getXFromU(StochastProperties& stochast, const double* u, double* x, size_t n)
+    {
+        StandardNormal::getQFromU(u, x, n);
+
+        const double scale = stochast.Scale;
+        const double shift = stochast.Shift;
+
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = shift - log(x[i]) * scale;
+        }
+    }
+
     double ExponentialDistribution::getUFromX(StochastProperties& stochast, double x)
     {
         const double q = exp((stochast.Shift - x) / stochast.Scale);
@@ -114,6 +128,18 @@ namespace Deltares::Statistics
         }
     }
 
+    void ExponentialDistribution::getCDF(StochastProperties& stochast, const double* x, double* p, size_t n)
+    {
+        const double scale = stochast.Scale;
+        const double shift = stochast.Shift;
+
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
+        {
+            p[i] = x[i] < shift ? 0.0 : 1.0 - exp(-(x[i] - shift) / scale);
+        }
+    }
+
     void ExponentialDistribution::setXAtU(StochastProperties& stochast, double x, double u, ConstantParameterType constantType)
     {
         if (constantType == ConstantParameterType::Deviation)
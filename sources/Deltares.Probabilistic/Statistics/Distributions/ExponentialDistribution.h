@@ -30,6 +30,7 @@ namespace Deltares::Statistics
     public:
         void initialize(StochastProperties& stochast, const std::vector<double>& values) override;
         double getXFromU(StochastProperties& stochast, double u) override;
+        void getXFromU(StochastProperties& stochast, const double* u, double* x, size_t n) override;
         double getUFromX(StochastProperties& stochast, double x) override;
         bool isVarying(StochastProperties& stochast) override;
         bool canTruncate() override { return true; }
@@ -41,6 +42,7 @@ namespace Deltares::Statistics
         void setShift(StochastProperties& stochast, const double shift, bool inverted) override;
         double getPDF(StochastProperties& stochast, double x) override;
         double getCDF(StochastProperties& stochast, double x) override;
+        void getCDF(StochastProperties& stochast, const double* x, double* p, size_t n) override;
         void setXAtU(StochastProperties& stochast, double x, double u, ConstantParameterType constantType) override;
         void fit(StochastProperties& stochast, const std::vector<double>& values, const double shift) override;
         double getMaxShiftValue(std::vector<double>& values) override;
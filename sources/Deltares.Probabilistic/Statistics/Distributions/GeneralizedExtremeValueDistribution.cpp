@@ -152,29 +152,43 @@ namespace Deltares::Statistics
 
     void GeneralizedExtremeValueDistribution::fit(StochastProperties& stochast, const std::vector<double>& values, const double shift)
     {
-        double bestGoodness = std::numeric_limits<double>::max();
-        StochastProperties bestStochast;
-        double bestShape = -1;
+        const std::vector<double> shapes = { -1, 0, 1 };
+
+        std::vector<StochastProperties> stochasts(shapes.size());
+        std::vector<std::shared_ptr<Distribution>> distributions;
+        std::vector<KSCandidate> candidates;
+        std::vector<double> candidateShapes;
 
-        for (auto shape : std::vector<double>{ -1, 0, 1 })
+        for (size_t i = 0; i < shapes.size(); i++)
         {
-            auto dStochast = StochastProperties();
-            dStochast.Shape = shape;
+            stochasts[i].Shape = shapes[i];
+
+            std::shared_ptr<Distribution> distribution = getDistribution(stochasts[i]);
+            distributions.push_back(distribution);
+
+            distribution->fit(stochasts[i], values, shift);
+
+            if (!std::isnan(stochasts[i].Shape) && !std::isnan(stochasts[i].Scale))
+            {
+                candidates.push_back(KSCandidate{ distribution.get(), &stochasts[i] });
+                candidateShapes.push_back(shapes[i]);
+            }
+        }
 
-            const std::shared_ptr<Distribution> distribution = getDistribution(dStochast);
+        // all candidates are evaluated in one pass, so that the values are sorted only once
+        const std::vector<double> goodnesses = KSCalculator::getGoodnessOfFits(values, candidates);
 
-            distribution->fit(dStochast, values, shift);
+        double bestGoodness = std::numeric_limits<double>::max();
+        StochastProperties bestStochast;
+        double bestShape = -1;
 
-            if (!std::isnan(dStochast.Shape) && !std::isnan(dStochast.Scale))
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            if (goodnesses[i] < bestGoodness)
             {
-                double goodness = KSCalculator::getGoodnessOfFit(values, *distribution, dStochast);
-
-                if (goodness < bestGoodness)
-                {
-                    bestGoodness = goodness;
-                    bestStochast = dStochast;
-                    bestShape = shape;
-                }
+                bestGoodness = goodnesses[i];
+                bestStochast = *candidates[i].stochast;
+                bestShape = candidateShapes[i];
             }
         }
 
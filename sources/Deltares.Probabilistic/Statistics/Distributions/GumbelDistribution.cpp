@@ -76,6 +76,21 @@ namespace Deltares::Statistics
         }
     }
 
+    void GumbelDistribution::getXFromU(StochastProperties& stochast, const double* u, double* x, size_t n)
+    {
+        StandardNormal::getPFromU(u, x, n);
+
+        const double scale = stochast.Scale;
+        const double shift = stochast.Shift;
+
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
+        {
+            const double p = x[i];
+            x[i] = p == 0.0 ? shift : -log(-log(p)) * scale + shift;
+        }
+    }
+
     double GumbelDistribution::getUFromX(StochastProperties& stochast, double x)
     {
         if (stochast.Scale == 0.0)
@@ -118,6 +133,28 @@ namespace Deltares::Statistics
         }
     }
 
+    void GumbelDistribution::getCDF(StochastProperties& stochast, const double* x, double* p, size_t n)
+    {
+        const double scale = stochast.Scale;
+        const double shift = stochast.Shift;
+
+        if (scale == 0.0)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                p[i] = x[i] < shift ? 0.0 : 1.0;
+            }
+        }
+        else
+        {
+#pragma omp simd
+            for (size_t i = 0; i < n; i++)
+            {
+                p[i] = exp(-exp(-(x[i] - shift) / scale));
+            }
+        }
+    }
+
     void GumbelDistribution::setXAtU(StochastProperties& stochast, double x, double u, ConstantParameterType constantType)
     {
         if (constantType == ConstantParameterType::Deviation)
@@ -175,6 +212,21 @@ namespace Deltares::Statistics
         return -(log(stochast.Scale) + (x + exp(-x)));
     }
 
+    double GumbelDistribution::getSumLogLikelihood(StochastProperties& stochast, const std::vector<double>& values)
+    {
+        const double shift = stochast.Shift;
+        const double scale = stochast.Scale;
+
+        double sum = 0;
+        for (double x : values)
+        {
+            const double z = (x - shift) / scale;
+            sum += z + exp(-z);
+        }
+
+        return -(static_cast<double>(values.size()) * log(scale) + sum);
+    }
+
     std::vector<double> GumbelDistribution::getSpecialPoints(StochastProperties& stochast)
     {
         std::vector<double> specialPoints{ stochast.Shift };
@@ -29,6 +29,7 @@ namespace Deltares::Statistics
     public:
         void initialize(StochastProperties& stochast, const std::vector<double>& values) override;
         double getXFromU(StochastProperties& stochast, double u) override;
+        void getXFromU(StochastProperties& stochast, const double* u, double* x, size_t n) override;
         double getUFromX(StochastProperties& stochast, double x) override;
         bool isVarying(StochastProperties& stochast) override;
         bool canTruncate() override { return true; }
@@ -38,10 +39,12 @@ namespace Deltares::Statistics
         void setMeanAndDeviation(StochastProperties& stochast, double mean, double deviation) override;
         double getPDF(StochastProperties& stochast, double x) override;
         double getCDF(StochastProperties& stochast, double x) override;
+        void getCDF(StochastProperties& stochast, const double* x, double* p, size_t n) override;
         void setXAtU(StochastProperties& stochast, double x, double u, ConstantParameterType constantType) override;
         bool canFit(const bool useShift, const bool usePrior) override { return !usePrior; }
         void fit(StochastProperties& stochast, const std::vector<double>& values, const double shift) override;
         double getLogLikelihood(StochastProperties& stochast, double x) override;
+        double getSumLogLikelihood(StochastProperties& stochast, const std::vector<double>& values) override;
         std::vector<double> getSpecialPoints(StochastProperties& stochast) override;
         std::vector<DistributionPropertyType> getParameters() override
         {
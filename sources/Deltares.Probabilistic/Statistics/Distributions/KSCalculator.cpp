@@ -31,36 +31,122 @@ namespace Deltares::Statistics
     /// @param xValues input values xValues are intentionally copied because they are sorted in this method
     /// @param distribution the distribution object
     /// @param stochast the stochast properties
+    /// @param binCount number of bins, 0 means exact
     /// @return the goodness of fit
-    double KSCalculator::getGoodnessOfFit(std::vector<double> xValues, Distribution& distribution, StochastProperties& stochast)
+    double KSCalculator::getGoodnessOfFit(std::vector<double> xValues, Distribution& distribution, StochastProperties& stochast, int binCount)
     {
-        if (xValues.empty())
+        std::sort(xValues.begin(), xValues.end());
+
+        return getGoodnessOfFitSorted(xValues, distribution, stochast, binCount);
+    }
+
+    double KSCalculator::getGoodnessOfFitSorted(const std::vector<double>& sortedValues, Distribution& distribution, StochastProperties& stochast, int binCount)
+    {
+        const std::vector<KSCandidate> candidates = { KSCandidate{ &distribution, &stochast } };
+
+        return getGoodnessOfFitsSorted(sortedValues, candidates, binCount)[0];
+    }
+
+    /// @param xValues input values xValues are intentionally copied because they are sorted in this method
+    std::vector<double> KSCalculator::getGoodnessOfFits(std::vector<double> xValues, const std::vector<KSCandidate>& candidates, int binCount)
+    {
+        std::sort(xValues.begin(), xValues.end());
+
+        return getGoodnessOfFitsSorted(xValues, candidates, binCount);
+    }
+
+    std::vector<double> KSCalculator::getGoodnessOfFitsSorted(const std::vector<double>& sortedValues, const std::vector<KSCandidate>& candidates, int binCount)
+    {
+        if (sortedValues.empty())
         {
-            return std::nan("");
+            return std::vector<double>(candidates.size(), std::nan(""));
         }
-        else
-        {
-            std::sort(xValues.begin(), xValues.end());
 
-            double size = xValues.size();
+        const std::vector<size_t> indices = getEvaluationIndices(sortedValues.size(), binCount);
+        const bool allValues = indices.size() == sortedValues.size();
+
+        const double size = static_cast<double>(sortedValues.size());
 
-            double ks = 0;
+        std::vector<double> ks(candidates.size(), 0.0);
+        std::vector<double> xBlock(allValues ? 0 : blockSize);
+        std::vector<double> cdf(blockSize);
 
-            for (int i = 0; i < static_cast<int>(xValues.size()); i++)
+        // the values are processed block wise, so that all candidates evaluate the same values while they are still in the cache
+        for (size_t start = 0; start < indices.size(); start += blockSize)
+        {
+            const size_t count = std::min(blockSize, indices.size() - start);
+
+            const double* x = allValues ? sortedValues.data() + start : xBlock.data();
+            if (!allValues)
             {
-                double cdf = distribution.getCDF(stochast, xValues[i]);
+                for (size_t j = 0; j < count; j++)
+                {
+                    xBlock[j] = sortedValues[indices[start + j]];
+                }
+            }
 
-                double diff1 = std::fabs(cdf - i / size);
-                double diff2 = std::fabs(cdf - (i + 1) / size);
+            for (size_t c = 0; c < candidates.size(); c++)
+            {
+                candidates[c].distribution->getCDF(*candidates[c].stochast, x, cdf.data(), count);
 
-                double diff = std::max(diff1, diff2);
-                if (diff > ks)
+                double maxDiff = ks[c];
+                for (size_t j = 0; j < count; j++)
                 {
-                    ks = diff;
+                    const double i = static_cast<double>(indices[start + j]);
+
+                    const double diff1 = std::fabs(cdf[j] - i / size);
+                    const double diff2 = std::fabs(cdf[j] - (i + 1) / size);
+
+                    maxDiff = std::max(maxDiff, std::max(diff1, diff2));
                 }
+
+                ks[c] = maxDiff;
             }
+        }
+
+        return ks;
+    }
 
-            return ks;
+    std::vector<size_t> KSCalculator::getEvaluationIndices(size_t valuesCount, int binCount)
+    {
+        std::vector<size_t> indices;
+
+        if (binCount <= 0 || static_cast<size_t>(binCount) >= valuesCount)
+        {
+            indices.resize(valuesCount);
+            for (size_t i = 0; i < valuesCount; i++)
+            {
+                indices[i] = i;
+            }
+        }
+        else
+        {
+            // first value of each bin and the last value, so that every value lies between two evaluated values
+            const size_t binSize = (valuesCount + binCount - 1) / binCount;
+            for (size_t i = 0; i < valuesCount; i += binSize)
+            {
+                indices.push_back(i);
+            }
+
+            if (indices.back() != valuesCount - 1)
+            {
+                indices.push_back(valuesCount - 1);
+            }
+        }
+
+        return indices;
+    }
+
+    double KSCalculator::getBinningErrorBound(size_t valuesCount, int binCount)
+    {
+        if (binCount <= 0 || static_cast<size_t>(binCount) >= valuesCount)
+        {
+            return 0.0;
+        }
+        else
+        {
+            const size_t binSize = (valuesCount + binCount - 1) / binCount;
+            return static_cast<double>(binSize) / static_cast<double>(valuesCount);
         }
     }
 }
@@ -27,6 +27,15 @@
 
 namespace Deltares::Statistics
 {
+    /**
+     * \brief Combination of a distribution and its stochast properties, which is evaluated by the Kolmogorov-Smirnov test
+     */
+    struct KSCandidate
+    {
+        Distribution* distribution = nullptr;
+        StochastProperties* stochast = nullptr;
+    };
+
     class KSCalculator
     {
     public:
@@ -35,9 +44,45 @@ namespace Deltares::Statistics
          * \param xValues input values 
          * \param distribution Stochastic distribution from which the CDF value is calculated 
          * \param stochast Stochastic variable
+         * \param binCount Number of bins in which the CDF is evaluated, 0 means exact (see getGoodnessOfFitSorted)
          * \return Kolmogorov-Smirnov statistic (0 = perfect match, 1 = worst possible match)) 
          */
-        static double getGoodnessOfFit(std::vector<double> xValues, Distribution& distribution, StochastProperties& stochast);
+        static double getGoodnessOfFit(std::vector<double> xValues, Distribution& distribution, StochastProperties& stochast, int binCount = 0);
+
+        /**
+         * \brief Calculates the Kolmogorov-Smirnov statistic for input values which are already sorted in ascending order
+         * \param sortedValues input values, sorted in ascending order
+         * \param distribution Stochastic distribution from which the CDF value is calculated
+         * \param stochast Stochastic variable
+         * \param binCount Number of bins in which the CDF is evaluated, 0 means exact
+         * \return Kolmogorov-Smirnov statistic (0 = perfect match, 1 = worst possible match))
+         * \remark When binCount is less than the number of values, the CDF is only evaluated at the bin boundaries.
+         *         Since the CDF and the empirical CDF are both non-decreasing, the exact statistic K is bounded by
+         *         K_binned <= K <= K_binned + m / n, where m is the largest number of values in a bin (ceil(n / binCount))
+         *         and n the number of values. So with 1000 bins the statistic is underestimated by at most 0.001.
+         */
+        static double getGoodnessOfFitSorted(const std::vector<double>& sortedValues, Distribution& distribution, StochastProperties& stochast, int binCount = 0);
+
+        /**
+         * \brief Calculates the Kolmogorov-Smirnov statistic for a number of candidates, sorting the input values only once
+         * \param xValues input values
+         * \param candidates Distributions and stochastic variables to be evaluated
+         * \param binCount Number of bins in which the CDF is evaluated, 0 means exact (see getGoodnessOfFitSorted)
+         * \return Kolmogorov-Smirnov statistic per candidate
+         */
+        static std::vector<double> getGoodnessOfFits(std::vector<double> xValues, const std::vector<KSCandidate>& candidates, int binCount = 0);
+
+        /**
+         * \brief Gets the upper bound of the underestimation of the Kolmogorov-Smirnov statistic when bins are used
+         * \param valuesCount Number of values
+         * \param binCount Number of bins, 0 means exact
+         * \return Upper bound of the underestimation (0 when exact)
+         */
+        static double getBinningErrorBound(size_t valuesCount, int binCount);
+    private:
+        static constexpr size_t blockSize = 1024;
+
+        static std::vector<double> getGoodnessOfFitsSorted(const std::vector<double>& sortedValues, const std::vector<KSCandidate>& candidates, int binCount);
+        static std::vector<size_t> getEvaluationIndices(size_t valuesCount, int binCount);
     };
 }
-
@@ -127,6 +127,19 @@ namespace Deltares::Statistics
         return exp(stochast.Location + u * stochast.Scale) + stochast.Shift;
     }
 
+    void LogNormalDistribution::getXFromU(StochastProperties& stochast, const double* u, double* x, size_t n)
+    {
+        const double location = stochast.Location;
+        const double scale = stochast.Scale;
+        const double shift = stochast.Shift;
+
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = exp(location + u[i] * scale) + shift;
+        }
+    }
+
     double LogNormalDistribution::getUFromX(StochastProperties& stochast, double x)
     {
         if (!this->isVarying(stochast))
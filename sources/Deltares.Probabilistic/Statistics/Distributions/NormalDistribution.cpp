@@ -62,6 +62,18 @@ namespace Deltares::Statistics
         return stochast.Location + u * stochast.Scale;
     }
 
+    void NormalDistribution::getXFromU(StochastProperties& stochast, const double* u, double* x, size_t n)
+    {
+        const double location = stochast.Location;
+        const double scale = stochast.Scale;
+
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = location + u[i] * scale;
+        }
+    }
+
     double NormalDistribution::getUFromX(StochastProperties& stochast, double x)
     {
         return (x - stochast.Location) / stochast.Scale;
@@ -85,6 +97,20 @@ namespace Deltares::Statistics
         return StandardNormal::getPFromU(u);
     }
 
+    void NormalDistribution::getCDF(StochastProperties& stochast, const double* x, double* p, size_t n)
+    {
+        const double location = stochast.Location;
+        const double scale = stochast.Scale;
+
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
+        {
+            p[i] = (x[i] - location) / scale;
+        }
+
+        StandardNormal::getPFromU(p, p, n);
+    }
+
     void NormalDistribution::setXAtU(StochastProperties& stochast, double x, double u, ConstantParameterType constantType)
     {
         if (constantType == ConstantParameterType::Deviation)
@@ -108,6 +134,22 @@ namespace Deltares::Statistics
         return log(normalFactor) + distance;
     }
 
+    double NormalDistribution::getSumLogLikelihood(StochastProperties& stochast, const std::vector<double>& values)
+    {
+        // only the sum of squared distances to the location depends on the values
+        double sumSquared = 0;
+        for (double x : values)
+        {
+            const double x0 = x - stochast.Location;
+            sumSquared += x0 * x0;
+        }
+
+        const double sigma = stochast.Scale;
+        const double normalFactor = 1.0 / (sigma * sqrt(2.0 * std::numbers::pi));
+
+        return static_cast<double>(values.size()) * log(normalFactor) - sumSquared / (2.0 * sigma * sigma);
+    }
+
     void NormalDistribution::fit(StochastProperties& stochast, const std::vector<double>& values, const double shift)
     {
         stochast.Location = Numeric::NumericSupport::getMean(values);
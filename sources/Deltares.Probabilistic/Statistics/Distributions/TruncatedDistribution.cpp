@@ -332,6 +332,21 @@ namespace Deltares::Statistics
         }
     }
 
+    double TruncatedDistribution::getSumLogLikelihood(StochastProperties& stochast, const std::vector<double>& values)
+    {
+        // the truncation factor is equal for all values
+        Truncated truncated = getTruncatedValue(stochast);
+
+        if (truncated.Factor == 0 || std::isinf(truncated.Factor) || std::isnan(truncated.Factor))
+        {
+            return nan("");
+        }
+        else
+        {
+            return static_cast<double>(values.size()) * log(truncated.Factor) + this->innerDistribution->getSumLogLikelihood(stochast, values);
+        }
+    }
+
     std::vector<double> TruncatedDistribution::getSpecialPoints(StochastProperties& stochast)
     {
         std::vector<double> specialPoints;
@@ -54,6 +54,7 @@ namespace Deltares::Statistics
         void fitPrior(StochastProperties& stochast, const std::vector<double>& values, StochastProperties& prior, const double shift) override;
         double getMaxShiftValue(std::vector<double>& values) override;
         double getLogLikelihood(StochastProperties& stochast, double x) override;
+        double getSumLogLikelihood(StochastProperties& stochast, const std::vector<double>& values) override;
         std::vector<double> getSpecialPoints(StochastProperties& stochast) override;
         std::vector<DistributionPropertyType> getParameters() override;
     private:
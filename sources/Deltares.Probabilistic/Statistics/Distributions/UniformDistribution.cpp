@@ -75,6 +75,20 @@ namespace Deltares::Statistics
         return stochast.Minimum + p * (stochast.Maximum - stochast.Minimum);
     }
 
+    void UniformDistribution::getXFromU(StochastProperties& stochast, const double* u, double* x, size_t n)
+    {
+        StandardNormal::getPFromU(u, x, n);
+
+        const double minimum = stochast.Minimum;
+        const double range = stochast.Maximum - stochast.Minimum;
+
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i] = minimum + x[i] * range;
+        }
+    }
+
     double UniformDistribution::getUFromX(StochastProperties& stochast, double x)
     {
         if (x <= stochast.Minimum)
@@ -29,6 +29,7 @@ namespace Deltares::Statistics
     public:
         void initialize(StochastProperties& stochast, const std::vector<double>& values) override;
         double getXFromU(StochastProperties& stochast, double u) override;
+        void getXFromU(StochastProperties& stochast, const double* u, double* x, size_t n) override;
         double getUFromX(StochastProperties& stochast, double x) override;
         bool isVarying(StochastProperties& stochast) override;
         double getMean(StochastProperties& stochast) override;
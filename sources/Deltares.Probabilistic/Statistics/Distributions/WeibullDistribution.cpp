@@ -74,6 +74,23 @@ namespace Deltares::Statistics
         }
     }
 
+    void WeibullDistribution::getXFromU(StochastProperties& stochast, const double* u, double* x, size_t n)
+    {
+        StandardNormal::getQFromU(u, x, n);
+
+        const double exponent = 1.0 / stochast.Shape;
+        const double scale = stochast.Scale;
+        const double shift = stochast.Shift;
+
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
+        {
+            // q can be exactly 1 due to numerical limitations in getQFromU
+            const double q = x[i];
+            x[i] = q == 1.0 ? shift : std::pow(-std::log(q), exponent) * scale + shift;
+        }
+    }
+
     double WeibullDistribution::getUFromX(StochastProperties& stochast, double x)
     {
         if (stochast.Scale == 0.0)
@@ -22,7 +22,9 @@
 
 #include "FrankCopula.h"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace Deltares::Statistics
 {
@@ -44,6 +46,45 @@ namespace Deltares::Statistics
         }
     }
 
+    void FrankCopula::update(const double* u, double* t, size_t n) const
+    {
+        constexpr double max_input_exp = 700.0;
+        if (theta > max_input_exp)
+        {
+            std::copy_n(u, n, t);
+        }
+        else if (theta < -max_input_exp)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                t[i] = 1.0 - u[i];
+            }
+        }
+        else
+        {
+            const double expTheta = std::exp(theta);
+
+            // the transcendental functions are kept out of the arithmetic loop, so that the latter is vectorized
+            std::vector<double> values(n);
+            for (size_t i = 0; i < n; i++)
+            {
+                values[i] = std::exp(-theta * u[i]);
+            }
+
+#pragma omp simd
+            for (size_t i = 0; i < n; i++)
+            {
+                const double factor = (t[i] - 1.0) * values[i];
+                values[i] = (factor - t[i]) / (factor * expTheta - t[i]);
+            }
+
+            for (size_t i = 0; i < n; i++)
+            {
+                t[i] = 1.0 + std::log(values[i]) / theta;
+            }
+        }
+    }
+
     void FrankCopula::validate(Logging::ValidationReport& report) const
     {
         if (theta == 0.0)
@@ -34,6 +34,17 @@ namespace Deltares::Statistics
         b = a * rho + b * sqrt(1.0 - rho * rho);
     }
 
+    void GaussianCopula::update_uspace(const double* a, double* b, size_t n) const
+    {
+        const double rhoCompl = sqrt(1.0 - rho * rho);
+
+#pragma omp simd
+        for (size_t i = 0; i < n; i++)
+        {
+            b[i] = a[i] * rho + b[i] * rhoCompl;
+        }
+    }
+
     void GaussianCopula::update(const double& u, double& t) const
     {
         double a = StandardNormal::getUFromP(u);
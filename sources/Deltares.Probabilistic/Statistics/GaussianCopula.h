@@ -36,6 +36,7 @@ namespace Deltares::Statistics
         /// <param name="a"> value of first stochast in u-space </param>
         /// <param name="b"> value of second stochast in u-space </param>
         void update_uspace(const double& a, double& b) const override;
+        void update_uspace(const double* a, double* b, size_t n) const override;
 
         /// <summary>
         /// update a pair of correlated stochastic variables
@@ -77,6 +77,14 @@ namespace Deltares::Statistics
         }
     }
 
+    void GumbelCopula::update(const double* u, double* t, size_t n) const
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            GumbelCopula::update(u[i], t[i]);
+        }
+    }
+
     void GumbelCopula::validate(ValidationReport & report) const
     {
         ValidationSupport::checkMinimum(report, 1.0, theta, "Theta", "Gumbel copula", MessageType::Error);
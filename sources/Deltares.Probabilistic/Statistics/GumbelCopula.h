@@ -30,6 +30,7 @@ namespace Deltares::Statistics
     public:
         explicit GumbelCopula(const double theta) : theta(theta) {}
         void update(const double& u, double& t) const override;
+        void update(const double* u, double* t, size_t n) const override;
         CorrelationValueAndType getCorrelation() const override { return { theta, CorrelationType::Gumbel }; }
         void validate(Logging::ValidationReport& report) const override;
     private:
@@ -0,0 +1,238 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "QuantileSketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <numeric>
+
+namespace Deltares::Statistics
+{
+    QuantileSketch::QuantileSketch(size_t payloadSize, double compression)
+    {
+        this->payloadSize = payloadSize;
+        this->compression = compression;
+    }
+
+    void QuantileSketch::add(double value, double weight, const double* payload)
+    {
+        if (std::isnan(value) || weight <= 0.0)
+        {
+            return;
+        }
+
+        bufferValues.push_back(value);
+        bufferWeights.push_back(weight);
+        for (size_t i = 0; i < payloadSize; i++)
+        {
+            bufferPayloads.push_back(weight * payload[i]);
+        }
+
+        if (bufferValues.size() >= static_cast<size_t>(5 * compression))
+        {
+            compress();
+        }
+    }
+
+    double QuantileSketch::getScale(double q) const
+    {
+        // k1 scale function of the t-digest, centroids are small near q = 0 and q = 1
+        return compression / (2 * std::numbers::pi) * std::asin(2 * std::clamp(q, 0.0, 1.0) - 1);
+    }
+
+    void QuantileSketch::compress()
+    {
+        if (bufferValues.empty())
+        {
+            return;
+        }
+
+        // all centroids and buffered values, sorted by value
+        const size_t nCentroids = means.size();
+        std::vector<double> allMeans = means;
+        std::vector<double> allWeights = weights;
+        std::vector<double> allPayloads = payloads;
+
+        allMeans.insert(allMeans.end(), bufferValues.begin(), bufferValues.end());
+        allWeights.insert(allWeights.end(), bufferWeights.begin(), bufferWeights.end());
+        allPayloads.insert(allPayloads.end(), bufferPayloads.begin(), bufferPayloads.end());
+
+        bufferValues.clear();
+        bufferWeights.clear();
+        bufferPayloads.clear();
+
+        std::vector<size_t> order(allMeans.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin() + nCentroids, order.end(), [&allMeans](size_t a, size_t b) { return allMeans[a] < allMeans[b]; });
+        std::inplace_merge(order.begin(), order.begin() + nCentroids, order.end(), [&allMeans](size_t a, size_t b) { return allMeans[a] < allMeans[b]; });
+
+        totalWeight = 0.0;
+        for (double weight : allWeights)
+        {
+            totalWeight += weight;
+        }
+
+        means.clear();
+        weights.clear();
+        payloads.clear();
+
+        // merge neighbouring values as long as the scale function increases less than one
+        double weightBefore = 0.0;
+        double limit = getScale(0.0) + 1.0;
+
+        for (size_t index : order)
+        {
+            const bool merge = !means.empty() && getScale((weightBefore + allWeights[index]) / totalWeight) <= limit;
+
+            if (merge)
+            {
+                const size_t last = means.size() - 1;
+                weights[last] += allWeights[index];
+                means[last] += (allMeans[index] - means[last]) * allWeights[index] / weights[last];
+                for (size_t i = 0; i < payloadSize; i++)
+                {
+                    payloads[last * payloadSize + i] += allPayloads[index * payloadSize + i];
+                }
+            }
+            else
+            {
+                if (!means.empty())
+                {
+                    limit = getScale(weightBefore / totalWeight) + 1.0;
+                }
+
+                means.push_back(allMeans[index]);
+                weights.push_back(allWeights[index]);
+                for (size_t i = 0; i < payloadSize; i++)
+                {
+                    payloads.push_back(allPayloads[index * payloadSize + i]);
+                }
+            }
+
+            weightBefore += allWeights[index];
+        }
+
+        cumulativeWeights.resize(means.size());
+        double cumulative = 0.0;
+        for (size_t i = 0; i < means.size(); i++)
+        {
+            cumulativeWeights[i] = cumulative;
+            cumulative += weights[i];
+        }
+    }
+
+    double QuantileSketch::getWeight()
+    {
+        compress();
+        return totalWeight;
+    }
+
+    size_t QuantileSketch::getCentroidCount()
+    {
+        compress();
+        return means.size();
+    }
+
+    double QuantileSketch::getCentroidMean(size_t index)
+    {
+        compress();
+        return means[index];
+    }
+
+    double QuantileSketch::getCentroidWeight(size_t index)
+    {
+        compress();
+        return weights[index];
+    }
+
+    const double* QuantileSketch::getCentroidPayload(size_t index)
+    {
+        compress();
+        return payloads.data() + index * payloadSize;
+    }
+
+    double QuantileSketch::getCentroidCumulativeWeight(size_t index)
+    {
+        compress();
+        return cumulativeWeights[index];
+    }
+
+    double QuantileSketch::getQuantile(double p)
+    {
+        compress();
+
+        if (means.empty())
+        {
+            return std::nan("");
+        }
+
+        // the mean of a centroid is located at the center of its weight
+        const double target = p * totalWeight;
+
+        if (target <= weights[0] / 2)
+        {
+            return means[0];
+        }
+
+        for (size_t i = 1; i < means.size(); i++)
+        {
+            const double center = cumulativeWeights[i] + weights[i] / 2;
+            if (target <= center)
+            {
+                const double previousCenter = cumulativeWeights[i - 1] + weights[i - 1] / 2;
+                const double fraction = (target - previousCenter) / (center - previousCenter);
+                return means[i - 1] + fraction * (means[i] - means[i - 1]);
+            }
+        }
+
+        return means.back();
+    }
+
+    double QuantileSketch::getCdf(double value)
+    {
+        compress();
+
+        if (means.empty())
+        {
+            return std::nan("");
+        }
+
+        if (value <= means[0])
+        {
+            return value < means[0] ? 0.0 : weights[0] / 2 / totalWeight;
+        }
+
+        for (size_t i = 1; i < means.size(); i++)
+        {
+            if (value < means[i])
+            {
+                const double previousCenter = cumulativeWeights[i - 1] + weights[i - 1] / 2;
+                const double center = cumulativeWeights[i] + weights[i] / 2;
+                const double fraction = (value - means[i - 1]) / (means[i] - means[i - 1]);
+                return (previousCenter + fraction * (center - previousCenter)) / totalWeight;
+            }
+        }
+
+        return value > means.back() ? 1.0 : 1.0 - weights.back() / 2 / totalWeight;
+    }
+}
@@ -0,0 +1,109 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Deltares::Statistics
+{
+    /**
+     * \brief Streaming weighted quantile sketch (merging t-digest)
+     * \remark Values are collected in a limited number of centroids, which are small in the tails and larger in the center.
+     *         Each centroid can carry a payload of weighted sums of other variables, which are summed when centroids are merged.
+     */
+    class QuantileSketch
+    {
+    public:
+        /**
+         * \brief Constructor
+         * \param payloadSize Number of variables summed per centroid
+         * \param compression Compression parameter, the number of centroids is in the order of this value
+         */
+        explicit QuantileSketch(size_t payloadSize = 0, double compression = 200.0);
+
+        /**
+         * \brief Adds a value
+         * \param value Value
+         * \param weight Weight of the value
+         * \param payload Values of other variables belonging to the value, may be null if the payload size is zero
+         */
+        void add(double value, double weight, const double* payload = nullptr);
+
+        /**
+         * \brief Sum of the weights of all added values
+         */
+        double getWeight();
+
+        /**
+         * \brief Gets the value at a given non exceeding probability
+         */
+        double getQuantile(double p);
+
+        /**
+         * \brief Gets the non exceeding probability of a value
+         */
+        double getCdf(double value);
+
+        /**
+         * \brief Number of centroids
+         */
+        size_t getCentroidCount();
+
+        /**
+         * \brief Weighted mean of the values in a centroid
+         */
+        double getCentroidMean(size_t index);
+
+        /**
+         * \brief Weight of a centroid
+         */
+        double getCentroidWeight(size_t index);
+
+        /**
+         * \brief Weighted sums of the payload variables in a centroid
+         */
+        const double* getCentroidPayload(size_t index);
+
+        /**
+         * \brief Sum of the weights in all centroids before a centroid
+         */
+        double getCentroidCumulativeWeight(size_t index);
+
+    private:
+        size_t payloadSize = 0;
+        double compression = 200.0;
+        double totalWeight = 0.0;
+
+        std::vector<double> means;
+        std::vector<double> weights;
+        std::vector<double> payloads;
+        std::vector<double> cumulativeWeights;
+
+        std::vector<double> bufferValues;
+        std::vector<double> bufferWeights;
+        std::vector<double> bufferPayloads;
+
+        void compress();
+        double getScale(double q) const;
+    };
+}
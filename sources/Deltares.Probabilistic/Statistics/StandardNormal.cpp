@@ -26,6 +26,14 @@
 
 using namespace ASA::conversions;
 
+// The array conversions are compiled for several instruction sets, the best one is selected at runtime.
+// This file is compiled without contraction to fused multiply-add, so that all clones give the same results.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define TARGET_CLONES
+#endif
+
 namespace Deltares::Statistics
 {
     void StandardNormal::normp(const double z, double& p, double& q, double& pdf)
@@ -192,6 +200,226 @@ namespace Deltares::Statistics
         return q;
     }
 
+    /**
+     * \brief Branch free equivalent of normp for a number of values
+     * \param z Values to be converted
+     * \param result Array which will be filled with the probabilities, may be the same as z
+     * \param n Number of values
+     * \param exceeding Indicates whether the exceeding (q) or non-exceeding (p) probability is returned
+     */
+    TARGET_CLONES
+    void StandardNormal::normpTail(const double* z, double* result, size_t n, bool exceeding)
+    {
+        constexpr size_t blockSize = 64;
+
+        constexpr double cutoff = 7.071;
+        constexpr double p0 = 220.2068679123761;
+        constexpr double p1 = 221.2135961699311;
+        constexpr double p2 = 112.0792914978709;
+        constexpr double p3 = 33.91286607838300;
+        constexpr double p4 = 6.373962203531650;
+        constexpr double p5 = 0.7003830644436881;
+        constexpr double p6 = 0.03526249659989109;
+        constexpr double q0 = 440.4137358247522;
+        constexpr double q1 = 793.8265125199484;
+        constexpr double q2 = 637.3336333788311;
+        constexpr double q3 = 296.5642487796737;
+        constexpr double q4 = 86.78073220294608;
+        constexpr double q5 = 16.06417757920695;
+        constexpr double q6 = 1.755667163182642;
+        constexpr double q7 = 0.08838834764831844;
+        constexpr double root2pi = 2.506628274631001;
+
+        double expntl[blockSize];
+
+        for (size_t start = 0; start < n; start += blockSize)
+        {
+            const size_t m = std::min(blockSize, n - start);
+            const double* zb = z + start;
+            double* rb = result + start;
+
+            for (size_t i = 0; i < m; i++)
+            {
+                const double zabs = std::fabs(zb[i]);
+                expntl[i] = std::exp(-0.5 * zabs * zabs);
+            }
+
+#pragma omp simd
+            for (size_t i = 0; i < m; i++)
+            {
+                const double zi = zb[i];
+                const double zabs = std::fabs(zi);
+                const double pdf = expntl[i] / root2pi;
+
+                const double near = expntl[i] * ((((((
+                    p6 * zabs + p5) * zabs + p4) * zabs + p3) * zabs + p2) * zabs + p1) * zabs + p0) /
+                    (((((((q7 * zabs + q6) * zabs + q5) * zabs + q4) * zabs + q3) * zabs + q2) * zabs + q1) * zabs + q0);
+
+                const double far = pdf / (zabs + 1.0 / (zabs + 2.0 / (zabs + 3.0 / (zabs + 4.0 / (zabs + 0.65)))));
+
+                double tail = zabs < cutoff ? near : far;
+                tail = 37.0 < zabs ? 0.0 : tail;
+
+                rb[i] = (zi < 0.0) != exceeding ? tail : 1.0 - tail;
+            }
+        }
+    }
+
+    void StandardNormal::getPFromU(const double* u, double* p, size_t n)
+    {
+        normpTail(u, p, n, false);
+    }
+
+    void StandardNormal::getQFromU(const double* u, double* q, size_t n)
+    {
+        normpTail(u, q, n, true);
+    }
+
+    /**
+     * \brief Branch free equivalent of getUFromQ for a number of values
+     * \param q Probabilities to be converted
+     * \param u Array which will be filled with the u-values, may be the same as q
+     * \param n Number of values
+     * \param exceeding Indicates whether the probabilities are exceeding (q) or non-exceeding (p) probabilities
+     * \remark Values close to 0 or 1 and invalid values are handled by the single value version
+     */
+    TARGET_CLONES
+    void StandardNormal::normalInverse(const double* q, double* u, size_t n, bool exceeding)
+    {
+        constexpr size_t blockSize = 64;
+        constexpr double margin = 1e-35;
+
+        // coefficients of algorithm AS 241, see r8_normal_01_cdf_inverse
+        constexpr double a[8] = {
+          3.3871328727963666080,     1.3314166789178437745e+2,
+          1.9715909503065514427e+3,  1.3731693765509461125e+4,
+          4.5921953931549871457e+4,  6.7265770927008700853e+4,
+          3.3430575583588128105e+4,  2.5090809287301226727e+3 };
+        constexpr double b[8] = {
+          1.0,                       4.2313330701600911252e+1,
+          6.8718700749205790830e+2,  5.3941960214247511077e+3,
+          2.1213794301586595867e+4,  3.9307895800092710610e+4,
+          2.8729085735721942674e+4,  5.2264952788528545610e+3 };
+        constexpr double c[8] = {
+          1.42343711074968357734,     4.63033784615654529590,
+          5.76949722146069140550,     3.64784832476320460504,
+          1.27045825245236838258,     2.41780725177450611770e-1,
+          2.27238449892691845833e-2,  7.74545014278341407640e-4 };
+        constexpr double d[8] = {
+          1.0,                        2.05319162663775882187,
+          1.67638483018380384940,     6.89767334985100004550e-1,
+          1.48103976427480074590e-1,  1.51986665636164571966e-2,
+          5.47593808499534494600e-4,  1.05075007164441684324e-9 };
+        constexpr double e[8] = {
+          6.65790464350110377720,     5.46378491116411436990,
+          1.78482653991729133580,     2.96560571828504891230e-1,
+          2.65321895265761230930e-2,  1.24266094738807843860e-3,
+          2.71155556874348757815e-5,  2.01033439929228813265e-7 };
+        constexpr double f[8] = {
+          1.0,                        5.99832206555887937690e-1,
+          1.36929880922735805310e-1,  1.48753612908506148525e-2,
+          7.86869131145613259100e-4,  1.84631831751005468180e-5,
+          1.42151175831644588870e-7,  2.04426310338993978564e-15 };
+        constexpr double const1 = 0.180625;
+        constexpr double const2 = 1.6;
+        constexpr double split1 = 0.425;
+        constexpr double split2 = 5.0;
+
+        double values[blockSize];
+        double pLow[blockSize];
+        double r[blockSize];
+        bool special[blockSize];
+
+        for (size_t start = 0; start < n; start += blockSize)
+        {
+            const size_t m = std::min(blockSize, n - start);
+            double* ub = u + start;
+
+            // copied, because the output may overwrite the input
+            std::copy(q + start, q + start + m, values);
+
+            bool hasSpecial = false;
+
+            for (size_t i = 0; i < m; i++)
+            {
+                const double qi = values[i];
+
+                // the smallest of the exceeding and non-exceeding probability, the distribution is symmetric
+                pLow[i] = qi > 0.5 ? 1.0 - qi : qi;
+
+                // values close to 0 or 1, outside [0, 1] or nan
+                special[i] = !(qi >= margin && 1.0 - qi >= margin);
+                hasSpecial = hasSpecial || special[i];
+
+                r[i] = std::sqrt(-std::log(special[i] ? 0.5 : pLow[i]));
+            }
+
+#pragma omp simd
+            for (size_t i = 0; i < m; i++)
+            {
+                const double qi = values[i];
+                const double qq = pLow[i] - 0.5;
+
+                const double rc = const1 - qq * qq;
+                double num = 0.0;
+                double den = 0.0;
+                for (int k = 7; k >= 0; k--)
+                {
+                    num = num * rc + a[k];
+                    den = den * rc + b[k];
+                }
+                const double central = qq * num / den;
+
+                const double rm = r[i] - const2;
+                double numM = 0.0;
+                double denM = 0.0;
+                for (int k = 7; k >= 0; k--)
+                {
+                    numM = numM * rm + c[k];
+                    denM = denM * rm + d[k];
+                }
+
+                const double rt = r[i] - split2;
+                double numT = 0.0;
+                double denT = 0.0;
+                for (int k = 7; k >= 0; k--)
+                {
+                    numT = numT * rt + e[k];
+                    denT = denT * rt + f[k];
+                }
+
+                const double tail = r[i] <= split2 ? -(numM / denM) : -(numT / denT);
+                const double value = std::fabs(qq) <= split1 ? central : tail;
+
+                const double beta = qi > 0.5 ? value : -value;
+
+                // the u-value of a non-exceeding probability p is minus the u-value of exceeding probability p
+                ub[i] = exceeding ? beta : -beta;
+            }
+
+            if (hasSpecial)
+            {
+                for (size_t i = 0; i < m; i++)
+                {
+                    if (special[i])
+                    {
+                        ub[i] = exceeding ? getUFromQ(values[i]) : getUFromP(values[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    void StandardNormal::getUFromP(const double* p, double* u, size_t n)
+    {
+        normalInverse(p, u, n, false);
+    }
+
+    void StandardNormal::getUFromQ(const double* q, double* u, size_t n)
+    {
+        normalInverse(q, u, n, true);
+    }
+
     double StandardNormal::getUFromPQ(const PQ& pq)
     {
         return getUFromQ(pq.q);
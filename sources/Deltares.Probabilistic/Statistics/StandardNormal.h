@@ -21,6 +21,8 @@
 //
 #pragma once
 
+#include <cstddef>
+
 namespace Deltares::Statistics
 {
     /**
@@ -46,6 +48,8 @@ namespace Deltares::Statistics
     {
     private:
         static void normp(const double z, double& p, double& q, double& pdf);
+        static void normpTail(const double* z, double* result, size_t n, bool exceeding);
+        static void normalInverse(const double* q, double* u, size_t n, bool exceeding);
         static constexpr double qMin = 1.0e-300;
 
     public:
@@ -63,6 +67,42 @@ namespace Deltares::Statistics
         static double getFreqFromU(const double u);
         static double getLogQFromU(const double u);
 
+        /**
+         * \brief Gets the non-exceeding probabilities for a number of u-values
+         * \param u Array of u-values
+         * \param p Array which will be filled with the non-exceeding probabilities, may be the same as u
+         * \param n Number of values
+         * \remark Equal to the single value version within a few ULP
+         */
+        static void getPFromU(const double* u, double* p, size_t n);
+
+        /**
+         * \brief Gets the exceeding probabilities for a number of u-values
+         * \param u Array of u-values
+         * \param q Array which will be filled with the exceeding probabilities, may be the same as u
+         * \param n Number of values
+         * \remark Equal to the single value version within a few ULP
+         */
+        static void getQFromU(const double* u, double* q, size_t n);
+
+        /**
+         * \brief Gets the u-values for a number of non-exceeding probabilities
+         * \param p Array of non-exceeding probabilities
+         * \param u Array which will be filled with the u-values, may be the same as p
+         * \param n Number of values
+         * \remark Equal to the single value version within a few ULP
+         */
+        static void getUFromP(const double* p, double* u, size_t n);
+
+        /**
+         * \brief Gets the u-values for a number of exceeding probabilities
+         * \param q Array of exceeding probabilities
+         * \param u Array which will be filled with the u-values, may be the same as q
+         * \param n Number of values
+         * \remark Equal to the single value version within a few ULP
+         */
+        static void getUFromQ(const double* q, double* u, size_t n);
+
         /**
          * \brief Maximum allowed beta value, due to numerical limitations
          */
@@ -85,6 +85,11 @@ namespace Deltares::Statistics
         return distribution->getXFromU(*properties, u);
     }
 
+    void Stochast::getXFromU(const double* u, double* x, size_t n)
+    {
+        distribution->getXFromU(*properties, u, x, n);
+    }
+
     double Stochast::getUFromX(double x)
     {
         return distribution->getUFromX(*properties, x);
@@ -686,6 +691,17 @@ namespace Deltares::Statistics
         return KSCalculator::getGoodnessOfFit(values, *distribution, *properties);
     }
 
+    std::vector<double> Stochast::getKSTests(const std::vector<double>& values, const std::vector<std::shared_ptr<Stochast>>& stochasts, int binCount)
+    {
+        std::vector<KSCandidate> candidates;
+        for (const std::shared_ptr<Stochast>& stochast : stochasts)
+        {
+            candidates.push_back(KSCandidate{ stochast->distribution.get(), stochast->properties.get() });
+        }
+
+        return KSCalculator::getGoodnessOfFits(values, candidates, binCount);
+    }
+
     std::shared_ptr<Stochast> Stochast::getVariableStochast(double x)
     {
         std::shared_ptr<Stochast> stochast = std::make_shared<Stochast>(distributionType, ValueSet->getInterpolatedStochast(x));
@@ -146,6 +146,14 @@ namespace Deltares::Statistics
          */
         double getXFromU(double u) override;
 
+        /**
+         * \brief Gets the x-values corresponding to a number of u-values
+         * \param u Array of u-values
+         * \param x Array which will be filled with the x-values
+         * \param n Number of values
+         */
+        void getXFromU(const double* u, double* x, size_t n);
+
         /**
          * \brief Gets the u-value corresponding to a given x-value
          * \param x Given x-value
@@ -405,6 +413,15 @@ namespace Deltares::Statistics
          */
         double getKSTest(const std::vector<double>& values) const;
 
+        /**
+         * \brief Calculates the Kolmogorov-Smirnov statistic for a number of stochasts, the values are sorted only once
+         * \param values Given set of x-values
+         * \param stochasts Stochasts to be evaluated
+         * \param binCount Number of bins in which the CDF is evaluated, 0 means exact (see KSCalculator::getGoodnessOfFitSorted)
+         * \return Kolmogorov-Smirnov statistic per stochast
+         */
+        static std::vector<double> getKSTests(const std::vector<double>& values, const std::vector<std::shared_ptr<Stochast>>& stochasts, int binCount = 0);
+
         /**
          * \brief Gets a number of interesting x-values
          * \remark This method is used when plotting PDF and CDF
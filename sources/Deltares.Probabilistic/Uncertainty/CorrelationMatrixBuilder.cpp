@@ -20,6 +20,10 @@
 // All rights reserved.
 //
 #include "CorrelationMatrixBuilder.h"
+#include "../Statistics/StandardNormal.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace Deltares::Uncertainty
 {
@@ -30,7 +34,7 @@ namespace Deltares::Uncertainty
 
     void CorrelationMatrixBuilder::registerSamples(const std::shared_ptr<Statistics::Stochast> stochast, const std::vector<double>& values)
     {
-        this->stochasts.push_back(stochast);
+        this->outputStochasts.push_back(stochast);
 
         stochast->initializeForRun();
 
@@ -38,10 +42,24 @@ namespace Deltares::Uncertainty
 
         for (size_t i = 0; i < values.size(); i++)
         {
-            uValues.push_back(stochast->getUFromX(values[i]));
+            const double u = stochast->getUFromX(values[i]);
+            uValues.push_back(RankCorrelation ? Statistics::StandardNormal::getPFromU(u) : u);
         }
 
-        this->stochastValues[stochast] = uValues;
+        this->outputValues.push_back(uValues);
+
+        // the input values of the first run are used for the correlations between inputs
+        flushInputValues();
+        if (!inputStochasts.empty())
+        {
+            inputsCompleted = true;
+        }
+
+        this->inputOutputCorrelations.push_back(RankCorrelation ? getInputOutputRankCorrelations(stochast) : getInputOutputCorrelations(stochast));
+        this->outputSketch = nullptr;
+        this->runValues.clear();
+        this->runZValues.clear();
+        this->runWeights.clear();
     };
 
     void CorrelationMatrixBuilder::registerWeightedValues(const std::shared_ptr<Statistics::Stochast>& stochast, const std::vector<Numeric::WeightedValue>& weightedValues)
@@ -59,56 +77,235 @@ namespace Deltares::Uncertainty
         registerSamples(stochast, values);
     }
 
-    void CorrelationMatrixBuilder::registerStochastValue(std::shared_ptr<Statistics::Stochast> stochast, double u)
+    void CorrelationMatrixBuilder::registerStochastValues(const std::vector<std::shared_ptr<Statistics::Stochast>>& stochasts, const std::vector<double>& uValues, double z, double weight)
     {
-        if (!this->stochastValues.contains(stochast))
+        if (inputStochasts.empty())
         {
-            this->stochasts.push_back(stochast);
-            this->stochastValues[stochast] = std::vector<double>();
+            inputStochasts = stochasts;
+            inputAccumulator = Statistics::CovarianceAccumulator(stochasts.size());
         }
 
-        this->stochastValues[stochast].push_back(u);
+        std::vector<double> values = uValues;
+        if (RankCorrelation)
+        {
+            Statistics::StandardNormal::getPFromU(uValues.data(), values.data(), uValues.size());
+        }
+
+        if (!inputsCompleted)
+        {
+            pendingValues.insert(pendingValues.end(), values.begin(), values.end());
+            pendingWeights.push_back(weight);
+
+            if (pendingWeights.size() >= ChunkSize)
+            {
+                flushInputValues();
+            }
+        }
+
+        if (RankCorrelation)
+        {
+            if (outputSketch == nullptr)
+            {
+                outputSketch = std::make_shared<Statistics::QuantileSketch>(values.size());
+            }
+
+            outputSketch->add(z, weight, values.data());
+        }
+        else
+        {
+            runValues.insert(runValues.end(), values.begin(), values.end());
+            runZValues.push_back(z);
+            runWeights.push_back(weight);
+        }
     }
 
-    double CorrelationMatrixBuilder::getCorrelationValue(std::shared_ptr<Statistics::Stochast> x, std::shared_ptr<Statistics::Stochast> y)
+    void CorrelationMatrixBuilder::flushInputValues()
     {
-        double sumCross = 0;
-        double sumProducts2X = 0;
-        double sumProducts2Y = 0;
+        if (!pendingWeights.empty())
+        {
+            inputAccumulator.add(pendingValues.data(), pendingWeights.data(), pendingWeights.size());
+            pendingValues.clear();
+            pendingWeights.clear();
+        }
+    }
 
-        std::vector<double> xValues = this->stochastValues[x];
-        std::vector<double> yValues = this->stochastValues[y];
+    std::vector<double> CorrelationMatrixBuilder::getInputOutputCorrelations(const std::shared_ptr<Statistics::Stochast>& stochast)
+    {
+        const size_t nInputs = inputStochasts.size();
+        const size_t count = runWeights.size();
 
-        for (size_t i = 0; i < std::min(xValues.size(), yValues.size()); i++)
+        if (count == 0)
         {
-            double weight = weights.empty() ? 1.0 : weights[i];
+            return std::vector<double>(nInputs, std::nan(""));
+        }
 
-            sumCross += weight * xValues[i] * yValues[i];
-            sumProducts2X += weight * xValues[i] * xValues[i];
-            sumProducts2Y += weight * yValues[i] * yValues[i];
+        // rows of the input values followed by the output value in u-space
+        const size_t nValues = nInputs + 1;
+        std::vector<double> rows(count * nValues);
+        for (size_t j = 0; j < count; j++)
+        {
+            std::copy_n(&runValues[j * nInputs], nInputs, &rows[j * nValues]);
+            rows[j * nValues + nInputs] = stochast->getUFromX(runZValues[j]);
         }
 
-        double correlationCoefficient = sumCross / std::sqrt(sumProducts2X * sumProducts2Y);
+        Statistics::CovarianceAccumulator accumulator(nValues);
+        accumulator.add(rows.data(), runWeights.data(), count);
+
+        std::vector<double> correlations(nInputs);
+        for (size_t i = 0; i < nInputs; i++)
+        {
+            correlations[i] = accumulator.getCorrelation(i, nInputs);
+        }
 
-        return correlationCoefficient;
+        return correlations;
+    }
+
+    std::vector<double> CorrelationMatrixBuilder::getInputOutputRankCorrelations(const std::shared_ptr<Statistics::Stochast>& stochast)
+    {
+        const size_t nInputs = inputStochasts.size();
+
+        if (outputSketch == nullptr || outputSketch->getWeight() <= 0.0)
+        {
+            return std::vector<double>(nInputs, std::nan(""));
+        }
+
+        const size_t nCentroids = outputSketch->getCentroidCount();
+        const double totalWeight = outputSketch->getWeight();
+
+        // output value of each centroid, in u-space or as rank
+        std::vector<double> outputs(nCentroids);
+        double outputMean = 0.0;
+        std::vector<double> inputMeans(nInputs, 0.0);
+
+        for (size_t k = 0; k < nCentroids; k++)
+        {
+            if (RankCorrelation)
+            {
+                outputs[k] = (outputSketch->getCentroidCumulativeWeight(k) + outputSketch->getCentroidWeight(k) / 2) / totalWeight;
+            }
+            else
+            {
+                outputs[k] = stochast->getUFromX(outputSketch->getCentroidMean(k));
+            }
+
+            outputMean += outputSketch->getCentroidWeight(k) * outputs[k];
+
+            const double* payload = outputSketch->getCentroidPayload(k);
+            for (size_t i = 0; i < nInputs; i++)
+            {
+                inputMeans[i] += payload[i];
+            }
+        }
+
+        outputMean /= totalWeight;
+        for (size_t i = 0; i < nInputs; i++)
+        {
+            inputMeans[i] /= totalWeight;
+        }
+
+        double outputVariance = 0.0;
+        std::vector<double> covariances(nInputs, 0.0);
+
+        for (size_t k = 0; k < nCentroids; k++)
+        {
+            const double weight = outputSketch->getCentroidWeight(k);
+            const double delta = outputs[k] - outputMean;
+            const double* payload = outputSketch->getCentroidPayload(k);
+
+            outputVariance += weight * delta * delta;
+            for (size_t i = 0; i < nInputs; i++)
+            {
+                covariances[i] += delta * (payload[i] - weight * inputMeans[i]);
+            }
+        }
+
+        outputVariance /= totalWeight;
+
+        std::vector<double> correlations(nInputs, 0.0);
+        for (size_t i = 0; i < nInputs; i++)
+        {
+            const double variance = outputVariance * inputAccumulator.getCovariance(i, i);
+            if (variance > 0.0)
+            {
+                correlations[i] = std::clamp(covariances[i] / totalWeight / std::sqrt(variance), -1.0, 1.0);
+            }
+        }
+
+        return correlations;
+    }
+
+    Statistics::CovarianceAccumulator CorrelationMatrixBuilder::getOutputAccumulator() const
+    {
+        const size_t nOutputs = outputValues.size();
+
+        size_t count = outputValues.empty() ? 0 : outputValues[0].size();
+        for (const std::vector<double>& values : outputValues)
+        {
+            count = std::min(count, values.size());
+        }
+
+        if (!weights.empty())
+        {
+            count = std::min(count, weights.size());
+        }
+
+        std::vector<double> rows(count * nOutputs);
+        for (size_t j = 0; j < nOutputs; j++)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                rows[i * nOutputs + j] = outputValues[j][i];
+            }
+        }
+
+        std::vector<double> rowWeights = weights.empty() ? std::vector<double>(count, 1.0) : std::vector<double>(weights.begin(), weights.begin() + count);
+
+        Statistics::CovarianceAccumulator accumulator(nOutputs);
+        accumulator.add(rows.data(), rowWeights.data(), count);
+
+        return accumulator;
     }
 
     std::shared_ptr<Statistics::CorrelationMatrix> CorrelationMatrixBuilder::getCorrelationMatrix()
     {
+        flushInputValues();
+
+        std::vector<std::shared_ptr<Statistics::Stochast>> stochasts = inputStochasts;
+        stochasts.insert(stochasts.end(), outputStochasts.begin(), outputStochasts.end());
+
         std::shared_ptr<Statistics::CorrelationMatrix> correlationMatrix = std::make_shared<Statistics::CorrelationMatrix>(true);
 
-        correlationMatrix->Init(this->stochasts);
+        correlationMatrix->Init(stochasts);
 
-        for (size_t i = 0; i < stochasts.size(); i++)
+        for (size_t i = 0; i < inputStochasts.size(); i++)
         {
             for (size_t j = 0; j < i; j++)
             {
-                double correlationValue = this->getCorrelationValue(stochasts[i], stochasts[j]);
-                correlationMatrix->SetCorrelation(stochasts[i], stochasts[j], correlationValue, CorrelationType::Gaussian);
+                correlationMatrix->SetCorrelation(inputStochasts[i], inputStochasts[j], inputAccumulator.getCorrelation(i, j), CorrelationType::Gaussian);
+            }
+        }
+
+        for (size_t k = 0; k < outputStochasts.size(); k++)
+        {
+            for (size_t i = 0; i < inputStochasts.size(); i++)
+            {
+                if (!std::isnan(inputOutputCorrelations[k][i]))
+                {
+                    correlationMatrix->SetCorrelation(outputStochasts[k], inputStochasts[i], inputOutputCorrelations[k][i], CorrelationType::Gaussian);
+                }
+            }
+        }
+
+        const Statistics::CovarianceAccumulator outputAccumulator = getOutputAccumulator();
+
+        for (size_t k = 0; k < outputStochasts.size(); k++)
+        {
+            for (size_t l = 0; l < k; l++)
+            {
+                correlationMatrix->SetCorrelation(outputStochasts[k], outputStochasts[l], outputAccumulator.getCorrelation(k, l), CorrelationType::Gaussian);
             }
         }
 
         return correlationMatrix;
     }
 }
-
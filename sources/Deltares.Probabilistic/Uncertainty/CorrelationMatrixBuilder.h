@@ -24,12 +24,25 @@
 #include <memory>
 
 #include "../Statistics/CorrelationMatrix.h"
+#include "../Statistics/CovarianceAccumulator.h"
+#include "../Statistics/QuantileSketch.h"
 
 namespace Deltares::Uncertainty
 {
+    /**
+     * \brief Builds the correlation matrix of the input and output values of uncertainty calculations
+     * \remark Input values are streamed into a covariance accumulator (input pairs). For input and output pairs, the input values
+     *         of the current run are kept until the output stochast is known, so that the Pearson correlations are exact.
+     *         Rank correlations use a quantile sketch on the output value of the current run instead. The output values are stored.
+     */
     class CorrelationMatrixBuilder
     {
     public:
+        /**
+         * \brief Indicates whether rank (Spearman) correlations are calculated instead of Pearson correlations in u-space
+         */
+        bool RankCorrelation = false;
+
         /**
          * \brief Registers weights for all samples
          */
@@ -39,6 +52,7 @@ namespace Deltares::Uncertainty
          * \brief Registers the sample values of an uncertainty calculation
          * \param stochast The model for which the sensitivity is calculated
          * \param values sample values
+         * \remark Completes the input values registered since the previous call
          */
         void registerSamples(const std::shared_ptr<Statistics::Stochast> stochast, const std::vector<double>& values);
 
@@ -50,10 +64,13 @@ namespace Deltares::Uncertainty
         void registerWeightedValues(const std::shared_ptr<Statistics::Stochast>& stochast, const std::vector<Numeric::WeightedValue>& weightedValues);
 
         /**
-         * \brief Registers the sample input values
-         * \param stochast sample values
+         * \brief Registers the input values of a sample
+         * \param stochasts Input stochasts, the same for all samples
+         * \param uValues u-values, one for each input stochast
+         * \param z Output value of the sample
+         * \param weight Weight of the sample
          */
-        void registerStochastValue(std::shared_ptr<Statistics::Stochast> stochast, double u);
+        void registerStochastValues(const std::vector<std::shared_ptr<Statistics::Stochast>>& stochasts, const std::vector<double>& uValues, double z, double weight);
 
         /**
          * \brief Creates a correlation matrix for all registered stochasts
@@ -67,23 +84,52 @@ namespace Deltares::Uncertainty
          */
         bool isEmpty() const
         {
-            return stochasts.empty();
+            return inputStochasts.empty() && outputStochasts.empty();
         }
 
+        /**
+         * \brief Number of input rows which are collected before they are added to the covariance accumulator
+         */
+        static constexpr size_t ChunkSize = 4096;
+
     private:
-        bool containsInputValues = false;
-        std::vector< std::shared_ptr<Statistics::Stochast>> stochasts;
+        std::vector<std::shared_ptr<Statistics::Stochast>> inputStochasts;
+        std::vector<std::shared_ptr<Statistics::Stochast>> outputStochasts;
         std::vector<double> weights;
-        std::unordered_map<std::shared_ptr<Statistics::Stochast>, std::vector<double>> stochastValues;
+
+        bool inputsCompleted = false;
+        Statistics::CovarianceAccumulator inputAccumulator;
+        std::vector<double> pendingValues;
+        std::vector<double> pendingWeights;
+
+        std::shared_ptr<Statistics::QuantileSketch> outputSketch = nullptr;
+        std::vector<double> runValues;
+        std::vector<double> runZValues;
+        std::vector<double> runWeights;
+
+        std::vector<std::vector<double>> outputValues;
+        std::vector<std::vector<double>> inputOutputCorrelations;
+
+        void flushInputValues();
+
+        /**
+         * \brief Calculates the correlations between all input stochasts and the output of the current run
+         * \param stochast Output stochast of the current run
+         * \return Correlation values, one per input stochast
+         */
+        std::vector<double> getInputOutputCorrelations(const std::shared_ptr<Statistics::Stochast>& stochast);
 
         /**
-         * \brief Calculates the correlation value between wo stochasts
-         * \param x First stochast
-         * \param y Second stochast
-         * \return Correlation value
+         * \brief Calculates the rank correlations between all input stochasts and the output of the current run from the quantile sketch
+         * \param stochast Output stochast of the current run
+         * \return Correlation values, one per input stochast
+         */
+        std::vector<double> getInputOutputRankCorrelations(const std::shared_ptr<Statistics::Stochast>& stochast);
+
+        /**
+         * \brief Accumulates the covariances between all registered outputs
          * \remark See https://en.wikipedia.org/wiki/Pearson_correlation_coefficient
          */
-        double getCorrelationValue(std::shared_ptr<Statistics::Stochast> x, std::shared_ptr<Statistics::Stochast> y);
+        Statistics::CovarianceAccumulator getOutputAccumulator() const;
     };
 }
-
@@ -53,47 +53,72 @@ namespace Deltares::Uncertainty
         size_t zIndex = 0;
         int nSamples = 0;
 
-        bool registerSamplesForCorrelation = this->correlationMatrixBuilder->isEmpty() && this->Settings->CalculateCorrelations && this->Settings->CalculateInputCorrelations;
+        bool registerSamplesForCorrelation = this->Settings->CalculateCorrelations && this->Settings->CalculateInputCorrelations;
 
         const int requiredSamples = std::clamp(Settings->getRequiredSamples(), Settings->MinimumSamples, Settings->MaximumSamples);
 
-        for (int sampleIndex = 0; sampleIndex < requiredSamples && !isStopped(); sampleIndex++)
+        auto processSample = [&](const std::shared_ptr<Sample>& sample)
         {
-            zIndex++;
-
-            if (zIndex >= samples.size())
-            {
-                samples.clear();
-
-                int chunkSize = modelRunner->Settings->MaxChunkSize;
-                int runs = std::min(chunkSize, Settings->MaximumSamples - sampleIndex);
-
-                for (int i = 0; i < runs; i++)
-                {
-                    std::shared_ptr<Sample> sample = randomSampleGenerator.getRandomSample();
-                    samples.push_back(sample);
-                }
-
-                modelRunner->getZValues(samples);
-
-                zIndex = 0;
-            }
-
-            double z = samples[zIndex]->Z;
+            double z = sample->Z;
 
             if (std::isnan(z))
             {
-                continue;
+                return;
             }
 
             zSamples.push_back(z);
 
             if (registerSamplesForCorrelation)
             {
-                modelRunner->registerSample(this->correlationMatrixBuilder, samples[zIndex]);
+                modelRunner->registerSample(this->correlationMatrixBuilder, sample);
             }
 
             nSamples++;
+        };
+
+        if (modelRunner->canStreamZValues())
+        {
+            int providedSamples = 0;
+
+            modelRunner->getZValuesStreamed(
+                [&]() -> std::shared_ptr<Sample>
+                {
+                    if (providedSamples >= requiredSamples || isStopped())
+                    {
+                        return nullptr;
+                    }
+
+                    providedSamples++;
+                    return randomSampleGenerator.getRandomSample();
+                },
+                [&](const std::shared_ptr<Sample>& sample)
+                {
+                    processSample(sample);
+                    return !isStopped();
+                });
+        }
+        else
+        {
+            for (int sampleIndex = 0; sampleIndex < requiredSamples && !isStopped(); sampleIndex++)
+            {
+                zIndex++;
+
+                if (zIndex >= samples.size())
+                {
+                    samples.clear();
+
+                    int chunkSize = modelRunner->Settings->MaxChunkSize;
+                    int runs = std::min(chunkSize, Settings->MaximumSamples - sampleIndex);
+
+                    samples = randomSampleGenerator.getRandomSamples(runs);
+
+                    modelRunner->getZValues(samples);
+
+                    zIndex = 0;
+                }
+
+                processSample(samples[zIndex]);
+            }
         }
 
         auto zWeights = std::vector(zSamples.size(), 1.0);
@@ -110,10 +135,7 @@ namespace Deltares::Uncertainty
             if (quantileIndex >= 0)
             {
                 // perform the sampling again and recalculate
-                randomSampleGenerator.restart();
-                randomSampleGenerator.proceed(quantileIndex);
-
-                std::shared_ptr<Sample> sample = randomSampleGenerator.getRandomSample();
+                std::shared_ptr<Sample> sample = randomSampleGenerator.getRandomSample(quantileIndex);
                 auto evaluation = std::make_shared<Evaluation>(modelRunner->getEvaluation(sample));
                 evaluation->Quantile = p;
                 result.quantileEvaluations.push_back(evaluation);
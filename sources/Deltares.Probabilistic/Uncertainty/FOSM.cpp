@@ -58,7 +58,7 @@ namespace Deltares::Uncertainty
         nextSample = nextSample->getNormalizedSample();
         double z1 = modelRunner->getZValue(nextSample);
 
-        if (this->correlationMatrixBuilder->isEmpty() && this->Settings->CalculateCorrelations && this->Settings->CalculateInputCorrelations)
+        if (this->Settings->CalculateCorrelations && this->Settings->CalculateInputCorrelations)
         {
             modelRunner->registerSample(this->correlationMatrixBuilder, nextSample);
         }
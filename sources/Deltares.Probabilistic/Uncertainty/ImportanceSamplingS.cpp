@@ -63,7 +63,7 @@ namespace Deltares::Uncertainty
         double sumWeights = 0;
         std::vector<std::shared_ptr<Sample>> allSamples;
 
-        bool registerSamplesForCorrelation = this->correlationMatrixBuilder->isEmpty() && this->Settings->CalculateCorrelations && this->Settings->CalculateInputCorrelations;
+        bool registerSamplesForCorrelation = this->Settings->CalculateCorrelations && this->Settings->CalculateInputCorrelations;
 
         std::shared_ptr<Sample> center = Settings->StochastSet->getStartPoint();
 
@@ -83,9 +83,8 @@ namespace Deltares::Uncertainty
                 int chunkSize = modelRunner->Settings->MaxChunkSize;
                 int runs = std::min(chunkSize, Settings->MaximumSamples - sampleIndex);
 
-                for (int i = 0; i < runs; i++)
+                for (const std::shared_ptr<Sample>& sample : randomSampleGenerator.getRandomSamples(runs))
                 {
-                    std::shared_ptr<Sample> sample = randomSampleGenerator.getRandomSample();
                     std::shared_ptr<Sample> modifiedSample = getModifiedSample(*sample, *center);
                     samples.push_back(modifiedSample);
                 }
@@ -155,10 +154,7 @@ namespace Deltares::Uncertainty
             if (quantile_index >= 0)
             {
                 // perform the sampling again and recalculate
-                randomSampleGenerator.restart();
-                randomSampleGenerator.proceed(quantile_index);
-
-                std::shared_ptr<Sample> sample = randomSampleGenerator.getRandomSample();
+                std::shared_ptr<Sample> sample = randomSampleGenerator.getRandomSample(quantile_index);
                 std::shared_ptr<Sample> modifiedSample = getModifiedSample(*sample, *center);
                 auto evaluation = std::make_shared<Evaluation>(modelRunner->getEvaluation(modifiedSample));
                 evaluation->Quantile = p;
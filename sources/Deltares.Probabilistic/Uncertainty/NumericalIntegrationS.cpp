@@ -63,7 +63,7 @@ namespace Deltares::Uncertainty
         constexpr int nSamples = 1; // number of samples
         constexpr int stochastIndex = 0; // number of the stochastic parameter
         auto root_sample = Sample(nStochasts); //local vector with values in u-space
-        bool registerSamplesForCorrelation = correlationMatrixBuilder->isEmpty() && Settings->CalculateCorrelations && Settings->CalculateInputCorrelations;
+        bool registerSamplesForCorrelation = Settings->CalculateCorrelations && Settings->CalculateInputCorrelations;
 
         std::vector<Numeric::WeightedValue> samples = collectSamples(*modelRunner, stochastIndex, root_sample, density, nSamples, registerSamplesForCorrelation);
 
@@ -58,6 +58,11 @@ namespace Deltares::Uncertainty
          */
         bool CalculateInputCorrelations = false;
 
+        /**
+         * \brief Indicates whether rank (Spearman) correlations should be calculated instead of correlations in u-space
+         */
+        bool CalculateRankCorrelations = false;
+
         /**
          * \brief The minimum u value
          */
@@ -53,6 +53,11 @@ namespace Deltares::Uncertainty
          */
         virtual std::shared_ptr<Statistics::CorrelationMatrix> getCorrelationMatrix() { return this->correlationMatrixBuilder->getCorrelationMatrix(); }
 
+        /**
+         * \brief Indicates whether the correlation matrix contains rank (Spearman) correlations
+         */
+        void setRankCorrelation(bool rankCorrelation) { this->correlationMatrixBuilder->RankCorrelation = rankCorrelation; }
+
         /**
          * \brief Indicates whether the calculation has been stopped
          */
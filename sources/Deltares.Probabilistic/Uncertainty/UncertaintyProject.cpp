@@ -33,6 +33,7 @@ namespace Deltares::Uncertainty
         settings->RandomSettings->setFixed(true);
 
         uncertaintyMethod = settings->GetUncertaintyMethod();
+        uncertaintyMethod->setRankCorrelation(settings->CalculateRankCorrelations);
         runSettings = settings->RunSettings;
 
         if (model->outputParameters.empty())
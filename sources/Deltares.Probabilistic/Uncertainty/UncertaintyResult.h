@@ -24,6 +24,7 @@
 
 #include "../Statistics/Stochast.h"
 #include "../Model/Evaluation.h"
+#include "../Model/EvaluationList.h"
 #include "../Logging/Message.h"
 
 namespace Deltares::Uncertainty
@@ -55,7 +56,7 @@ namespace Deltares::Uncertainty
         /**
          * \brief List of evaluations calculated during uncertainty analysis
          */
-        std::vector<std::shared_ptr<Models::Evaluation>> evaluations;
+        Models::EvaluationList evaluations;
 
         /**
          * \brief List of messages raised during uncertainty analysis
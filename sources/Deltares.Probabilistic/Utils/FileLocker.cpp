@@ -0,0 +1,102 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "FileLocker.h"
+#include "probLibException.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+namespace Deltares::Utils
+{
+#ifdef _WIN32
+    FileLocker::FileLocker(const std::string& fileName)
+    {
+        HANDLE fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+            nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            throw Reliability::probLibException("Lock file can not be opened: " + fileName);
+        }
+
+        handle = fileHandle;
+    }
+
+    FileLocker::~FileLocker()
+    {
+        CloseHandle(static_cast<HANDLE>(handle));
+    }
+
+    void FileLocker::lock()
+    {
+        OVERLAPPED overlapped = {};
+        LockFileEx(static_cast<HANDLE>(handle), LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped);
+    }
+
+    void FileLocker::lockShared()
+    {
+        OVERLAPPED overlapped = {};
+        LockFileEx(static_cast<HANDLE>(handle), 0, 0, MAXDWORD, MAXDWORD, &overlapped);
+    }
+
+    void FileLocker::unlock()
+    {
+        OVERLAPPED overlapped = {};
+        UnlockFileEx(static_cast<HANDLE>(handle), 0, MAXDWORD, MAXDWORD, &overlapped);
+    }
+#else
+    FileLocker::FileLocker(const std::string& fileName)
+    {
+        descriptor = open(fileName.c_str(), O_RDWR | O_CREAT, 0666);
+
+        if (descriptor < 0)
+        {
+            throw Reliability::probLibException("Lock file can not be opened: " + fileName);
+        }
+    }
+
+    FileLocker::~FileLocker()
+    {
+        close(descriptor);
+    }
+
+    void FileLocker::lock()
+    {
+        flock(descriptor, LOCK_EX);
+    }
+
+    void FileLocker::lockShared()
+    {
+        flock(descriptor, LOCK_SH);
+    }
+
+    void FileLocker::unlock()
+    {
+        flock(descriptor, LOCK_UN);
+    }
+#endif
+}
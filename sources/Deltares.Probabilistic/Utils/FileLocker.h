@@ -0,0 +1,63 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include <string>
+
+namespace Deltares::Utils
+{
+    /**
+     * \brief Locks a file for other processes on the same machine
+     * \remark The lock is advisory, it only works between processes which use this class for the same file
+     */
+    class FileLocker
+    {
+    public:
+        /**
+         * \brief Constructor
+         * \param fileName File used for locking, it is created if it does not exist
+         */
+        explicit FileLocker(const std::string& fileName);
+        ~FileLocker();
+
+        FileLocker(const FileLocker&) = delete;
+        FileLocker& operator=(const FileLocker&) = delete;
+
+        /**
+         * \brief Ensures that the code until unlock() is executed by one process at a time
+         */
+        void lock();
+
+        /**
+         * \brief Ensures that the code until unlock() is not executed while another process holds the exclusive lock
+         */
+        void lockShared();
+
+        /**
+         * \brief Ends the code protected by lock() or lockShared()
+         */
+        void unlock();
+    private:
+        void* handle = nullptr;
+        int descriptor = -1;
+    };
+}
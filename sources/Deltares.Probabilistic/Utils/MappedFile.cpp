@@ -0,0 +1,151 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#include "MappedFile.h"
+#include "probLibException.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Deltares::Utils
+{
+    MappedFile::~MappedFile()
+    {
+        unmap();
+    }
+
+#ifdef _WIN32
+    const char* MappedFile::getData(size_t size)
+    {
+        if (data != nullptr && size <= mappedSize)
+        {
+            return data;
+        }
+
+        unmap();
+
+        fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            fileHandle = nullptr;
+            throw Reliability::probLibException("File can not be mapped: " + fileName);
+        }
+
+        LARGE_INTEGER fileSize;
+        GetFileSizeEx(static_cast<HANDLE>(fileHandle), &fileSize);
+        mappedSize = static_cast<size_t>(fileSize.QuadPart);
+
+        mappingHandle = CreateFileMappingA(static_cast<HANDLE>(fileHandle), nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle != nullptr)
+        {
+            data = static_cast<const char*>(MapViewOfFile(static_cast<HANDLE>(mappingHandle), FILE_MAP_READ, 0, 0, 0));
+        }
+
+        if (data == nullptr || size > mappedSize)
+        {
+            unmap();
+            throw Reliability::probLibException("File can not be mapped: " + fileName);
+        }
+
+        return data;
+    }
+
+    void MappedFile::unmap()
+    {
+        if (data != nullptr)
+        {
+            UnmapViewOfFile(data);
+            data = nullptr;
+        }
+
+        if (mappingHandle != nullptr)
+        {
+            CloseHandle(static_cast<HANDLE>(mappingHandle));
+            mappingHandle = nullptr;
+        }
+
+        if (fileHandle != nullptr)
+        {
+            CloseHandle(static_cast<HANDLE>(fileHandle));
+            fileHandle = nullptr;
+        }
+
+        mappedSize = 0;
+    }
+#else
+    const char* MappedFile::getData(size_t size)
+    {
+        if (data != nullptr && size <= mappedSize)
+        {
+            return data;
+        }
+
+        unmap();
+
+        descriptor = open(fileName.c_str(), O_RDONLY);
+
+        struct stat status {};
+        if (descriptor < 0 || fstat(descriptor, &status) != 0 || static_cast<size_t>(status.st_size) < size || status.st_size == 0)
+        {
+            unmap();
+            throw Reliability::probLibException("File can not be mapped: " + fileName);
+        }
+
+        mappedSize = static_cast<size_t>(status.st_size);
+
+        void* mapping = mmap(nullptr, mappedSize, PROT_READ, MAP_SHARED, descriptor, 0);
+        if (mapping == MAP_FAILED)
+        {
+            unmap();
+            throw Reliability::probLibException("File can not be mapped: " + fileName);
+        }
+
+        data = static_cast<const char*>(mapping);
+
+        return data;
+    }
+
+    void MappedFile::unmap()
+    {
+        if (data != nullptr)
+        {
+            munmap(const_cast<char*>(data), mappedSize);
+            data = nullptr;
+        }
+
+        if (descriptor >= 0)
+        {
+            close(descriptor);
+            descriptor = -1;
+        }
+
+        mappedSize = 0;
+    }
+#endif
+}
@@ -0,0 +1,64 @@
+// Copyright (C) Stichting Deltares. All rights reserved.
+//
+// This file is part of the Probabilistic Library.
+//
+// The Probabilistic Library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+//
+// All names, logos, and references to "Deltares" are registered trademarks of
+// Stichting Deltares and remain full property of Stichting Deltares at all times.
+// All rights reserved.
+//
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace Deltares::Utils
+{
+    /**
+     * \brief Read only memory mapping of a file, which may grow while it is mapped
+     */
+    class MappedFile
+    {
+    public:
+        /**
+         * \brief Constructor
+         * \param fileName File to be mapped, it should exist when data is requested
+         */
+        explicit MappedFile(const std::string& fileName) : fileName(fileName) {}
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * \brief Gets the mapped data, the file is mapped again if it is smaller than the requested size
+         * \param size Number of bytes which should be available
+         * \return Pointer to the start of the file, only valid until the next call
+         */
+        const char* getData(size_t size);
+
+        /**
+         * \brief Releases the mapping
+         */
+        void unmap();
+    private:
+        std::string fileName;
+        const char* data = nullptr;
+        size_t mappedSize = 0;
+        void* fileHandle = nullptr;
+        void* mappingHandle = nullptr;
+        int descriptor = -1;
+    };
+}